@@ -21,7 +21,10 @@
 
 #include "AVVMLogger.h"
 #include "AVVMModule.h"
+#include "AVVMSettings.h"
+#include "TimerManager.h"
 #include "Archetypes/AVVMPresenter.h"
+#include "Containers/Queue.h"
 #include "Engine/World.h"
 
 // @gdemers extern symbol for global access to custom LLM_tag
@@ -34,12 +37,78 @@ UScriptStruct* TBaseStructure<FAVVMNotificationPayload>::Get()
 	return FAVVMNotificationPayload::StaticStruct();
 }
 
+/**
+ *	Class description:
+ *
+ *	FAVVMPostedNotification is a notification posted from any thread. The channel is either a tag, resolved on the game thread,
+ *	or a precompiled channel index.
+ */
+struct FAVVMPostedNotification
+{
+	FGameplayTag ChannelTag = FGameplayTag::EmptyTag;
+	int32 ChannelIndex = INDEX_NONE;
+	TWeakObjectPtr<const AActor> Target = nullptr;
+	TInstancedStruct<FAVVMNotificationPayload> Payload;
+	bool bHasTarget = false;
+};
+
+/**
+ *	Class description:
+ *
+ *	FAVVMPostedNotificationQueue is a lock-free queue, multiple producers, game thread consumer. The counter bound a drain to
+ *	notifications posted before it started, so producers can't starve the game thread.
+ *
+ *	TQueue allocate a node per post. Posting is expected to be occasional (i.e - async loads, worker results), an unbounded queue
+ *	never drop a notification, and a preallocated ring would have to pick between dropping, and blocking producers when full.
+ */
+struct FAVVMPostedNotificationQueue
+{
+	void Enqueue(FAVVMPostedNotification&& PostedNotification)
+	{
+		if (bIsAcceptingNotifications.load())
+		{
+			Notifications.Enqueue(MoveTemp(PostedNotification));
+			++NumNotifications;
+		}
+	}
+
+	TQueue<FAVVMPostedNotification, EQueueMode::Mpsc> Notifications;
+	std::atomic<int32> NumNotifications = 0;
+	std::atomic<bool> bIsAcceptingNotifications = true;
+};
+
 bool UAVVMNotificationSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 {
 	const auto* World = Cast<UWorld>(Outer);
 	return IsValid(World) ? World->IsGameWorld() : false;
 }
 
+void UAVVMNotificationSubsystem::Deinitialize()
+{
+	Super::Deinitialize();
+
+	// @gdemers post handles may outlive this world. they keep the queue alive, but posts are dropped.
+	if (PostedNotifications.IsValid())
+	{
+		PostedNotifications->bIsAcceptingNotifications = false;
+		PostedNotifications->Notifications.Empty();
+		PostedNotifications->NumNotifications = 0;
+		PostedNotifications.Reset();
+	}
+}
+
+void UAVVMNotificationSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	ExecutePostedNotifications();
+}
+
+TStatId UAVVMNotificationSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAVVMNotificationSubsystem, STATGROUP_Tickables);
+}
+
 UAVVMNotificationSubsystem* UAVVMNotificationSubsystem::Get(const UObject* WorldContextObject)
 {
 	const UWorld* World = IsValid(WorldContextObject) ? WorldContextObject->GetWorld() : nullptr;
@@ -53,12 +122,11 @@ UAVVMNotificationSubsystem* UAVVMNotificationSubsystem::Get(const UObject* World
 	}
 }
 
-void UAVVMNotificationSubsystem::Static_UnregisterObserver(const UObject* WorldContextObject,
-                                                           const FAVVMObserverContextArgs& ObserverContext)
+const AActor* UAVVMNotificationSubsystem::GetOwningActor(const UObject* WorldContextObject)
 {
 	if (!IsValid(WorldContextObject))
 	{
-		return;
+		return nullptr;
 	}
 
 	const auto* OwningActor = Cast<AActor>(WorldContextObject);
@@ -67,20 +135,92 @@ void UAVVMNotificationSubsystem::Static_UnregisterObserver(const UObject* WorldC
 		OwningActor = WorldContextObject->GetTypedOuter<const AActor>();
 	}
 
-	if (!ensureAlwaysMsgf(IsValid(OwningActor),
-	                      TEXT("UObject provided isnt owned by a valid AActor. This may not be the correct place to unbind to this subsystem.")))
+	return OwningActor;
+}
+
+void UAVVMNotificationSubsystem::ExecutePostedNotifications()
+{
+	check(IsInGameThread());
+
+	if (!PostedNotifications.IsValid())
 	{
 		return;
 	}
 
-	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
-	if (IsValid(AVVMNotificationSubsystem))
+	FAVVMPostedNotificationQueue& Queue = *PostedNotifications;
+	const int32 NumNotifications = Queue.NumNotifications.load();
+	for (int32 i = 0; i < NumNotifications; ++i)
 	{
-		FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
-		FilteringMechanism.Unregister(OwningActor, ObserverContext.ChannelTag);
+		FAVVMPostedNotification PostedNotification;
+		if (!Queue.Notifications.Dequeue(PostedNotification))
+		{
+			break;
+		}
+
+		--Queue.NumNotifications;
+
+		// @gdemers the target may have been destroyed between posting, and draining.
+		const AActor* Target = PostedNotification.Target.Get();
+		if (PostedNotification.bHasTarget && !IsValid(Target))
+		{
+			continue;
+		}
+
+		FAVVObserversFilteringMechanism& FilteringMechanism = ObserversFilteringMechanism;
+		if (PostedNotification.ChannelIndex != INDEX_NONE)
+		{
+			// @gdemers the channel handle may not have been issued by this world.
+			if (!FilteringMechanism.Channels.IsValidIndex(PostedNotification.ChannelIndex))
+			{
+				AVVM_LOGGER_LOG(LogUI,
+				                Target,
+				                Target,
+				                TEXT("Dropping Posted Notification on %s. Invalid Channel Handle."),
+				                IsValid(Target) ? *GetNameSafe(Target) : TEXT("All Registered Actors"));
+				continue;
+			}
+
+			FilteringMechanism.Broadcast(PostedNotification.ChannelIndex, Target, PostedNotification.Payload);
+		}
+		else
+		{
+			FilteringMechanism.Broadcast(FAVVMNotificationContextArgs{PostedNotification.ChannelTag, Target, MoveTemp(PostedNotification.Payload)});
+		}
 	}
 }
 
+void UAVVMNotificationSubsystem::ExecuteDeferredNotifications()
+{
+	bIsDeferredFlushScheduled = false;
+
+	if (LastFlushFrame != GFrameCounter)
+	{
+		LastFlushFrame = GFrameCounter;
+		NumFlushedThisFrame = 0;
+	}
+
+	const int32 MaxDeferredNotificationsPerFrame = UAVVMSettings::GetMaxDeferredNotificationsPerFrame();
+	const int32 Budget = (MaxDeferredNotificationsPerFrame > 0) ? FMath::Max(MaxDeferredNotificationsPerFrame - NumFlushedThisFrame, 0) : MAX_int32;
+
+	int32 NumFlushed = 0;
+	const bool bIsBudgetExhausted = ObserversFilteringMechanism.ExecuteDeferredNotifications(Budget, NumFlushed);
+	NumFlushedThisFrame += NumFlushed;
+
+	// @gdemers resume on next frame. a flush request issued before then is absorbed by the scheduled one.
+	UWorld* World = GetWorld();
+	if (bIsBudgetExhausted && !bIsDeferredFlushScheduled && IsValid(World))
+	{
+		bIsDeferredFlushScheduled = true;
+		World->GetTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &UAVVMNotificationSubsystem::ExecuteDeferredNotifications));
+	}
+}
+
+void UAVVMNotificationSubsystem::Static_UnregisterObserver(const UObject* WorldContextObject,
+                                                           const FAVVMObserverContextArgs& ObserverContext)
+{
+	Static_UnregisterNativeObserver(WorldContextObject, ObserverContext.ChannelTag);
+}
+
 void UAVVMNotificationSubsystem::Static_RegisterObserver(const UObject* WorldContextObject,
                                                          const FAVVMObserverContextArgs& ObserverContext)
 {
@@ -89,12 +229,7 @@ void UAVVMNotificationSubsystem::Static_RegisterObserver(const UObject* WorldCon
 		return;
 	}
 
-	const auto* OwningActor = Cast<AActor>(WorldContextObject);
-	if (!IsValid(OwningActor))
-	{
-		OwningActor = WorldContextObject->GetTypedOuter<const AActor>();
-	}
-
+	const AActor* OwningActor = GetOwningActor(WorldContextObject);
 	if (!ensureAlwaysMsgf(IsValid(OwningActor),
 	                      TEXT("UObject provided isnt owned by a valid AActor. This may not be the correct place to bind to this subsystem.")))
 	{
@@ -104,8 +239,11 @@ void UAVVMNotificationSubsystem::Static_RegisterObserver(const UObject* WorldCon
 	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
 	if (IsValid(AVVMNotificationSubsystem))
 	{
+		FAVVMObserverCallback Callback;
+		Callback.Callback = ObserverContext.Callback;
+
 		FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
-		FilteringMechanism.Register(OwningActor, ObserverContext.ChannelTag, ObserverContext.Callback);
+		FilteringMechanism.Register(OwningActor, ObserverContext.ChannelTag, MoveTemp(Callback), ObserverContext.bIncludeChildChannels);
 	}
 }
 
@@ -122,11 +260,158 @@ void UAVVMNotificationSubsystem::Static_BroadcastChannel(const UObject* WorldCon
 
 void UAVVMNotificationSubsystem::Static_ExecuteDeferredNotifications(const UObject* WorldContextObject)
 {
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (IsValid(AVVMNotificationSubsystem) && !AVVMNotificationSubsystem->bIsDeferredFlushScheduled)
+	{
+		AVVMNotificationSubsystem->ExecuteDeferredNotifications();
+	}
+}
+
+void UAVVMNotificationSubsystem::Static_UnregisterNativeObserver(const UObject* WorldContextObject,
+                                                                 const FGameplayTag& ChannelTag)
+{
+	if (!IsValid(WorldContextObject))
+	{
+		return;
+	}
+
+	const AActor* OwningActor = GetOwningActor(WorldContextObject);
+	if (!ensureAlwaysMsgf(IsValid(OwningActor),
+	                      TEXT("UObject provided isnt owned by a valid AActor. This may not be the correct place to unbind to this subsystem.")))
+	{
+		return;
+	}
+
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (IsValid(AVVMNotificationSubsystem))
+	{
+		FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
+		FilteringMechanism.Unregister(OwningActor, ChannelTag);
+	}
+}
+
+void UAVVMNotificationSubsystem::Static_RegisterNativeObserver(const UObject* WorldContextObject,
+                                                               const FGameplayTag& ChannelTag,
+                                                               FAVVMOnChannelNotifiedNativeDelegate&& Callback,
+                                                               const bool bIncludeChildChannels)
+{
+	if (!IsValid(WorldContextObject))
+	{
+		return;
+	}
+
+	const AActor* OwningActor = GetOwningActor(WorldContextObject);
+	if (!ensureAlwaysMsgf(IsValid(OwningActor),
+	                      TEXT("UObject provided isnt owned by a valid AActor. This may not be the correct place to bind to this subsystem.")))
+	{
+		return;
+	}
+
 	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
 	if (IsValid(AVVMNotificationSubsystem))
+	{
+		FAVVMObserverCallback ObserverCallback;
+		ObserverCallback.NativeCallback = MoveTemp(Callback);
+
+		FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
+		FilteringMechanism.Register(OwningActor, ChannelTag, MoveTemp(ObserverCallback), bIncludeChildChannels);
+	}
+}
+
+FAVVMNotificationChannelHandle UAVVMNotificationSubsystem::Static_GetChannelHandle(const UObject* WorldContextObject,
+                                                                                   const FGameplayTag& ChannelTag)
+{
+	FAVVMNotificationChannelHandle OutHandle;
+
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (IsValid(AVVMNotificationSubsystem) && ChannelTag.IsValid())
 	{
 		FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
-		FilteringMechanism.ExecuteDeferredNotifications();
+		OutHandle.ChannelIndex = FilteringMechanism.FindOrAddChannelIndex(ChannelTag);
+	}
+
+	return OutHandle;
+}
+
+void UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(const UObject* WorldContextObject,
+                                                               const FGameplayTag& ChannelTag,
+                                                               const AActor* Target,
+                                                               const TInstancedStruct<FAVVMNotificationPayload>& Payload)
+{
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (!IsValid(AVVMNotificationSubsystem))
+	{
+		return;
+	}
+
+	FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
+	if (ChannelTag.IsValid())
+	{
+		// @gdemers a channel without observers may still have parent channels observed. its parent chain is built once, on first use.
+		FilteringMechanism.Broadcast(FilteringMechanism.FindOrAddChannelIndex(ChannelTag), Target, Payload);
+	}
+	else
+	{
+		FilteringMechanism.Broadcast(FAVVMNotificationContextArgs{ChannelTag, Target, Payload});
+	}
+}
+
+void UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(const UObject* WorldContextObject,
+                                                               const FAVVMNotificationChannelHandle& ChannelHandle,
+                                                               const AActor* Target,
+                                                               const TInstancedStruct<FAVVMNotificationPayload>& Payload)
+{
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (!IsValid(AVVMNotificationSubsystem))
+	{
+		return;
+	}
+
+	FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
+	if (ensureAlwaysMsgf(FilteringMechanism.Channels.IsValidIndex(ChannelHandle.ChannelIndex),
+	                     TEXT("FAVVMNotificationChannelHandle provided wasn't issued by this world notification subsystem.")))
+	{
+		FilteringMechanism.Broadcast(ChannelHandle.ChannelIndex, Target, Payload);
+	}
+}
+
+FAVVMNotificationPostHandle UAVVMNotificationSubsystem::Static_GetPostHandle(const UObject* WorldContextObject)
+{
+	check(IsInGameThread());
+
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (!IsValid(AVVMNotificationSubsystem))
+	{
+		return FAVVMNotificationPostHandle{};
+	}
+
+	if (!AVVMNotificationSubsystem->PostedNotifications.IsValid())
+	{
+		AVVMNotificationSubsystem->PostedNotifications = MakeShared<FAVVMPostedNotificationQueue, ESPMode::ThreadSafe>();
+	}
+
+	return FAVVMNotificationPostHandle{AVVMNotificationSubsystem->PostedNotifications};
+}
+
+void UAVVMNotificationSubsystem::Static_PostNotification(const FAVVMNotificationPostHandle& PostHandle,
+                                                         const FGameplayTag& ChannelTag,
+                                                         const AActor* Target,
+                                                         TInstancedStruct<FAVVMNotificationPayload>&& Payload)
+{
+	if (PostHandle.IsValid())
+	{
+		PostHandle.Queue->Enqueue(FAVVMPostedNotification{ChannelTag, INDEX_NONE, Target, MoveTemp(Payload), Target != nullptr});
+	}
+}
+
+void UAVVMNotificationSubsystem::Static_PostNotification(const FAVVMNotificationPostHandle& PostHandle,
+                                                         const FAVVMNotificationChannelHandle& ChannelHandle,
+                                                         const AActor* Target,
+                                                         TInstancedStruct<FAVVMNotificationPayload>&& Payload)
+{
+	if (PostHandle.IsValid() && ensureAlwaysMsgf(ChannelHandle.IsValid(), TEXT("Posting Notification with invalid Channel Handle.")))
+	{
+		PostHandle.Queue->Enqueue(FAVVMPostedNotification{FGameplayTag::EmptyTag, ChannelHandle.ChannelIndex, Target, MoveTemp(Payload), Target != nullptr});
 	}
 }
 
@@ -140,14 +425,16 @@ int32 UAVVMNotificationSubsystem::Static_GetChannelCount(const UObject* WorldCon
 		return INDEX_NONE;
 	}
 
-	const bool bDoesContains = AVVMNotificationSubsystem->ObserversFilteringMechanism.TagToObservers.Contains(ChannelTag);
-	if (!bDoesContains)
+	const FAVVObserversFilteringMechanism& FilteringMechanism = AVVMNotificationSubsystem->ObserversFilteringMechanism;
+	const int32 ChannelIndex = FilteringMechanism.FindChannelIndex(ChannelTag);
+	if (ChannelIndex == INDEX_NONE)
 	{
 		return INDEX_NONE;
 	}
 
-	const FAVVMObservers& Observers = AVVMNotificationSubsystem->ObserversFilteringMechanism.TagToObservers[ChannelTag];
-	return Observers.Observers.Num();
+	// @gdemers inactive channels are kept around for stable indices, but behave as if they were removed.
+	const FAVVMChannel& Channel = FilteringMechanism.Channels[ChannelIndex];
+	return !Channel.IsEmpty() ? Channel.Num() : INDEX_NONE;
 }
 
 int32 UAVVMNotificationSubsystem::Static_GetChannelsCount(const UObject* WorldContextObject)
@@ -155,7 +442,37 @@ int32 UAVVMNotificationSubsystem::Static_GetChannelsCount(const UObject* WorldCo
 	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
 	if (IsValid(AVVMNotificationSubsystem))
 	{
-		return AVVMNotificationSubsystem->ObserversFilteringMechanism.TagToObservers.Num();
+		return AVVMNotificationSubsystem->ObserversFilteringMechanism.GetNumActiveChannels();
+	}
+	else
+	{
+		return INDEX_NONE;
+	}
+}
+
+int32 UAVVMNotificationSubsystem::Static_GetPendingNotificationsCount(const UObject* WorldContextObject)
+{
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (!IsValid(AVVMNotificationSubsystem))
+	{
+		return INDEX_NONE;
+	}
+
+	int32 OutNumPendingNotifications = 0;
+	for (const FAVVMChannel& Channel : AVVMNotificationSubsystem->ObserversFilteringMechanism.Channels)
+	{
+		OutNumPendingNotifications += Channel.NumPendingNotifications;
+	}
+
+	return OutNumPendingNotifications;
+}
+
+int32 UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(const UObject* WorldContextObject)
+{
+	auto* AVVMNotificationSubsystem = UAVVMNotificationSubsystem::Get(WorldContextObject);
+	if (IsValid(AVVMNotificationSubsystem))
+	{
+		return AVVMNotificationSubsystem->ObserversFilteringMechanism.PendingNotifications.Num();
 	}
 	else
 	{
@@ -164,62 +481,151 @@ int32 UAVVMNotificationSubsystem::Static_GetChannelsCount(const UObject* WorldCo
 }
 #endif
 
+void UAVVMNotificationSubsystem::FAVVMObserverCallback::Execute(const TInstancedStruct<FAVVMNotificationPayload>& Payload) const
+{
+	if (NativeCallback.IsBound())
+	{
+		NativeCallback.Execute(Payload);
+	}
+	else
+	{
+		Callback.ExecuteIfBound(Payload);
+	}
+}
+
 UAVVMNotificationSubsystem::FAVVMObservers::~FAVVMObservers()
 {
-	Observers.Reset();
+	Targets.Reset();
+	Callbacks.Reset();
 }
 
-void UAVVMNotificationSubsystem::FAVVMObservers::Unregister(const AActor* Target)
+int32 UAVVMNotificationSubsystem::FAVVMObservers::Find(const AActor* Target) const
 {
-	Observers.Remove(Target);
+	return Targets.IndexOfByKey(Target);
 }
 
-void UAVVMNotificationSubsystem::FAVVMObservers::Register(const AActor* Target,
-                                                          const FAVVMOnChannelNotifiedSingleCastDelegate& Callback)
+void UAVVMNotificationSubsystem::FAVVMObservers::Unregister(const AActor* Target, const bool bIsBroadcasting)
 {
-	FAVVMOnChannelNotifiedSingleCastDelegate& OutResult = Observers.FindOrAdd(Target);
-	OutResult = Callback;
+	const int32 ObserverIndex = Find(Target);
+	if (ObserverIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	if (bIsBroadcasting)
+	{
+		// @gdemers the callback may be executing. we only clear the target, and compact once broadcast complete.
+		Targets[ObserverIndex].Reset();
+		++NumPendingRemovals;
+	}
+	else
+	{
+		Targets.RemoveAtSwap(ObserverIndex, 1, EAllowShrinking::No);
+		Callbacks.RemoveAtSwap(ObserverIndex, 1, EAllowShrinking::No);
+	}
 }
 
-void UAVVMNotificationSubsystem::FAVVMObservers::BroadcastAll(const TInstancedStruct<FAVVMNotificationPayload>& Payload) const
+void UAVVMNotificationSubsystem::FAVVMObservers::Register(const AActor* Target, FAVVMObserverCallback&& Callback)
 {
-	for (const auto& [Actor, Callback] : Observers)
+	const int32 ObserverIndex = Find(Target);
+	if (ObserverIndex != INDEX_NONE)
 	{
-		Callback.ExecuteIfBound(Payload);
+		Callbacks[ObserverIndex] = MoveTemp(Callback);
+	}
+	else
+	{
+		Targets.Add(Target);
+		Callbacks.Add(MoveTemp(Callback));
 	}
 }
 
-void UAVVMNotificationSubsystem::FAVVMObservers::Broadcast(const AActor* Target,
-                                                           const TInstancedStruct<FAVVMNotificationPayload>& Payload) const
+void UAVVMNotificationSubsystem::FAVVMObservers::Compact()
 {
-	const FAVVMOnChannelNotifiedSingleCastDelegate* SearchResult = Observers.Find(Target);
-	if (ensureAlwaysMsgf(SearchResult != nullptr, TEXT("FAVVMObservers::Broadcast provided with invalid Target Actor")))
+	for (int32 i = Targets.Num() - 1; (i >= 0) && (NumPendingRemovals > 0); --i)
 	{
-		SearchResult->ExecuteIfBound(Payload);
+		if (Targets[i].IsExplicitlyNull())
+		{
+			Targets.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			Callbacks.RemoveAtSwap(i, 1, EAllowShrinking::No);
+			--NumPendingRemovals;
+		}
 	}
+
+	NumPendingRemovals = 0;
 }
 
 bool UAVVMNotificationSubsystem::FAVVMObservers::IsEmpty() const
 {
-	return Observers.IsEmpty();
+	return (Num() == 0);
+}
+
+int32 UAVVMNotificationSubsystem::FAVVMObservers::Num() const
+{
+	return (Targets.Num() - NumPendingRemovals);
+}
+
+UAVVMNotificationSubsystem::FAVVMObservers& UAVVMNotificationSubsystem::FAVVMChannel::GetObservers(const bool bIncludeChildChannels)
+{
+	return bIncludeChildChannels ? SubtreeObservers : Observers;
+}
+
+const UAVVMNotificationSubsystem::FAVVMObservers& UAVVMNotificationSubsystem::FAVVMChannel::GetObservers(const bool bIncludeChildChannels) const
+{
+	return bIncludeChildChannels ? SubtreeObservers : Observers;
+}
+
+bool UAVVMNotificationSubsystem::FAVVMChannel::IsEmpty() const
+{
+	return Observers.IsEmpty() && SubtreeObservers.IsEmpty();
+}
+
+int32 UAVVMNotificationSubsystem::FAVVMChannel::Num() const
+{
+	return (Observers.Num() + SubtreeObservers.Num());
+}
+
+bool UAVVMNotificationSubsystem::FAVVMPendingNotification::IsExpired(const double CurrentTime) const
+{
+	return (CurrentTime >= ExpirationTime);
 }
 
 UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::~FAVVObserversFilteringMechanism()
 {
-	PendingRequests.Reset();
-	TagToObservers.Reset();
+	PendingNotifications.Reset();
+	PendingRegistrations.Reset();
+	PendingCompactions.Reset();
+	Channels.Reset();
+	TagToChannelIndex.Reset();
 }
 
 void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::Unregister(const AActor* Target,
                                                                              const FGameplayTag& ChannelTag)
 {
-	FAVVMObservers* SearchResult = TagToObservers.Find(ChannelTag);
-	if (SearchResult == nullptr)
+	const int32 ChannelIndex = FindChannelIndex(ChannelTag);
+	if (ChannelIndex == INDEX_NONE)
 	{
 		return;
 	}
 
-	SearchResult->Unregister(Target);
+	const bool bIsBroadcasting = (BroadcastDepth > 0);
+
+	// @gdemers an observer may unregister within the same broadcast it registered.
+	PendingRegistrations.RemoveAllSwap([ChannelIndex, Target](const FAVVMPendingObserver& PendingObserver)
+	{
+		return (PendingObserver.ChannelIndex == ChannelIndex) && (PendingObserver.Target == Target);
+	}, EAllowShrinking::No);
+
+	// @gdemers we don't know which of exact, or child channels subscription the observer used. remove from both.
+	for (const bool bIncludeChildChannels : {false, true})
+	{
+		FAVVMObservers& Observers = Channels[ChannelIndex].GetObservers(bIncludeChildChannels);
+		Observers.Unregister(Target, bIsBroadcasting);
+
+		if (bIsBroadcasting && (Observers.NumPendingRemovals > 0))
+		{
+			PendingCompactions.AddUnique(TPair<int32, bool>(ChannelIndex, bIncludeChildChannels));
+		}
+	}
 
 	AVVM_LOGGER_LOG(LogUI,
 	                Target,
@@ -227,63 +633,342 @@ void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::Unregister(con
 	                TEXT("%s unregister from channel %s."),
 	                *GetNameSafe(Target),
 	                *ChannelTag.ToString());
-
-	if (SearchResult->IsEmpty())
-	{
-		TagToObservers.Remove(ChannelTag);
-	}
 }
 
 void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::Register(const AActor* Target,
                                                                            const FGameplayTag& ChannelTag,
-                                                                           const FAVVMOnChannelNotifiedSingleCastDelegate& Callback)
+                                                                           FAVVMObserverCallback&& Callback,
+                                                                           const bool bIncludeChildChannels)
 {
-	FAVVMObservers& SearchResult = TagToObservers.FindOrAdd(ChannelTag);
-	SearchResult.Register(Target, Callback);
+	const int32 ChannelIndex = FindOrAddChannelIndex(ChannelTag);
+	if (BroadcastDepth > 0)
+	{
+		PendingRegistrations.Add(FAVVMPendingObserver{ChannelIndex, Target, MoveTemp(Callback), bIncludeChildChannels});
+	}
+	else
+	{
+		// @gdemers an observer switching subscription mode replace its previous subscription.
+		FAVVMChannel& Channel = Channels[ChannelIndex];
+		Channel.GetObservers(!bIncludeChildChannels).Unregister(Target, false);
+		Channel.GetObservers(bIncludeChildChannels).Register(Target, MoveTemp(Callback));
+	}
 
 	AVVM_LOGGER_LOG(LogUI,
 	                Target,
 	                Target,
-	                TEXT("%s register to channel %s."),
+	                TEXT("%s register to channel %s%s."),
 	                *GetNameSafe(Target),
-	                *ChannelTag.ToString());
+	                *ChannelTag.ToString(),
+	                bIncludeChildChannels ? TEXT(", and its child channels") : TEXT(""));
 }
 
 void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::Broadcast(const FAVVMNotificationContextArgs& NotificationContext)
 {
-	const FAVVMObservers* SearchResult = TagToObservers.Find(NotificationContext.ChannelTag);
-	if (SearchResult == nullptr)
+	// @gdemers a notification without channel can never be observed. drop it, instead of deferring it forever.
+	if (!NotificationContext.ChannelTag.IsValid())
 	{
 		AVVM_LOGGER_LOG(LogUI,
 		                NotificationContext.Target.Get(),
 		                NotificationContext.Target.Get(),
-		                TEXT("Deferring Tag Channel %s Notification on %s."),
-		                *NotificationContext.ChannelTag.ToString(),
+		                TEXT("Dropping Notification on %s. Invalid Tag Channel."),
 		                NotificationContext.Target.IsValid() ? *GetNameSafe(NotificationContext.Target.Get()) : TEXT("All Registered Actors"));
+		return;
+	}
+
+	const int32 ChannelIndex = FindOrAddChannelIndex(NotificationContext.ChannelTag);
+	Broadcast(ChannelIndex, NotificationContext.Target.Get(), NotificationContext.Payload);
+}
+
+void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::Broadcast(const int32 ChannelIndex,
+                                                                            const AActor* Target,
+                                                                            const TInstancedStruct<FAVVMNotificationPayload>& Payload)
+{
+	if (!HasObservers(ChannelIndex))
+	{
+		AVVM_LOGGER_LOG(LogUI,
+		                Target,
+		                Target,
+		                TEXT("Deferring Tag Channel %s Notification on %s."),
+		                *Channels[ChannelIndex].ChannelTag.ToString(),
+		                IsValid(Target) ? *GetNameSafe(Target) : TEXT("All Registered Actors"));
 
-		PendingRequests.Add(NotificationContext);
+		Defer(ChannelIndex, Target, Payload);
 		return;
 	}
 
-	const TInstancedStruct<FAVVMNotificationPayload>& Payload = NotificationContext.Payload;
-	const AActor* Target = NotificationContext.Target.Get();
+	++BroadcastDepth;
+
+	// @gdemers exact observers first, then observers of this channel subtree, and finally observers of parent channels subtree,
+	// from the closest parent to the root.
+	int32 NumNotified = Dispatch(ChannelIndex, false, Target, Payload);
+	NumNotified += Dispatch(ChannelIndex, true, Target, Payload);
+
+	const int32 NumParentChannels = Channels[ChannelIndex].ParentChannelIndices.Num();
+	for (int32 i = 0; i < NumParentChannels; ++i)
+	{
+		NumNotified += Dispatch(Channels[ChannelIndex].ParentChannelIndices[i], true, Target, Payload);
+	}
+
+	--BroadcastDepth;
+
+	ensureAlwaysMsgf(!IsValid(Target) || (NumNotified > 0), TEXT("FAVVMObservers::Broadcast provided with invalid Target Actor"));
+
+	if (BroadcastDepth == 0)
+	{
+		FlushPendingOperations();
+	}
+}
+
+int32 UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::Dispatch(const int32 ChannelIndex,
+                                                                            const bool bIncludeChildChannels,
+                                                                            const AActor* Target,
+                                                                            const TInstancedStruct<FAVVMNotificationPayload>& Payload) const
+{
+	// @gdemers IMPORTANT : callbacks may register new channels, and reallocate our storage. we index on each iteration, and
+	// never hold a reference across a callback. observers storage itself isn't mutated until all broadcasts complete.
 	if (!IsValid(Target))
 	{
-		SearchResult->BroadcastAll(Payload);
+		int32 OutNumNotified = 0;
+
+		const int32 NumObservers = Channels[ChannelIndex].GetObservers(bIncludeChildChannels).Targets.Num();
+		for (int32 i = 0; i < NumObservers; ++i)
+		{
+			const FAVVMObservers& Observers = Channels[ChannelIndex].GetObservers(bIncludeChildChannels);
+			if (Observers.Targets[i].IsValid())
+			{
+				Observers.Callbacks[i].Execute(Payload);
+				++OutNumNotified;
+			}
+		}
+
+		return OutNumNotified;
 	}
 	else
 	{
-		SearchResult->Broadcast(Target, Payload);
+		const FAVVMObservers& Observers = Channels[ChannelIndex].GetObservers(bIncludeChildChannels);
+		const int32 ObserverIndex = Observers.Find(Target);
+		if (ObserverIndex == INDEX_NONE)
+		{
+			return 0;
+		}
+
+		Observers.Callbacks[ObserverIndex].Execute(Payload);
+		return 1;
+	}
+}
+
+bool UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::HasObservers(const int32 ChannelIndex) const
+{
+	const FAVVMChannel& Channel = Channels[ChannelIndex];
+	if (!Channel.IsEmpty())
+	{
+		return true;
+	}
+
+	for (const int32 ParentChannelIndex : Channel.ParentChannelIndices)
+	{
+		if (!Channels[ParentChannelIndex].SubtreeObservers.IsEmpty())
+		{
+			return true;
+		}
+	}
+
+	return false;
+}
+
+void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::Defer(const int32 ChannelIndex,
+                                                                        const AActor* Target,
+                                                                        const TInstancedStruct<FAVVMNotificationPayload>& Payload)
+{
+	const double CurrentTime = FPlatformTime::Seconds();
+	const float TimeToLive = UAVVMSettings::GetPendingNotificationTimeToLive();
+	const double ExpirationTime = (TimeToLive > 0.f) ? (CurrentTime + TimeToLive) : TNumericLimits<double>::Max();
+
+	// @gdemers expired notifications are released once they reach the front of the queue. they still count against their
+	// channel limit, so the queue remain bounded while the front entry is alive.
+	while (!PendingNotifications.IsEmpty() && PendingNotifications.First().IsExpired(CurrentTime))
+	{
+		PopPendingNotification();
+	}
+
+	// @gdemers an empty payload carry no state, and is always coalesced.
+	const FAVVMNotificationPayload* NewPayload = Payload.GetPtr();
+	const bool bCanCoalesce = (NewPayload == nullptr) || NewPayload->CanCoalesce();
+	if (bCanCoalesce && (Channels[ChannelIndex].NumPendingNotifications > 0))
+	{
+		const bool bHasTarget = IsValid(Target);
+		const UScriptStruct* ScriptStruct = Payload.GetScriptStruct();
+		for (int32 i = PendingNotifications.Num() - 1; i >= 0; --i)
+		{
+			FAVVMPendingNotification& PendingNotification = PendingNotifications[i];
+			if ((PendingNotification.ChannelIndex == ChannelIndex) &&
+				(PendingNotification.bHasTarget == bHasTarget) &&
+				(PendingNotification.Target == Target) &&
+				(PendingNotification.Payload.GetScriptStruct() == ScriptStruct))
+			{
+				PendingNotification.Payload = Payload;
+				PendingNotification.ExpirationTime = ExpirationTime;
+				return;
+			}
+		}
+	}
+
+	const int32 MaxPendingNotificationsPerChannel = FMath::Max(UAVVMSettings::GetMaxPendingNotificationsPerChannel(), 1);
+	if (Channels[ChannelIndex].NumPendingNotifications >= MaxPendingNotificationsPerChannel)
+	{
+		EvictOldestPendingNotification(ChannelIndex);
+	}
+
+	PendingNotifications.Add(FAVVMPendingNotification{ChannelIndex, Target, Payload, ExpirationTime, IsValid(Target)});
+	++Channels[ChannelIndex].NumPendingNotifications;
+}
+
+bool UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::ExecuteDeferredNotifications(const int32 Budget,
+                                                                                               int32& OutNumFlushed)
+{
+	OutNumFlushed = 0;
+
+	// @gdemers only visit notifications queued before this flush. those deferred again, or deferred by a callback, are pushed
+	// at the back, and wait for the next flush.
+	// @gdemers a callback may evict one of the notifications left to visit. the count is a member so eviction can shrink it.
+	const double CurrentTime = FPlatformTime::Seconds();
+	NumPendingNotificationsToVisit = PendingNotifications.Num();
+	while (NumPendingNotificationsToVisit > 0)
+	{
+		if (OutNumFlushed >= Budget)
+		{
+			NumPendingNotificationsToVisit = 0;
+			return true;
+		}
+
+		// @gdemers IMPORTANT : callbacks may defer notifications, and reallocate our storage. we move the notification out
+		// before broadcasting.
+		FAVVMPendingNotification PendingNotification = PendingNotifications.PopFrontValue();
+		--NumPendingNotificationsToVisit;
+
+		const bool bIsTargetLost = PendingNotification.bHasTarget && !PendingNotification.Target.IsValid();
+		if (PendingNotification.IsExpired(CurrentTime) || bIsTargetLost)
+		{
+			--Channels[PendingNotification.ChannelIndex].NumPendingNotifications;
+			continue;
+		}
+
+		if (!HasObservers(PendingNotification.ChannelIndex))
+		{
+			PendingNotifications.Add(MoveTemp(PendingNotification));
+			continue;
+		}
+
+		--Channels[PendingNotification.ChannelIndex].NumPendingNotifications;
+		Broadcast(PendingNotification.ChannelIndex, PendingNotification.Target.Get(), PendingNotification.Payload);
+		++OutNumFlushed;
 	}
+
+	return false;
+}
+
+void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::EvictOldestPendingNotification(const int32 ChannelIndex)
+{
+	const int32 NumPendingNotifications = PendingNotifications.Num();
+	for (int32 i = 0; i < NumPendingNotifications; ++i)
+	{
+		FAVVMPendingNotification& PendingNotification = PendingNotifications[i];
+		if (PendingNotification.ChannelIndex != ChannelIndex)
+		{
+			continue;
+		}
+
+		AVVM_LOGGER_LOG(LogUI,
+		                PendingNotification.Target.Get(),
+		                PendingNotification.Target.Get(),
+		                TEXT("Evicting oldest Tag Channel %s Notification. Channel reached its pending notifications limit."),
+		                *Channels[ChannelIndex].ChannelTag.ToString());
+
+		// @gdemers remove the entry, rather than leaving a tombstone behind. a long-lived front entry would otherwise keep
+		// all tombstones queued after it.
+		PendingNotifications.RemoveAt(i);
+		--Channels[ChannelIndex].NumPendingNotifications;
+
+		if (i < NumPendingNotificationsToVisit)
+		{
+			--NumPendingNotificationsToVisit;
+		}
+
+		return;
+	}
+}
+
+void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::PopPendingNotification()
+{
+	--Channels[PendingNotifications.First().ChannelIndex].NumPendingNotifications;
+	PendingNotifications.PopFront();
 }
 
-void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::ExecuteDeferredNotifications()
+int32 UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::FindChannelIndex(const FGameplayTag& ChannelTag) const
 {
-	TArray<FAVVMNotificationContextArgs> OldPendingRequests = MoveTemp(PendingRequests);
-	for (auto Iterator = OldPendingRequests.CreateIterator(); Iterator; ++Iterator)
+	const int32* SearchResult = TagToChannelIndex.Find(ChannelTag);
+	return (SearchResult != nullptr) ? *SearchResult : INDEX_NONE;
+}
+
+int32 UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::FindOrAddChannelIndex(const FGameplayTag& ChannelTag)
+{
+	const int32* SearchResult = TagToChannelIndex.Find(ChannelTag);
+	if (SearchResult != nullptr)
 	{
-		const FAVVMNotificationContextArgs OldCtxArgs = *Iterator;
-		Iterator.RemoveCurrentSwap();
-		Broadcast(OldCtxArgs);
+		return *SearchResult;
 	}
+
+	// @gdemers parent channels are created first. a channel parent chain is its direct parent, followed by the direct parent chain.
+	TArray<int32> ParentChannelIndices;
+
+	const FGameplayTag ParentTag = ChannelTag.RequestDirectParent();
+	if (ParentTag.IsValid())
+	{
+		const int32 ParentChannelIndex = FindOrAddChannelIndex(ParentTag);
+		ParentChannelIndices.Reserve(Channels[ParentChannelIndex].ParentChannelIndices.Num() + 1);
+		ParentChannelIndices.Add(ParentChannelIndex);
+		ParentChannelIndices.Append(Channels[ParentChannelIndex].ParentChannelIndices);
+	}
+
+	const int32 ChannelIndex = Channels.AddDefaulted();
+	FAVVMChannel& Channel = Channels[ChannelIndex];
+	Channel.ChannelTag = ChannelTag;
+	Channel.ParentChannelIndices = MoveTemp(ParentChannelIndices);
+
+	TagToChannelIndex.Add(ChannelTag, ChannelIndex);
+	return ChannelIndex;
+}
+
+int32 UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::GetNumActiveChannels() const
+{
+	int32 OutNumActiveChannels = 0;
+	for (const FAVVMChannel& Channel : Channels)
+	{
+		OutNumActiveChannels += !Channel.IsEmpty() ? 1 : 0;
+	}
+
+	return OutNumActiveChannels;
+}
+
+void UAVVMNotificationSubsystem::FAVVObserversFilteringMechanism::FlushPendingOperations()
+{
+	for (const TPair<int32, bool>& PendingCompaction : PendingCompactions)
+	{
+		Channels[PendingCompaction.Key].GetObservers(PendingCompaction.Value).Compact();
+	}
+
+	for (FAVVMPendingObserver& PendingObserver : PendingRegistrations)
+	{
+		const AActor* Target = PendingObserver.Target.Get();
+		if (IsValid(Target))
+		{
+			FAVVMChannel& Channel = Channels[PendingObserver.ChannelIndex];
+			Channel.GetObservers(!PendingObserver.bIncludeChildChannels).Unregister(Target, false);
+			Channel.GetObservers(PendingObserver.bIncludeChildChannels).Register(Target, MoveTemp(PendingObserver.Callback));
+		}
+	}
+
+	// @gdemers IMPORTANT : Reset, and not Empty. we want to keep our allocation around for the next broadcast.
+	PendingCompactions.Reset();
+	PendingRegistrations.Reset();
 }
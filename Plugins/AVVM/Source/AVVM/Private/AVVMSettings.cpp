@@ -28,3 +28,23 @@ FDataRegistryType UAVVMSettings::GetCheatRegistryType()
 {
 	return GetDefault<UAVVMSettings>()->CheatRegistryType;
 }
+
+int32 UAVVMSettings::GetMaxPendingNotificationsPerChannel()
+{
+	return GetDefault<UAVVMSettings>()->MaxPendingNotificationsPerChannel;
+}
+
+float UAVVMSettings::GetPendingNotificationTimeToLive()
+{
+	return GetDefault<UAVVMSettings>()->PendingNotificationTimeToLive;
+}
+
+int32 UAVVMSettings::GetMaxDeferredNotificationsPerFrame()
+{
+	return GetDefault<UAVVMSettings>()->MaxDeferredNotificationsPerFrame;
+}
+
+int32 UAVVMSettings::GetMaxPooledViewModelsPerClass()
+{
+	return GetDefault<UAVVMSettings>()->MaxPooledViewModelsPerClass;
+}
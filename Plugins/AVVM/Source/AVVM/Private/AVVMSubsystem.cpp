@@ -20,6 +20,8 @@
 #include "AVVMSubsystem.h"
 
 #include "AVVMModule.h"
+#include "AVVMPoolableViewModel.h"
+#include "AVVMSettings.h"
 #include "MVVMViewModelBase.h"
 #include "Archetypes/AVVMPresenter.h"
 #include "Engine/World.h"
@@ -40,6 +42,7 @@ void UAVVMSubsystem::Deinitialize()
 {
 	Super::Deinitialize();
 	ActorToViewModelCollection.Empty();
+	ViewModelPool = FAVVMViewModelPool();
 }
 
 UAVVMSubsystem* UAVVMSubsystem::Get(const UWorld* WorldContext)
@@ -75,6 +78,58 @@ UMVVMViewModelBase* UAVVMSubsystem::Static_RegisterPresenter(const FAVVMPresente
 	return nullptr;
 }
 
+void UAVVMSubsystem::Static_UnregisterPresenters(const UWorld* WorldContext,
+                                                 const TArray<UAVVMPresenter*>& Presenters)
+{
+	auto* AVVMSubsystem = UAVVMSubsystem::Get(WorldContext);
+	if (!IsValid(AVVMSubsystem))
+	{
+		return;
+	}
+
+	for (const UAVVMPresenter* Presenter : Presenters)
+	{
+		const TSubclassOf<UMVVMViewModelBase> ViewModelClass = IsValid(Presenter) ? Presenter->GetViewModelClass() : nullptr;
+		if (IsValid(ViewModelClass))
+		{
+			AVVMSubsystem->RemoveOrDestroy(ViewModelClass, Presenter->GetOuterKey());
+		}
+	}
+}
+
+void UAVVMSubsystem::Static_RegisterPresenters(const UWorld* WorldContext,
+                                               const TArray<UAVVMPresenter*>& Presenters,
+                                               TArray<UMVVMViewModelBase*>& OutViewModels)
+{
+	OutViewModels.Reset(Presenters.Num());
+
+	auto* AVVMSubsystem = UAVVMSubsystem::Get(WorldContext);
+	if (!IsValid(AVVMSubsystem))
+	{
+		OutViewModels.AddZeroed(Presenters.Num());
+		return;
+	}
+
+	AVVMSubsystem->ActorToViewModelCollection.Reserve(AVVMSubsystem->ActorToViewModelCollection.Num() + Presenters.Num());
+
+	for (const UAVVMPresenter* Presenter : Presenters)
+	{
+		const TSubclassOf<UMVVMViewModelBase> ViewModelClass = IsValid(Presenter) ? Presenter->GetViewModelClass() : nullptr;
+		OutViewModels.Add(IsValid(ViewModelClass) ? AVVMSubsystem->GetOrCreate(ViewModelClass, Presenter->GetOuterKey()) : nullptr);
+	}
+}
+
+void UAVVMSubsystem::Static_WarmUpViewModelPool(const UWorld* WorldContext,
+                                                const TSubclassOf<UMVVMViewModelBase> ViewModelClass,
+                                                const int32 Count)
+{
+	auto* AVVMSubsystem = UAVVMSubsystem::Get(WorldContext);
+	if (IsValid(AVVMSubsystem) && IsValid(ViewModelClass))
+	{
+		AVVMSubsystem->ViewModelPool.WarmUp(ViewModelClass, AVVMSubsystem, Count);
+	}
+}
+
 #if WITH_AUTOMATION_TESTS
 int32 UAVVMSubsystem::Static_GetPresentersCount(const UWorld* World)
 {
@@ -103,35 +158,130 @@ int32 UAVVMSubsystem::Static_GetActorCount(const UWorld* World)
 
 	return INDEX_NONE;
 }
+
+int32 UAVVMSubsystem::Static_GetPooledViewModelsCount(const UWorld* World)
+{
+	auto* AVVMSubsystem = UAVVMSubsystem::Get(World);
+	if (IsValid(AVVMSubsystem))
+	{
+		return AVVMSubsystem->ViewModelPool.Num();
+	}
+
+	return INDEX_NONE;
+}
 #endif
 
-UAVVMSubsystem::FAVVMViewModelKVP::~FAVVMViewModelKVP()
+UAVVMSubsystem::FAVVMViewModelPool::~FAVVMViewModelPool()
 {
-	ViewModelClassToViewModelInstance.Empty();
+	ViewModelClassToPooledViewModels.Empty();
 }
 
-UMVVMViewModelBase* UAVVMSubsystem::FAVVMViewModelKVP::GetOrCreate(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
-                                                                   UObject* Outer)
+TStrongObjectPtr<UMVVMViewModelBase> UAVVMSubsystem::FAVVMViewModelPool::Acquire(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
+                                                                                 UObject* Outer)
 {
-	if (!ViewModelClassToViewModelInstance.Contains(ViewModelClass))
+	TArray<TStrongObjectPtr<UMVVMViewModelBase>>* SearchResult = ViewModelClassToPooledViewModels.Find(ViewModelClass);
+	if ((SearchResult != nullptr) && !SearchResult->IsEmpty())
 	{
-		TStrongObjectPtr<UMVVMViewModelBase>& SearchResult = ViewModelClassToViewModelInstance.Add(ViewModelClass);
-		SearchResult = TStrongObjectPtr(NewObject<UMVVMViewModelBase>(Outer, ViewModelClass.Get()));
-		++RefCounter;
-		return SearchResult.Get();
+		TStrongObjectPtr<UMVVMViewModelBase> ViewModel = SearchResult->Pop(EAllowShrinking::No);
+		IAVVMPoolableViewModel::Execute_OnAcquiredFromPool(ViewModel.Get());
+		return ViewModel;
 	}
 	else
 	{
-		return ViewModelClassToViewModelInstance[ViewModelClass].Get();
+		return TStrongObjectPtr(NewObject<UMVVMViewModelBase>(Outer, ViewModelClass.Get()));
 	}
 }
 
-bool UAVVMSubsystem::FAVVMViewModelKVP::RemoveOrDestroy(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass)
+void UAVVMSubsystem::FAVVMViewModelPool::Release(TStrongObjectPtr<UMVVMViewModelBase>&& ViewModel)
 {
-	if (ViewModelClassToViewModelInstance.Contains(ViewModelClass))
+	// @gdemers Blueprint ViewModels implement the interface without a native vtable, we test the class instead of casting.
+	const bool bIsPoolable = ViewModel.IsValid() && ViewModel->GetClass()->ImplementsInterface(UAVVMPoolableViewModel::StaticClass());
+	if (!bIsPoolable)
+	{
+		ViewModel.Reset();
+		return;
+	}
+
+	TArray<TStrongObjectPtr<UMVVMViewModelBase>>& PooledViewModels = ViewModelClassToPooledViewModels.FindOrAdd(ViewModel->GetClass());
+	if (PooledViewModels.Num() >= UAVVMSettings::GetMaxPooledViewModelsPerClass())
+	{
+		ViewModel.Reset();
+		return;
+	}
+
+	IAVVMPoolableViewModel::Execute_ResetViewModel(ViewModel.Get());
+	PooledViewModels.Add(MoveTemp(ViewModel));
+}
+
+void UAVVMSubsystem::FAVVMViewModelPool::WarmUp(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
+                                                UObject* Outer,
+                                                const int32 Count)
+{
+	if (!ensureAlwaysMsgf(ViewModelClass->ImplementsInterface(UAVVMPoolableViewModel::StaticClass()),
+	                      TEXT("ViewModel class %s doesn't implement IAVVMPoolableViewModel, and cannot be pooled."),
+	                      *GetNameSafe(ViewModelClass.Get())))
+	{
+		return;
+	}
+
+	TArray<TStrongObjectPtr<UMVVMViewModelBase>>& PooledViewModels = ViewModelClassToPooledViewModels.FindOrAdd(ViewModelClass);
+
+	const int32 NumPooledViewModels = FMath::Min(Count, UAVVMSettings::GetMaxPooledViewModelsPerClass());
+	PooledViewModels.Reserve(NumPooledViewModels);
+
+	while (PooledViewModels.Num() < NumPooledViewModels)
+	{
+		PooledViewModels.Add(TStrongObjectPtr(NewObject<UMVVMViewModelBase>(Outer, ViewModelClass.Get())));
+	}
+}
+
+#if WITH_AUTOMATION_TESTS
+int32 UAVVMSubsystem::FAVVMViewModelPool::Num() const
+{
+	int32 Count = 0;
+	for (const auto& [ViewModelClass, PooledViewModels] : ViewModelClassToPooledViewModels)
+	{
+		Count += PooledViewModels.Num();
+	}
+
+	return Count;
+}
+#endif
+
+UAVVMSubsystem::FAVVMViewModelKVP::~FAVVMViewModelKVP()
+{
+	ViewModelClassToViewModelInstance.Empty();
+}
+
+UMVVMViewModelBase* UAVVMSubsystem::FAVVMViewModelKVP::GetOrCreate(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
+                                                                   UObject* Outer,
+                                                                   FAVVMViewModelPool& Pool)
+{
+	FAVVMViewModelInstance& SearchResult = ViewModelClassToViewModelInstance.FindOrAdd(ViewModelClass);
+	if (!SearchResult.ViewModel.IsValid())
+	{
+		SearchResult.ViewModel = Pool.Acquire(ViewModelClass, Outer);
+	}
+
+	++SearchResult.RefCounter;
+	++RefCounter;
+	return SearchResult.ViewModel.Get();
+}
+
+bool UAVVMSubsystem::FAVVMViewModelKVP::RemoveOrDestroy(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
+                                                        FAVVMViewModelPool& Pool)
+{
+	FAVVMViewModelInstance* SearchResult = ViewModelClassToViewModelInstance.Find(ViewModelClass);
+	if (SearchResult != nullptr)
 	{
-		ViewModelClassToViewModelInstance.Remove(ViewModelClass);
 		--RefCounter;
+
+		// @gdemers the ViewModel instance is shared by all presenters of this Actor. only release it once the last one unregister.
+		if (--SearchResult->RefCounter == 0)
+		{
+			Pool.Release(MoveTemp(SearchResult->ViewModel));
+			ViewModelClassToViewModelInstance.Remove(ViewModelClass);
+		}
 	}
 
 	return (false == !!RefCounter);
@@ -140,7 +290,7 @@ bool UAVVMSubsystem::FAVVMViewModelKVP::RemoveOrDestroy(const TSubclassOf<UMVVMV
 #if WITH_AUTOMATION_TESTS
 int32 UAVVMSubsystem::FAVVMViewModelKVP::GetPresenterCount() const
 {
-	return ViewModelClassToViewModelInstance.Num();
+	return static_cast<int32>(RefCounter);
 }
 #endif
 
@@ -149,15 +299,20 @@ UMVVMViewModelBase* UAVVMSubsystem::GetOrCreate(const TSubclassOf<UMVVMViewModel
 {
 	const TWeakObjectPtr<AActor> WeakObjectPtr = MakeWeakObjectPtr<AActor>(Outer);
 	FAVVMViewModelKVP& SearchResult = ActorToViewModelCollection.FindOrAdd(WeakObjectPtr);
-	return SearchResult.GetOrCreate(ViewModelClass, this);
+	return SearchResult.GetOrCreate(ViewModelClass, this, ViewModelPool);
 }
 
 bool UAVVMSubsystem::RemoveOrDestroy(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
                                      AActor* Outer)
 {
 	const TWeakObjectPtr<AActor> WeakObjectPtr = MakeWeakObjectPtr<AActor>(Outer);
-	FAVVMViewModelKVP& SearchResult = ActorToViewModelCollection.FindOrAdd(WeakObjectPtr);
-	const bool bIsEmpty = SearchResult.RemoveOrDestroy(ViewModelClass);
+	FAVVMViewModelKVP* SearchResult = ActorToViewModelCollection.Find(WeakObjectPtr);
+	if (SearchResult == nullptr)
+	{
+		return false;
+	}
+
+	const bool bIsEmpty = SearchResult->RemoveOrDestroy(ViewModelClass, ViewModelPool);
 	if (bIsEmpty)
 	{
 		ActorToViewModelCollection.Remove(WeakObjectPtr);
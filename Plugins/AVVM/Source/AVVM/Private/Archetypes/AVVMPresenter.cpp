@@ -69,6 +69,9 @@ void UAVVMPresenter::SafeEndPlay()
 		ContextArgs.WorldContext = UAVVMPresenter::GetWorld();
 		ContextArgs.Presenter = this;
 		UAVVMSubsystem::Static_UnregisterPresenter(ContextArgs);
+
+		// @gdemers the ViewModel may be recycled, and bound to a different Actor. we shouldn't keep access to it.
+		ViewModel.Reset();
 	}
 
 	{
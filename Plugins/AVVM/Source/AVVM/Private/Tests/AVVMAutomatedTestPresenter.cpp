@@ -21,6 +21,16 @@
 
 #include "AVVMAutomatedTestActor.h"
 
+void UAVVMAutomatedTestViewModel::ResetViewModel_Implementation()
+{
+	++NumResets;
+}
+
+void UAVVMAutomatedTestViewModel::OnAcquiredFromPool_Implementation()
+{
+	++NumAcquisitions;
+}
+
 TSubclassOf<UMVVMViewModelBase> UAVVMAutomatedTestPresenter::GetViewModelClass() const
 {
 	return UAVVMAutomatedTestViewModel::StaticClass();
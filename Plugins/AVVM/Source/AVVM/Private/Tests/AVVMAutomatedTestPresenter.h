@@ -22,6 +22,7 @@
 #include "CoreMinimal.h"
 #include "MVVMViewModelBase.h"
 
+#include "AVVMPoolableViewModel.h"
 #include "Archetypes/AVVMPresenter.h"
 
 #include "AVVMAutomatedTestPresenter.generated.h"
@@ -32,9 +33,17 @@
  *	UAVVMAutomatedTestViewModel is a view model class for automated testing.
  */
 UCLASS()
-class AVVM_API UAVVMAutomatedTestViewModel : public UMVVMViewModelBase
+class AVVM_API UAVVMAutomatedTestViewModel : public UMVVMViewModelBase,
+                                             public IAVVMPoolableViewModel
 {
 	GENERATED_BODY()
+
+public:
+	virtual void ResetViewModel_Implementation() override;
+	virtual void OnAcquiredFromPool_Implementation() override;
+
+	int32 NumResets = 0;
+	int32 NumAcquisitions = 0;
 };
 
 /**
@@ -22,8 +22,10 @@
 #include "AVVMAutomatedTestActor.h"
 #include "AVVMAutomatedTestPresenter.h"
 #include "AVVMNotificationSubsystem.h"
+#include "AVVMSettings.h"
 #include "AVVMSubsystem.h"
 #include "NativeGameplayTags.h"
+#include "Async/ParallelFor.h"
 #include "Archetypes/AVVMPresenter.h"
 
 #if WITH_AUTOMATION_TESTS
@@ -32,6 +34,44 @@
 
 // @gdemers WARNING : Careful about Server-Client mismatch. Server grants tags so this module has to be available there.
 UE_DEFINE_GAMEPLAY_TAG(TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG, "FunctionalTest.NotificationSubsystem.TestChannel");
+UE_DEFINE_GAMEPLAY_TAG(TAG_FUNCTIONAL_TEST_AVVM_DEFERRED_CHANNELTAG, "FunctionalTest.NotificationSubsystem.DeferredChannel");
+
+#if WITH_AUTOMATION_TESTS
+/**
+ *	Class description:
+ *
+ *	FAVVMScopedNotificationSettings override the deferred notifications settings for the duration of a test, and restore them after.
+ */
+class FAVVMScopedNotificationSettings
+{
+public:
+	FAVVMScopedNotificationSettings(const int32 NewMaxPendingNotificationsPerChannel,
+	                                const float NewPendingNotificationTimeToLive,
+	                                const int32 NewMaxDeferredNotificationsPerFrame)
+	{
+		auto* Settings = GetMutableDefault<UAVVMSettings>();
+		PrevMaxPendingNotificationsPerChannel = Settings->MaxPendingNotificationsPerChannel;
+		PrevPendingNotificationTimeToLive = Settings->PendingNotificationTimeToLive;
+		PrevMaxDeferredNotificationsPerFrame = Settings->MaxDeferredNotificationsPerFrame;
+		Settings->MaxPendingNotificationsPerChannel = NewMaxPendingNotificationsPerChannel;
+		Settings->PendingNotificationTimeToLive = NewPendingNotificationTimeToLive;
+		Settings->MaxDeferredNotificationsPerFrame = NewMaxDeferredNotificationsPerFrame;
+	}
+
+	~FAVVMScopedNotificationSettings()
+	{
+		auto* Settings = GetMutableDefault<UAVVMSettings>();
+		Settings->MaxPendingNotificationsPerChannel = PrevMaxPendingNotificationsPerChannel;
+		Settings->PendingNotificationTimeToLive = PrevPendingNotificationTimeToLive;
+		Settings->MaxDeferredNotificationsPerFrame = PrevMaxDeferredNotificationsPerFrame;
+	}
+
+private:
+	int32 PrevMaxPendingNotificationsPerChannel = 0;
+	float PrevPendingNotificationTimeToLive = 0.f;
+	int32 PrevMaxDeferredNotificationsPerFrame = 0;
+};
+#endif
 
 /**
  *	Class description:
@@ -94,6 +134,61 @@ bool AVVMNotificationSubsystemTest::RunTest(const FString& Parameters)
 	// @gdemers test broadcast.
 	UTEST_EQUAL("FScopedCounterNotify Count {Post-targeted notify}.", ScopedInstance.GetCount(), TestActors.Num() - 1)
 
+	// @gdemers test native fast path. a native callback replace the dynamic one, and dispatch goes through a precompiled channel handle.
+	UAVVMNotificationSubsystem::Static_RegisterNativeObserver(TestActors[0],
+	                                                          TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG,
+	                                                          FAVVMOnChannelNotifiedNativeDelegate::CreateUObject(TestActors[0], &AAVVMAutomatedTestActor::OnInvokeCallback));
+
+	UTEST_EQUAL("TMap<const FGameplayTag, FAVVMObservers>::ValueType Collection Changed {Post-Native-Registration}.", UAVVMNotificationSubsystem::Static_GetChannelCount(World, TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG), 2)
+
+	const FAVVMNotificationChannelHandle ChannelHandle = UAVVMNotificationSubsystem::Static_GetChannelHandle(World, TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG);
+	UTEST_TRUE("FAVVMNotificationChannelHandle is valid.", ChannelHandle.IsValid())
+
+	ScopedInstance.Reset();
+	UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(World, ChannelHandle, nullptr, FAVVMNotificationPayload::Empty);
+
+	// @gdemers test native broadcast.
+	UTEST_EQUAL("FScopedCounterNotify Count {Post-native notify}.", ScopedInstance.GetCount(), 0)
+
+	// @gdemers test child channels subscription. an observer of the parent channel receive notifications of all its child channels.
+	int32 NumParentChannelNotified = 0;
+	const FGameplayTag ParentChannelTag = TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG.GetTag().RequestDirectParent();
+	UAVVMNotificationSubsystem::Static_RegisterNativeObserver(TestActors[0],
+	                                                          ParentChannelTag,
+	                                                          FAVVMOnChannelNotifiedNativeDelegate::CreateLambda([&NumParentChannelNotified](const TInstancedStruct<FAVVMNotificationPayload>&)
+	                                                          {
+		                                                          ++NumParentChannelNotified;
+	                                                          }),
+	                                                          true);
+
+	ScopedInstance.Reset();
+	UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(World, TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG, nullptr, FAVVMNotificationPayload::Empty);
+
+	UTEST_EQUAL("FScopedCounterNotify Count {Post-child channel notify}.", ScopedInstance.GetCount(), 0)
+	UTEST_EQUAL("Parent Channel Notified {Post-child channel notify}.", NumParentChannelNotified, 1)
+
+	// @gdemers test cross-thread posting. notifications posted from workers are only broadcast once the subsystem tick.
+	constexpr int32 NumPostedNotifications = 8;
+	NumParentChannelNotified = 0;
+	const FAVVMNotificationPostHandle PostHandle = UAVVMNotificationSubsystem::Static_GetPostHandle(World);
+	UTEST_TRUE("FAVVMNotificationPostHandle is valid.", PostHandle.IsValid())
+
+	ParallelFor(NumPostedNotifications, [&PostHandle](int32)
+	{
+		UAVVMNotificationSubsystem::Static_PostNotification(PostHandle, TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG, nullptr, TInstancedStruct<FAVVMNotificationPayload>());
+	});
+
+	UTEST_EQUAL("Parent Channel Notified {Pre-drain posted notify}.", NumParentChannelNotified, 0)
+
+	auto* AVVMNotificationSubsystem = UWorld::GetSubsystem<UAVVMNotificationSubsystem>(World);
+	UTEST_NOT_NULL("UAVVMNotificationSubsystem.", AVVMNotificationSubsystem)
+	AVVMNotificationSubsystem->Tick(0.f);
+
+	UTEST_EQUAL("Parent Channel Notified {Post-drain posted notify}.", NumParentChannelNotified, NumPostedNotifications)
+
+	UAVVMNotificationSubsystem::Static_UnregisterNativeObserver(TestActors[0], ParentChannelTag);
+	UTEST_EQUAL("Parent Channel Count {Post-Unregistration}.", UAVVMNotificationSubsystem::Static_GetChannelCount(World, ParentChannelTag), INDEX_NONE)
+
 	for (auto* TestActor : TestActors)
 	{
 		FAVVMObserverContextArgs ObserverContextArgs;
@@ -106,6 +201,123 @@ bool AVVMNotificationSubsystemTest::RunTest(const FString& Parameters)
 	UTEST_EQUAL("TMap<const FGameplayTag, FAVVMObservers> Collection Changed {Post-Unregistration}.", UAVVMNotificationSubsystem::Static_GetChannelsCount(World), 0)
 	UTEST_EQUAL("TMap<const FGameplayTag, FAVVMObservers>::ValueType Collection Changed {Post-Unregistration}.", UAVVMNotificationSubsystem::Static_GetChannelCount(World, TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG), INDEX_NONE)
 
+	// @gdemers test deferred notifications. without observers, notifications are deferred, and empty payloads are coalesced.
+	const int32 NumPendingNotifications = UAVVMNotificationSubsystem::Static_GetPendingNotificationsCount(World);
+	for (int32 i = 0; i < 3; ++i)
+	{
+		UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(World, TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG, nullptr, FAVVMNotificationPayload::Empty);
+	}
+
+	UTEST_EQUAL("Pending Notifications Count {Post-coalesced notify}.", UAVVMNotificationSubsystem::Static_GetPendingNotificationsCount(World), NumPendingNotifications + 1)
+
+	// @gdemers test the channel limit with notifications that never expire. non-empty payloads aren't coalesced, so each one is
+	// queued, and the oldest is evicted once the limit is reached. the queue must not grow past the limit.
+	{
+		constexpr int32 MaxPendingNotificationsPerChannel = 4;
+		FAVVMScopedNotificationSettings ScopedSettings(MaxPendingNotificationsPerChannel, 0.f/*never expire*/, 0/*unbounded*/);
+
+		const FGameplayTag CappedChannelTag = TAG_FUNCTIONAL_TEST_AVVM_CHANNELTAG.GetTag().RequestDirectParent();
+		const int32 NumQueuedNotifications = UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World);
+		for (int32 i = 0; i < (MaxPendingNotificationsPerChannel * 8); ++i)
+		{
+			UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(World, CappedChannelTag, nullptr, TInstancedStruct<FAVVMNotificationPayload>::Make());
+		}
+
+		UTEST_EQUAL("Pending Notifications Queue Size {Post-capped notify}.",
+		            UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World),
+		            NumQueuedNotifications + MaxPendingNotificationsPerChannel)
+		UTEST_EQUAL("Pending Notifications Count {Post-capped notify}.",
+		            UAVVMNotificationSubsystem::Static_GetPendingNotificationsCount(World),
+		            NumPendingNotifications + 1 + MaxPendingNotificationsPerChannel)
+	}
+
+	// @gdemers observer of the deferred channel only. notifications queued on other channels are left in the queue.
+	int32 NumDeferredChannelNotified = 0;
+	auto* DeferredObserver = World->SpawnActor<AAVVMAutomatedTestActor>();
+	UTEST_NOT_NULL("AAVVMAutomatedTestActor.", DeferredObserver)
+
+	const auto RegisterDeferredObserver = [&NumDeferredChannelNotified, DeferredObserver]()
+	{
+		UAVVMNotificationSubsystem::Static_RegisterNativeObserver(DeferredObserver,
+		                                                          TAG_FUNCTIONAL_TEST_AVVM_DEFERRED_CHANNELTAG,
+		                                                          FAVVMOnChannelNotifiedNativeDelegate::CreateLambda([&NumDeferredChannelNotified](const TInstancedStruct<FAVVMNotificationPayload>&)
+		                                                          {
+			                                                          ++NumDeferredChannelNotified;
+		                                                          }));
+	};
+
+	// @gdemers test the time to live. notifications outliving it are dropped on flush, rather than broadcast to late observers.
+	{
+		constexpr int32 NumDeferredNotifications = 4;
+		constexpr float PendingNotificationTimeToLive = 0.01f;
+		FAVVMScopedNotificationSettings ScopedSettings(NumDeferredNotifications, PendingNotificationTimeToLive, 0/*unbounded*/);
+
+		const int32 NumQueuedNotifications = UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World);
+		for (int32 i = 0; i < NumDeferredNotifications; ++i)
+		{
+			UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(World, TAG_FUNCTIONAL_TEST_AVVM_DEFERRED_CHANNELTAG, nullptr, TInstancedStruct<FAVVMNotificationPayload>::Make());
+		}
+
+		UTEST_EQUAL("Pending Notifications Queue Size {Pre-expired flush}.",
+		            UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World),
+		            NumQueuedNotifications + NumDeferredNotifications)
+
+		// @gdemers expiration is measured against platform time. sleep well past the time to live.
+		FPlatformProcess::Sleep(PendingNotificationTimeToLive * 10.f);
+
+		RegisterDeferredObserver();
+		UAVVMNotificationSubsystem::Static_ExecuteDeferredNotifications(World);
+
+		UTEST_EQUAL("Deferred Channel Notified {Post-expired flush}.", NumDeferredChannelNotified, 0)
+		UTEST_EQUAL("Pending Notifications Queue Size {Post-expired flush}.",
+		            UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World),
+		            NumQueuedNotifications)
+
+		UAVVMNotificationSubsystem::Static_UnregisterNativeObserver(DeferredObserver, TAG_FUNCTIONAL_TEST_AVVM_DEFERRED_CHANNELTAG);
+	}
+
+	// @gdemers test the per-frame budget. a flush broadcast up to the budget, and the remaining notifications are broadcast over
+	// the next frames.
+	{
+		constexpr int32 NumDeferredNotifications = 5;
+		constexpr int32 MaxDeferredNotificationsPerFrame = 2;
+		FAVVMScopedNotificationSettings ScopedSettings(NumDeferredNotifications, 0.f/*never expire*/, MaxDeferredNotificationsPerFrame);
+
+		const int32 NumQueuedNotifications = UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World);
+		for (int32 i = 0; i < NumDeferredNotifications; ++i)
+		{
+			UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(World, TAG_FUNCTIONAL_TEST_AVVM_DEFERRED_CHANNELTAG, nullptr, TInstancedStruct<FAVVMNotificationPayload>::Make());
+		}
+
+		NumDeferredChannelNotified = 0;
+		RegisterDeferredObserver();
+		UAVVMNotificationSubsystem::Static_ExecuteDeferredNotifications(World);
+
+		UTEST_EQUAL("Deferred Channel Notified {Post-budgeted flush}.", NumDeferredChannelNotified, MaxDeferredNotificationsPerFrame)
+		UTEST_EQUAL("Pending Notifications Queue Size {Post-budgeted flush}.",
+		            UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World),
+		            NumQueuedNotifications + NumDeferredNotifications - MaxDeferredNotificationsPerFrame)
+
+		// @gdemers a flush requested within the same frame is absorbed by the one scheduled for next frame.
+		UAVVMNotificationSubsystem::Static_ExecuteDeferredNotifications(World);
+		UTEST_EQUAL("Deferred Channel Notified {Post-same frame flush}.", NumDeferredChannelNotified, MaxDeferredNotificationsPerFrame)
+
+		// @gdemers the engine loop isn't running. we advance the frame counter ourselves, so both the timer manager and the
+		// per-frame budget see a new frame.
+		for (int32 i = 0; i < 2; ++i)
+		{
+			++GFrameCounter;
+			WorldWrapper.TickTestWorld(1.f / 30.f);
+		}
+
+		UTEST_EQUAL("Deferred Channel Notified {Post-resumed flush}.", NumDeferredChannelNotified, NumDeferredNotifications)
+		UTEST_EQUAL("Pending Notifications Queue Size {Post-resumed flush}.",
+		            UAVVMNotificationSubsystem::Static_GetPendingNotificationsQueueSize(World),
+		            NumQueuedNotifications)
+
+		UAVVMNotificationSubsystem::Static_UnregisterNativeObserver(DeferredObserver, TAG_FUNCTIONAL_TEST_AVVM_DEFERRED_CHANNELTAG);
+	}
+
 	World->DestroyWorld(true);
 #endif
 	return true;
@@ -154,6 +366,32 @@ bool AVVMSubsystemTest::RunTest(const FString& Parameters)
 	// @gdemers test unregister.
 	UTEST_EQUAL("TMap<TWeakObjectPtr<const AActor>, FAVVMViewModelKVP> Collection Changed {Post-Unregistration}.", UAVVMSubsystem::Static_GetActorCount(World), 0)
 	UTEST_EQUAL("TMap<TWeakObjectPtr<const AActor>, FAVVMViewModelKVP>::ValueType Collection Changed {Post-Unregistration}.", UAVVMSubsystem::Static_GetPresentersCount(World), 0)
+	UTEST_EQUAL("FAVVMViewModelPool Collection Changed {Post-Unregistration}.", UAVVMSubsystem::Static_GetPooledViewModelsCount(World), 2)
+
+	// @gdemers test batch register. released ViewModels are recycled instead of being created again.
+	TArray<UAVVMPresenter*> Presenters;
+	for (auto* TestActor : TestActors)
+	{
+		Presenters.Add(UAVVMAutomatedTestUtils::GetSetPresenter(UAVVMAutomatedTestPresenter::StaticClass(), TestActor));
+	}
+
+	TArray<UMVVMViewModelBase*> ViewModels;
+	UAVVMSubsystem::Static_RegisterPresenters(World, Presenters, ViewModels);
+
+	UTEST_EQUAL("ViewModels Count {Post-Batch-Registration}.", ViewModels.Num(), Presenters.Num())
+	UTEST_EQUAL("FAVVMViewModelPool Collection Changed {Post-Batch-Registration}.", UAVVMSubsystem::Static_GetPooledViewModelsCount(World), 0)
+	UTEST_EQUAL("TMap<TWeakObjectPtr<const AActor>, FAVVMViewModelKVP>::ValueType Collection Changed {Post-Batch-Registration}.", UAVVMSubsystem::Static_GetPresentersCount(World), 2)
+
+	for (const UMVVMViewModelBase* ViewModel : ViewModels)
+	{
+		const auto* TestViewModel = Cast<UAVVMAutomatedTestViewModel>(ViewModel);
+		UTEST_NOT_NULL("Recycled UAVVMAutomatedTestViewModel.", TestViewModel)
+		UTEST_EQUAL("Recycled UAVVMAutomatedTestViewModel Reset Count.", TestViewModel->NumResets, 1)
+		UTEST_EQUAL("Recycled UAVVMAutomatedTestViewModel Acquisition Count.", TestViewModel->NumAcquisitions, 1)
+	}
+
+	UAVVMSubsystem::Static_UnregisterPresenters(World, Presenters);
+	UTEST_EQUAL("TMap<TWeakObjectPtr<const AActor>, FAVVMViewModelKVP> Collection Changed {Post-Batch-Unregistration}.", UAVVMSubsystem::Static_GetActorCount(World), 0)
 
 	World->DestroyWorld(true);
 #endif
@@ -21,6 +21,7 @@
 
 #include "CoreMinimal.h"
 
+#include "Containers/RingBuffer.h"
 #include "GameplayTagContainer.h"
 #include "StructUtils/InstancedStruct.h"
 #include "Subsystems/WorldSubsystem.h"
@@ -35,6 +36,35 @@ struct FAVVMNotificationPayload;
 
 DECLARE_DYNAMIC_MULTICAST_DELEGATE_OneParam(FAVVMOnChannelNotifiedMulticastDelegate, const TInstancedStruct<FAVVMNotificationPayload>&, Payload);
 DECLARE_DYNAMIC_DELEGATE_OneParam(FAVVMOnChannelNotifiedSingleCastDelegate, const TInstancedStruct<FAVVMNotificationPayload>&, Payload);
+DECLARE_DELEGATE_OneParam(FAVVMOnChannelNotifiedNativeDelegate, const TInstancedStruct<FAVVMNotificationPayload>&);
+
+/**
+ *	Class description:
+ *
+ *	FAVVMNotificationChannelHandle is a precompiled channel index, resolved once from a channel tag, that skip the tag lookup
+ *	when broadcasting. Handles are stable for the lifetime of the UAVVMNotificationSubsystem (i.e - the World) that issued them.
+ */
+struct AVVM_API FAVVMNotificationChannelHandle
+{
+	bool IsValid() const { return (ChannelIndex != INDEX_NONE); }
+
+	int32 ChannelIndex = INDEX_NONE;
+};
+
+struct FAVVMPostedNotificationQueue;
+
+/**
+ *	Class description:
+ *
+ *	FAVVMNotificationPostHandle is a thread-safe reference to the posted notifications queue of a UAVVMNotificationSubsystem. It's
+ *	resolved on the game thread, and may then be copied to any thread. Posting through a handle whose world was torn down is a no-op.
+ */
+struct AVVM_API FAVVMNotificationPostHandle
+{
+	bool IsValid() const { return Queue.IsValid(); }
+
+	TSharedPtr<FAVVMPostedNotificationQueue, ESPMode::ThreadSafe> Queue;
+};
 
 /**
  *	Class description:
@@ -51,6 +81,11 @@ struct AVVM_API FAVVMObserverContextArgs
 
 	UPROPERTY(Transient, BlueprintReadWrite)
 	FAVVMOnChannelNotifiedSingleCastDelegate Callback;
+
+	// @gdemers when true, the observer is also notified of all child channels (i.e - subscribing to Inventory.Channel
+	// receive Inventory.Channel.Presenter.Drop, Inventory.Channel.Presenter.Pickup, ...).
+	UPROPERTY(Transient, BlueprintReadWrite)
+	bool bIncludeChildChannels = false;
 };
 
 /**
@@ -86,6 +121,10 @@ struct AVVM_API FAVVMNotificationPayload
 
 	virtual ~FAVVMNotificationPayload() = default;
 
+	// @gdemers when true, a deferred notification of this payload type is replaced by the most recent one for the same channel,
+	// and target (i.e - last value wins). only override for payloads that carry a state, not an event.
+	virtual bool CanCoalesce() const { return false; }
+
 	// @gdemers wrapper function template to avoid writing TInstancedStruct<FAVVMNotificationPayload>::Make<T>
 	template <typename TChild, typename... TArgs>
 	static TInstancedStruct<FAVVMNotificationPayload> Make(TArgs&&... Args);
@@ -113,14 +152,21 @@ template<> struct TBaseStructure<FAVVMNotificationPayload>
  *	Here's an example of the expected tag format :
  *
  *		* ModuleName.ChannelName.PresenterClass.GameplayEventType
+ *
+ *	Observers may also subscribe to a parent tag (i.e - ModuleName.ChannelName) to be notified of all its child channels.
+ *
+ *	Notifications may be posted from any thread. Those are queued, and broadcast on the game thread when the subsystem tick.
  */
 UCLASS()
-class AVVM_API UAVVMNotificationSubsystem : public UWorldSubsystem
+class AVVM_API UAVVMNotificationSubsystem : public UTickableWorldSubsystem
 {
 	GENERATED_BODY()
 
 public:
 	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
 
 	UFUNCTION(BlueprintCallable, Category="AVVM|Events", meta=(HideSelfPin, DefaultToSelf="WorldContextObject"))
 	static void Static_UnregisterObserver(const UObject* WorldContextObject,
@@ -137,41 +183,185 @@ public:
 	UFUNCTION(BlueprintCallable, Category="AVVM|Events", meta=(HideSelfPin, DefaultToSelf="WorldContextObject"))
 	static void Static_ExecuteDeferredNotifications(const UObject* WorldContextObject);
 
+	// @gdemers native fast path. callbacks are invoked without going through reflection, and payloads aren't copied.
+	static void Static_UnregisterNativeObserver(const UObject* WorldContextObject,
+	                                            const FGameplayTag& ChannelTag);
+
+	static void Static_RegisterNativeObserver(const UObject* WorldContextObject,
+	                                          const FGameplayTag& ChannelTag,
+	                                          FAVVMOnChannelNotifiedNativeDelegate&& Callback,
+	                                          const bool bIncludeChildChannels = false);
+
+	static FAVVMNotificationChannelHandle Static_GetChannelHandle(const UObject* WorldContextObject,
+	                                                              const FGameplayTag& ChannelTag);
+
+	static void Static_BroadcastNativeChannel(const UObject* WorldContextObject,
+	                                          const FGameplayTag& ChannelTag,
+	                                          const AActor* Target,
+	                                          const TInstancedStruct<FAVVMNotificationPayload>& Payload);
+
+	static void Static_BroadcastNativeChannel(const UObject* WorldContextObject,
+	                                          const FAVVMNotificationChannelHandle& ChannelHandle,
+	                                          const AActor* Target,
+	                                          const TInstancedStruct<FAVVMNotificationPayload>& Payload);
+
+	// @gdemers game thread only. resolve the handle used to post notifications from other threads.
+	static FAVVMNotificationPostHandle Static_GetPostHandle(const UObject* WorldContextObject);
+
+	// @gdemers thread-safe. the notification is broadcast on the game thread, during the next subsystem tick.
+	static void Static_PostNotification(const FAVVMNotificationPostHandle& PostHandle,
+	                                    const FGameplayTag& ChannelTag,
+	                                    const AActor* Target,
+	                                    TInstancedStruct<FAVVMNotificationPayload>&& Payload);
+
+	static void Static_PostNotification(const FAVVMNotificationPostHandle& PostHandle,
+	                                    const FAVVMNotificationChannelHandle& ChannelHandle,
+	                                    const AActor* Target,
+	                                    TInstancedStruct<FAVVMNotificationPayload>&& Payload);
+
 #if WITH_AUTOMATION_TESTS
 	static int32 Static_GetChannelCount(const UObject* WorldContextObject,
 	                                    const FGameplayTag& ChannelTag);
 
 	static int32 Static_GetChannelsCount(const UObject* WorldContextObject);
+
+	static int32 Static_GetPendingNotificationsCount(const UObject* WorldContextObject);
+
+	// @gdemers number of entries held by the deferred queue, expired entries included.
+	static int32 Static_GetPendingNotificationsQueueSize(const UObject* WorldContextObject);
 #endif
 
 protected:
 	static UAVVMNotificationSubsystem* Get(const UObject* WorldContextObject);
-	
+	static const AActor* GetOwningActor(const UObject* WorldContextObject);
+
+	void ExecuteDeferredNotifications();
+	void ExecutePostedNotifications();
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMObserverCallback hold either a native, or a dynamic (i.e - Blueprint) callback. Native callbacks are preferred when bound.
+	 */
+	struct FAVVMObserverCallback
+	{
+		void Execute(const TInstancedStruct<FAVVMNotificationPayload>& Payload) const;
+
+		FAVVMOnChannelNotifiedNativeDelegate NativeCallback;
+		FAVVMOnChannelNotifiedSingleCastDelegate Callback;
+	};
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMObservers is the set of observers of a single channel, stored as flat parallel arrays (i.e - index i of Targets, and Callbacks
+	 *	refer to the same observer). Channels hold few observers, a linear scan over contiguous targets outperform hashing.
+	 */
 	struct FAVVMObservers
 	{
 		~FAVVMObservers();
-		void Unregister(const AActor* Target);
-		void Register(const AActor* Target, const FAVVMOnChannelNotifiedSingleCastDelegate& Callback);
-		void BroadcastAll(const TInstancedStruct<FAVVMNotificationPayload>& Payload) const;
-		void Broadcast(const AActor* Target, const TInstancedStruct<FAVVMNotificationPayload>& Payload) const;
+		int32 Find(const AActor* Target) const;
+		void Unregister(const AActor* Target, const bool bIsBroadcasting);
+		void Register(const AActor* Target, FAVVMObserverCallback&& Callback);
+		void Compact();
+		bool IsEmpty() const;
+		int32 Num() const;
+
+		TArray<TWeakObjectPtr<const AActor>> Targets;
+		TArray<FAVVMObserverCallback> Callbacks;
+		int32 NumPendingRemovals = 0;
+	};
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMChannel is a single channel tag, its observers, and the precomputed chain of its parent channels. Observers that
+	 *	include child channels are kept apart, so a broadcast only visit those of parent channels, and fan-out stays proportional
+	 *	to the number of matching observers.
+	 */
+	struct FAVVMChannel
+	{
+		FAVVMObservers& GetObservers(const bool bIncludeChildChannels);
+		const FAVVMObservers& GetObservers(const bool bIncludeChildChannels) const;
 		bool IsEmpty() const;
+		int32 Num() const;
+
+		FGameplayTag ChannelTag = FGameplayTag::EmptyTag;
+		FAVVMObservers Observers;
+		FAVVMObservers SubtreeObservers;
+		int32 NumPendingNotifications = 0;
+		// @gdemers ordered from direct parent to root. parent channels are created before their children, so this chain is
+		// complete once built, and never has to be patched.
+		TArray<int32> ParentChannelIndices;
+	};
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMPendingNotification is a notification deferred until its channel gain observers.
+	 */
+	struct FAVVMPendingNotification
+	{
+		bool IsExpired(const double CurrentTime) const;
 
-		TMap<TWeakObjectPtr<const AActor>, FAVVMOnChannelNotifiedSingleCastDelegate> Observers;
+		int32 ChannelIndex = INDEX_NONE;
+		TWeakObjectPtr<const AActor> Target = nullptr;
+		TInstancedStruct<FAVVMNotificationPayload> Payload;
+		double ExpirationTime = 0.0;
+		bool bHasTarget = false;
+	};
+
+	struct FAVVMPendingObserver
+	{
+		int32 ChannelIndex = INDEX_NONE;
+		TWeakObjectPtr<const AActor> Target = nullptr;
+		FAVVMObserverCallback Callback;
+		bool bIncludeChildChannels = false;
 	};
 
 	struct FAVVObserversFilteringMechanism
 	{
 		~FAVVObserversFilteringMechanism();
 		void Unregister(const AActor* Target, const FGameplayTag& ChannelTag);
-		void Register(const AActor* Target, const FGameplayTag& ChannelTag, const FAVVMOnChannelNotifiedSingleCastDelegate& Callback);
+		void Register(const AActor* Target, const FGameplayTag& ChannelTag, FAVVMObserverCallback&& Callback, const bool bIncludeChildChannels);
 		void Broadcast(const FAVVMNotificationContextArgs& NotificationContext);
-		void ExecuteDeferredNotifications();
-
-		TMap<const FGameplayTag, FAVVMObservers> TagToObservers;
-		TArray<FAVVMNotificationContextArgs> PendingRequests;
+		void Broadcast(const int32 ChannelIndex, const AActor* Target, const TInstancedStruct<FAVVMNotificationPayload>& Payload);
+		void Defer(const int32 ChannelIndex, const AActor* Target, const TInstancedStruct<FAVVMNotificationPayload>& Payload);
+		bool ExecuteDeferredNotifications(const int32 Budget, int32& OutNumFlushed);
+		void EvictOldestPendingNotification(const int32 ChannelIndex);
+		void PopPendingNotification();
+		int32 FindChannelIndex(const FGameplayTag& ChannelTag) const;
+		int32 FindOrAddChannelIndex(const FGameplayTag& ChannelTag);
+		int32 GetNumActiveChannels() const;
+		bool HasObservers(const int32 ChannelIndex) const;
+		int32 Dispatch(const int32 ChannelIndex, const bool bIncludeChildChannels, const AActor* Target, const TInstancedStruct<FAVVMNotificationPayload>& Payload) const;
+		void FlushPendingOperations();
+
+		// @gdemers channels are never removed, so channel indices, and handles remain stable. an empty channel is inactive.
+		TMap<FGameplayTag, int32> TagToChannelIndex;
+		TArray<FAVVMChannel> Channels;
+		// @gdemers deferred notifications, in broadcast order. bounded per channel, and expired over time, so channels that never
+		// gain observers don't grow forever.
+		TRingBuffer<FAVVMPendingNotification> PendingNotifications;
+		int32 NumPendingNotificationsToVisit = 0;
+
+		// @gdemers observers may register, or unregister, from within a callback. those are deferred so flat arrays aren't
+		// mutated while being iterated.
+		TArray<FAVVMPendingObserver> PendingRegistrations;
+		TArray<TPair<int32, bool>> PendingCompactions;
+		int32 BroadcastDepth = 0;
 	};
 
 	FAVVObserversFilteringMechanism ObserversFilteringMechanism;
+
+	// @gdemers shared with post handles, so workers never resolve the subsystem themselves.
+	TSharedPtr<FAVVMPostedNotificationQueue, ESPMode::ThreadSafe> PostedNotifications;
+
+	// @gdemers deferred notifications are flushed incrementally, under a per-frame budget, so a late observer doesn't
+	// cause a frame spike.
+	uint64 LastFlushFrame = 0;
+	int32 NumFlushedThisFrame = 0;
+	bool bIsDeferredFlushScheduled = false;
 };
 
 // @gdemers allow stripping symbols when building server target for dedicated server
@@ -180,7 +370,7 @@ protected:
 #define UE_AVVM_NOTIFY_IF_LOCALLYCONTROLLED(WorldContextObject, ChannelTag, LocallyControlledActor, ActorBoundToChannel, Payload)
 #else
 #define UE_AVVM_NOTIFY(WorldContextObject, ChannelTag, ActorBoundToChannel, Payload)\
-UAVVMNotificationSubsystem::Static_BroadcastChannel(WorldContextObject, FAVVMNotificationContextArgs{ChannelTag, ActorBoundToChannel, Payload});
+UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(WorldContextObject, ChannelTag, ActorBoundToChannel, Payload);
 #define UE_AVVM_NOTIFY_IF_PC_LOCALLY_CONTROLLED(WorldContextObject, ChannelTag, PC, ActorBoundToChannel, Payload)\
-if(IsValid(PC) && PC->IsLocalPlayerController()) { UAVVMNotificationSubsystem::Static_BroadcastChannel(WorldContextObject, FAVVMNotificationContextArgs{ChannelTag, ActorBoundToChannel, Payload}); }
+if(IsValid(PC) && PC->IsLocalPlayerController()) { UAVVMNotificationSubsystem::Static_BroadcastNativeChannel(WorldContextObject, ChannelTag, ActorBoundToChannel, Payload); }
 #endif
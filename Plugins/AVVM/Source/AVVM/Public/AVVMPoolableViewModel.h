@@ -0,0 +1,56 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/Interface.h"
+
+#include "AVVMPoolableViewModel.generated.h"
+
+/**
+ *	Class description:
+ *
+ *	IAVVMPoolableViewModel is an interface class that identify a ViewModel type that can be recycled by UAVVMSubsystem
+ *	once its last presenter unregister. A pooled ViewModel has to be restored to its default state through ResetViewModel,
+ *	as it will be bound to a different Actor. Both hooks are BlueprintNativeEvent, so Blueprint ViewModels can opt into pooling.
+ */
+UINTERFACE(BlueprintType, Blueprintable)
+class AVVM_API UAVVMPoolableViewModel : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class AVVM_API IAVVMPoolableViewModel
+{
+	GENERATED_BODY()
+
+public:
+	// @gdemers executed when the ViewModel is returned to the pool. release external references, and restore field
+	// values so no state leaks to the next user.
+	UFUNCTION(BlueprintNativeEvent, Category="AVVM|ViewModel")
+	void ResetViewModel();
+	virtual void ResetViewModel_Implementation();
+
+	// @gdemers executed when a pooled ViewModel is handed to a new presenter, before it's bound.
+	UFUNCTION(BlueprintNativeEvent, Category="AVVM|ViewModel")
+	void OnAcquiredFromPool();
+	virtual void OnAcquiredFromPool_Implementation();
+};
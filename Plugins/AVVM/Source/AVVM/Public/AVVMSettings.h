@@ -42,7 +42,35 @@ public:
 	UFUNCTION(BlueprintCallable, Category="AVVM|Settings")
 	static FDataRegistryType GetCheatRegistryType();
 
+	UFUNCTION(BlueprintCallable, Category="AVVM|Settings")
+	static int32 GetMaxPendingNotificationsPerChannel();
+
+	UFUNCTION(BlueprintCallable, Category="AVVM|Settings")
+	static float GetPendingNotificationTimeToLive();
+
+	UFUNCTION(BlueprintCallable, Category="AVVM|Settings")
+	static int32 GetMaxDeferredNotificationsPerFrame();
+
+	UFUNCTION(BlueprintCallable, Category="AVVM|Settings")
+	static int32 GetMaxPooledViewModelsPerClass();
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers")
 	FDataRegistryType CheatRegistryType = FDataRegistryType();
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|Notifications", meta=(ClampMin="1", ToolTip="Max deferred notifications kept per channel tag. The oldest notification is evicted once reached."))
+	int32 MaxPendingNotificationsPerChannel = 32;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|Notifications", meta=(ClampMin="0", ToolTip="Time, in seconds, a deferred notification is kept without observers. 0 never expire."))
+	float PendingNotificationTimeToLive = 30.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|Notifications", meta=(ClampMin="0", ToolTip="Max deferred notifications broadcast per frame. Remaining notifications are broadcast over the next frames. 0 is unbounded."))
+	int32 MaxDeferredNotificationsPerFrame = 64;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|ViewModels", meta=(ClampMin="0", ToolTip="Max released ViewModels kept per class, for reuse. Only ViewModels implementing IAVVMPoolableViewModel are pooled. 0 disable pooling."))
+	int32 MaxPooledViewModelsPerClass = 16;
+
+#if WITH_AUTOMATION_TESTS
+	friend class FAVVMScopedNotificationSettings;
+#endif
 };
@@ -54,6 +54,8 @@ struct AVVM_API FAVVMPresenterContextArgs
  *
  *	UAVVMSubsystem is based on CRUD principle. It Create/Read/Update/Destroy "Manual" ViewModel type with the
  *	using UMVVM plugin api.
+ *
+ *	ViewModels implementing IAVVMPoolableViewModel are recycled, per class, once their last presenter unregister.
  */
 UCLASS(ClassGroup=("AVVM"))
 class AVVM_API UAVVMSubsystem : public UWorldSubsystem
@@ -70,32 +72,86 @@ public:
 	UFUNCTION(BlueprintCallable, Category="AVVM|ViewModel")
 	static UMVVMViewModelBase* Static_RegisterPresenter(const FAVVMPresenterContextArgs& Context);
 
+	UFUNCTION(BlueprintCallable, Category="AVVM|ViewModel")
+	static void Static_UnregisterPresenters(const UWorld* WorldContext,
+	                                        const TArray<UAVVMPresenter*>& Presenters);
+
+	// @gdemers batch api. resolve the subsystem, and reserve storage once, for all presenters (i.e - opening a scoreboard).
+	// OutViewModels is index-aligned with Presenters, and hold nullptr for presenters without ViewModel class.
+	UFUNCTION(BlueprintCallable, Category="AVVM|ViewModel")
+	static void Static_RegisterPresenters(const UWorld* WorldContext,
+	                                      const TArray<UAVVMPresenter*>& Presenters,
+	                                      TArray<UMVVMViewModelBase*>& OutViewModels);
+
+	// @gdemers preallocate pooled ViewModels ahead of time (i.e - during loading screen), so registration doesn't allocate.
+	UFUNCTION(BlueprintCallable, Category="AVVM|ViewModel")
+	static void Static_WarmUpViewModelPool(const UWorld* WorldContext,
+	                                       const TSubclassOf<UMVVMViewModelBase> ViewModelClass,
+	                                       const int32 Count);
+
 #if WITH_AUTOMATION_TESTS
 	static int32 Static_GetPresentersCount(const UWorld* World);
 	static int32 Static_GetActorCount(const UWorld* World);
+	static int32 Static_GetPooledViewModelsCount(const UWorld* World);
 #endif
 
 protected:
 	UFUNCTION(BlueprintCallable)
 	static UAVVMSubsystem* Get(const UWorld* WorldContext);
 	
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMViewModelPool keep released ViewModels, per class, so they can be reused instead of being garbage collected.
+	 */
+	struct FAVVMViewModelPool
+	{
+		~FAVVMViewModelPool();
+
+		TStrongObjectPtr<UMVVMViewModelBase> Acquire(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
+		                                             UObject* Outer);
+
+		void Release(TStrongObjectPtr<UMVVMViewModelBase>&& ViewModel);
+
+		void WarmUp(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
+		            UObject* Outer,
+		            const int32 Count);
+
+#if WITH_AUTOMATION_TESTS
+		int32 Num() const;
+#endif
+
+	private:
+		TMap<const TSubclassOf<UMVVMViewModelBase>, TArray<TStrongObjectPtr<UMVVMViewModelBase>>> ViewModelClassToPooledViewModels;
+	};
+
 	struct FAVVMViewModelKVP
 	{
 		~FAVVMViewModelKVP();
 
 		UMVVMViewModelBase* GetOrCreate(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
-		                                UObject* Outer);
+		                                UObject* Outer,
+		                                FAVVMViewModelPool& Pool);
 
-		bool RemoveOrDestroy(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass);
+		bool RemoveOrDestroy(const TSubclassOf<UMVVMViewModelBase>& ViewModelClass,
+		                     FAVVMViewModelPool& Pool);
 		
 #if WITH_AUTOMATION_TESTS
 		int32 GetPresenterCount() const;
 #endif
 
 	private:
+		struct FAVVMViewModelInstance
+		{
+			TStrongObjectPtr<UMVVMViewModelBase> ViewModel;
+
+			// @gdemers number of presenters, of this Actor, sharing the ViewModel instance.
+			uint32 RefCounter = 0;
+		};
+
 		// @gdemers A given Actor can be referenced by multiple UAVVMPresenter and a ViewModel instance may have to be rebound
 		// to a View, reusing already created View Model class.
-		TMap<const TSubclassOf<UMVVMViewModelBase>, TStrongObjectPtr<UMVVMViewModelBase>> ViewModelClassToViewModelInstance;
+		TMap<const TSubclassOf<UMVVMViewModelBase>, FAVVMViewModelInstance> ViewModelClassToViewModelInstance;
 
 		// @gdemers RefCount target the number of user of the Actor.
 		uint32 RefCounter = 0;
@@ -110,4 +166,6 @@ protected:
 	// @gdemers A collection of unique Actors to a set of ViewModel bound by the TypedOuter<AActor>().
 	// TWeakObjectPtr<AACtor> will remain valid throughout the PIE session as the AActor referenced is the TypedOuter.
 	TMap<TWeakObjectPtr<const AActor>, FAVVMViewModelKVP> ActorToViewModelCollection;
+
+	FAVVMViewModelPool ViewModelPool;
 };
@@ -0,0 +1,349 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "AVVMActorPoolSubsystem.h"
+
+#include "AVVMPoolableActor.h"
+#include "AVVMWorldSetting.h"
+#include "NativeGameplayTags.h"
+#include "Engine/AssetManager.h"
+#include "GameFramework/Actor.h"
+#include "Rules/AVVMActorPoolRule.h"
+#include "Stats/Stats.h"
+#include "TimerManager.h"
+
+// @gdemers WARNING : Careful about Server-Client mismatch. Server grants tags so this module has to be available there.
+UE_DEFINE_GAMEPLAY_TAG(TAG_WORLD_RULE_ACTOR_POOLING, "WorldRule.ActorPooling");
+
+DECLARE_STATS_GROUP(TEXT("AVVMActorPool"), STATGROUP_AVVMActorPool, STATCAT_Advanced);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Actors Spawned"), STAT_AVVMActorPool_NumSpawned, STATGROUP_AVVMActorPool);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Actors Reused"), STAT_AVVMActorPool_NumReused, STATGROUP_AVVMActorPool);
+
+namespace NSAVVMActorPoolSubsystem
+{
+	// @gdemers seconds between attempts at fetching the project rule.
+	static constexpr float RuleRetryRate = 0.25f;
+}
+
+bool UAVVMActorPoolSubsystem::ShouldCreateSubsystem(UObject* Outer) const
+{
+	const auto* World = Cast<UWorld>(Outer);
+	return IsValid(World) ? World->IsGameWorld() : false;
+}
+
+void UAVVMActorPoolSubsystem::OnWorldBeginPlay(UWorld& InWorld)
+{
+	Super::OnWorldBeginPlay(InWorld);
+
+	// @gdemers Project Rules are loaded asynchronously by the WorldSetting actor OnBeginPlay. we retry on a timer until it's available.
+	GetSetProjectActorPoolRule();
+}
+
+void UAVVMActorPoolSubsystem::Deinitialize()
+{
+	Super::Deinitialize();
+
+	UWorld* World = GetWorld();
+	if (IsValid(World))
+	{
+		World->GetTimerManager().ClearTimer(RuleRetryHandle);
+	}
+
+	StreamableHandle.Reset();
+	PendingWarmUpClasses.Reset();
+	Pools.Reset();
+}
+
+void UAVVMActorPoolSubsystem::Tick(float DeltaTime)
+{
+	Super::Tick(DeltaTime);
+
+	if (!PendingWarmUpClasses.IsEmpty())
+	{
+		WarmUp();
+	}
+}
+
+TStatId UAVVMActorPoolSubsystem::GetStatId() const
+{
+	RETURN_QUICK_DECLARE_CYCLE_STAT(UAVVMActorPoolSubsystem, STATGROUP_Tickables);
+}
+
+AActor* UAVVMActorPoolSubsystem::Static_AcquireActor(UWorld* World,
+                                                     const UClass* ActorClass,
+                                                     const FTransform& Transform,
+                                                     const FActorSpawnParameters& SpawnParameters)
+{
+	auto* ActorPoolSubsystem = UAVVMActorPoolSubsystem::Get(World);
+	if (IsValid(ActorPoolSubsystem))
+	{
+		return ActorPoolSubsystem->AcquireActor(ActorClass, Transform, SpawnParameters);
+	}
+
+	// @gdemers another good example of const-ness issue in the engine. the engine require a UClass* to be non-const.
+	return IsValid(World) ? World->SpawnActor(const_cast<UClass*>(ActorClass), &Transform, SpawnParameters) : nullptr;
+}
+
+void UAVVMActorPoolSubsystem::Static_ReleaseActor(const UWorld* World, AActor* Actor)
+{
+	auto* ActorPoolSubsystem = UAVVMActorPoolSubsystem::Get(World);
+	if (IsValid(ActorPoolSubsystem))
+	{
+		ActorPoolSubsystem->ReleaseActor(Actor);
+	}
+	else if (IsValid(Actor))
+	{
+		Actor->Destroy();
+	}
+}
+
+FAVVMActorPoolStats UAVVMActorPoolSubsystem::Static_GetPoolStats(const UWorld* World, const UClass* ActorClass)
+{
+	const auto* ActorPoolSubsystem = UAVVMActorPoolSubsystem::Get(World);
+	const FAVVMActorPool* ActorPool = IsValid(ActorPoolSubsystem) ? ActorPoolSubsystem->Pools.Find(ActorClass) : nullptr;
+	return (ActorPool != nullptr) ? ActorPool->Stats : FAVVMActorPoolStats();
+}
+
+UAVVMActorPoolSubsystem* UAVVMActorPoolSubsystem::Get(const UWorld* World)
+{
+	return UWorld::GetSubsystem<UAVVMActorPoolSubsystem>(World);
+}
+
+AActor* UAVVMActorPoolSubsystem::AcquireActor(const UClass* ActorClass,
+                                              const FTransform& Transform,
+                                              const FActorSpawnParameters& SpawnParameters)
+{
+	if (!IsValid(ActorClass))
+	{
+		return nullptr;
+	}
+
+	FAVVMActorPool& ActorPool = Pools.FindOrAdd(ActorClass);
+
+	AActor* Actor = nullptr;
+	while ((Actor == nullptr) && !ActorPool.PooledActors.IsEmpty())
+	{
+		// @gdemers pooled actors may have been destroyed externally (i.e - level streamed out).
+		AActor* PooledActor = ActorPool.PooledActors.Pop(EAllowShrinking::No).Get();
+		if (IsValid(PooledActor) && !PooledActor->IsActorBeingDestroyed())
+		{
+			Actor = PooledActor;
+		}
+	}
+
+	if (Actor != nullptr)
+	{
+		ActivateActor(Actor, Transform, SpawnParameters);
+		++ActorPool.Stats.NumReused;
+		INC_DWORD_STAT(STAT_AVVMActorPool_NumReused);
+	}
+	else
+	{
+		Actor = SpawnActor(ActorClass, Transform, SpawnParameters);
+		if (!IsValid(Actor))
+		{
+			return nullptr;
+		}
+
+		++ActorPool.Stats.NumSpawned;
+		INC_DWORD_STAT(STAT_AVVMActorPool_NumSpawned);
+	}
+
+	ActorPool.Stats.NumPooled = ActorPool.PooledActors.Num();
+	ActorPool.Stats.NumActive += 1;
+	ActorPool.Stats.HighWaterMark = FMath::Max(ActorPool.Stats.HighWaterMark, ActorPool.Stats.NumActive);
+	return Actor;
+}
+
+void UAVVMActorPoolSubsystem::ReleaseActor(AActor* Actor)
+{
+	if (!IsValid(Actor) || Actor->IsActorBeingDestroyed())
+	{
+		return;
+	}
+
+	FAVVMActorPool* ActorPool = Pools.Find(Actor->GetClass());
+	if (ActorPool != nullptr)
+	{
+		ActorPool->Stats.NumActive = FMath::Max(ActorPool->Stats.NumActive - 1, 0);
+	}
+
+	if ((ActorPool == nullptr) || (ActorPool->PooledActors.Num() >= ActorPool->MaxPooledCount))
+	{
+		Actor->Destroy();
+		return;
+	}
+
+	DeactivateActor(Actor);
+	ActorPool->PooledActors.Add(Actor);
+	ActorPool->Stats.NumPooled = ActorPool->PooledActors.Num();
+}
+
+AActor* UAVVMActorPoolSubsystem::SpawnActor(const UClass* ActorClass,
+                                            const FTransform& Transform,
+                                            const FActorSpawnParameters& SpawnParameters) const
+{
+	UWorld* World = GetWorld();
+	return IsValid(World) ? World->SpawnActor(const_cast<UClass*>(ActorClass), &Transform, SpawnParameters) : nullptr;
+}
+
+void UAVVMActorPoolSubsystem::ActivateActor(AActor* Actor,
+                                            const FTransform& Transform,
+                                            const FActorSpawnParameters& SpawnParameters) const
+{
+	Actor->SetOwner(SpawnParameters.Owner);
+	Actor->SetInstigator(SpawnParameters.Instigator);
+	Actor->SetActorTransform(Transform, false, nullptr, ETeleportType::ResetPhysics);
+	Actor->SetActorEnableCollision(true);
+	Actor->SetActorHiddenInGame(false);
+	Actor->SetActorTickEnabled(Actor->PrimaryActorTick.bStartWithTickEnabled);
+
+	auto* PoolableActor = Cast<IAVVMPoolableActor>(Actor);
+	if (PoolableActor != nullptr)
+	{
+		PoolableActor->OnAcquiredFromPool();
+	}
+}
+
+void UAVVMActorPoolSubsystem::DeactivateActor(AActor* Actor) const
+{
+	Actor->SetActorHiddenInGame(true);
+	Actor->SetActorEnableCollision(false);
+	Actor->SetActorTickEnabled(false);
+
+	auto* PoolableActor = Cast<IAVVMPoolableActor>(Actor);
+	if (PoolableActor != nullptr)
+	{
+		PoolableActor->OnReleasedToPool();
+	}
+}
+
+void UAVVMActorPoolSubsystem::GetSetProjectActorPoolRule()
+{
+	UWorld* World = GetWorld();
+	if (!IsValid(World))
+	{
+		return;
+	}
+
+	// @gdemers without AAVVMWorldSetting, the rule will never be available. classes fallback on SpawnActor/Destroy.
+	const auto* WorldSettings = Cast<AAVVMWorldSetting>(World->GetWorldSettings());
+	if (!IsValid(WorldSettings))
+	{
+		return;
+	}
+
+	FTimerManager& TimerManager = World->GetTimerManager();
+
+	ActorPoolRule = WorldSettings->GetRule<UAVVMActorPoolRule>(TAG_WORLD_RULE_ACTOR_POOLING);
+	if (ActorPoolRule.IsValid())
+	{
+		TimerManager.ClearTimer(RuleRetryHandle);
+		InitRule();
+	}
+	else if (!TimerManager.IsTimerActive(RuleRetryHandle))
+	{
+		const auto Callback = FTimerDelegate::CreateUObject(this, &UAVVMActorPoolSubsystem::GetSetProjectActorPoolRule);
+		TimerManager.SetTimer(RuleRetryHandle, Callback, NSAVVMActorPoolSubsystem::RuleRetryRate, true);
+	}
+}
+
+void UAVVMActorPoolSubsystem::InitRule()
+{
+	const UAVVMActorPoolRule* Rule = ActorPoolRule.Get();
+	if (!IsValid(Rule))
+	{
+		return;
+	}
+
+	MaxWarmUpSpawnsPerFrame = FMath::Max(Rule->GetMaxWarmUpSpawnsPerFrame(), 1);
+
+	TArray<FSoftObjectPath> SoftObjectPaths;
+	for (const auto& [ActorClass, Config] : Rule->GetPooledClasses())
+	{
+		SoftObjectPaths.Add(ActorClass.ToSoftObjectPath());
+	}
+
+	const auto OnAsyncLoadComplete = [](const TWeakObjectPtr<UAVVMActorPoolSubsystem>& NewActorPoolSubsystem)
+	{
+		if (!NewActorPoolSubsystem.IsValid())
+		{
+			return;
+		}
+
+		const UAVVMActorPoolRule* NewRule = NewActorPoolSubsystem->ActorPoolRule.Get();
+		if (!IsValid(NewRule))
+		{
+			return;
+		}
+
+		for (const auto& [ActorClass, Config] : NewRule->GetPooledClasses())
+		{
+			const UClass* LoadedClass = ActorClass.Get();
+			if (!IsValid(LoadedClass))
+			{
+				continue;
+			}
+
+			FAVVMActorPool& ActorPool = NewActorPoolSubsystem->Pools.FindOrAdd(LoadedClass);
+			ActorPool.MaxPooledCount = Config.MaxPooledCount;
+			ActorPool.PendingWarmUpCount = FMath::Min(Config.PreWarmCount, Config.MaxPooledCount);
+			ActorPool.PooledActors.Reserve(Config.MaxPooledCount);
+
+			if (ActorPool.PendingWarmUpCount > 0)
+			{
+				NewActorPoolSubsystem->PendingWarmUpClasses.Add(LoadedClass);
+			}
+		}
+	};
+
+	const auto Callback = FStreamableDelegate::CreateWeakLambda(this, OnAsyncLoadComplete, TWeakObjectPtr(this));
+	StreamableHandle = UAssetManager::Get().LoadAssetList(SoftObjectPaths, Callback);
+}
+
+void UAVVMActorPoolSubsystem::WarmUp()
+{
+	FActorSpawnParameters SpawnParameters;
+	SpawnParameters.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+
+	int32 NumSpawned = 0;
+	while ((NumSpawned < MaxWarmUpSpawnsPerFrame) && !PendingWarmUpClasses.IsEmpty())
+	{
+		const UClass* ActorClass = PendingWarmUpClasses.Last().Get();
+		FAVVMActorPool* ActorPool = IsValid(ActorClass) ? Pools.Find(ActorClass) : nullptr;
+		if ((ActorPool == nullptr) || (ActorPool->PendingWarmUpCount <= 0))
+		{
+			PendingWarmUpClasses.Pop(EAllowShrinking::No);
+			continue;
+		}
+
+		AActor* Actor = SpawnActor(ActorClass, FTransform::Identity, SpawnParameters);
+		--ActorPool->PendingWarmUpCount;
+		++NumSpawned;
+
+		if (IsValid(Actor))
+		{
+			DeactivateActor(Actor);
+			ActorPool->PooledActors.Add(Actor);
+			ActorPool->Stats.NumPooled = ActorPool->PooledActors.Num();
+			++ActorPool->Stats.NumSpawned;
+			INC_DWORD_STAT(STAT_AVVMActorPool_NumSpawned);
+		}
+	}
+}
@@ -23,6 +23,7 @@
 #include "AVVMGameplayUtils.h"
 #include "AVVMGameSession.h"
 #include "AVVMNotificationSubsystem.h"
+#include "AVVMPositionSamplerSubsystem.h"
 #include "AVVMReplicatedTagComponent.h"
 #include "AVVMToolkitUtils.h"
 #include "Ability/AVVMAbilitySystemComponent.h"
@@ -85,6 +86,9 @@ void AAVVMCharacter::BeginPlay()
 		NewCapsuleComponent->SetCollisionEnabled(NewCollisionEnabled);
 	}
 
+	// @gdemers no-op unless the position sampler subsystem is running (i.e - authority, with lag compensation enabled).
+	UAVVMPositionSamplerSubsystem::Static_RegisterCharacter(this);
+
 #if WITH_EDITOR
 	if (!IsNetMode(NM_DedicatedServer))
 #endif
@@ -100,6 +104,8 @@ void AAVVMCharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	UAVVMPositionSamplerSubsystem::Static_UnregisterCharacter(this);
+
 #if WITH_EDITOR
 	if (!IsNetMode(NM_DedicatedServer))
 #endif
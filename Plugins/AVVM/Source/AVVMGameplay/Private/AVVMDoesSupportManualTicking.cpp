@@ -17,4 +17,17 @@
 //LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
 //OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 //SOFTWARE.
-#include "AVVMDoesSupportManualTicking.h"
\ No newline at end of file
+#include "AVVMDoesSupportManualTicking.h"
+
+bool IAVVMDoesSupportManualTicking::DoesSupportParallelTick() const
+{
+	return false;
+}
+
+void IAVVMDoesSupportManualTicking::ParallelTick(const float DeltaTime)
+{
+}
+
+void IAVVMDoesSupportManualTicking::CommitTick(const float DeltaTime)
+{
+}
@@ -251,32 +251,17 @@ int32 AAVVMGameSession::GetPlayerPresetId(const APlayerState* PlayerState) const
 
 TArray<int32> AAVVMGameSession::GetPlayerPresetItems(const int32 ProfileId) const
 {
-	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
-	if (!ensureAlwaysMsgf(IsValid(JsonParser),
-	                      TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
-	{
-		return TArray<int32>{};
-	}
-
 	const bool bDoesContains = SessionPayload.PresetIds.Contains(ProfileId);
 	if (bDoesContains)
 	{
-		const int32 PresetId = SessionPayload.PresetIds[ProfileId];
-
-		const bool bHasResolvedPreset = SessionPayload.ResolvedPresets.Contains(PresetId);
-		if (!ensureAlwaysMsgf(bHasResolvedPreset,
-		                      TEXT("Cannot resolve the Backend representation referenced by the provided Id.")))
+		const FAVVMPlayerPreset* PlayerPreset = FindPlayerPreset(SessionPayload.PresetIds[ProfileId]);
+		if (PlayerPreset == nullptr)
 		{
 			return TArray<int32>{};
 		}
 
-		const FString PresetPayload = SessionPayload.ResolvedPresets[PresetId];
-
-		FAVVMPlayerPreset OutPlayerPreset;
-		JsonParser->FromString(PresetPayload, OutPlayerPreset);
-
 		TArray<int32> OutEquippedItems;
-		OutPlayerPreset.EquippedItems.GenerateValueArray(OutEquippedItems);
+		PlayerPreset->EquippedItems.GenerateValueArray(OutEquippedItems);
 
 		return OutEquippedItems;
 	}
@@ -288,50 +273,14 @@ TArray<int32> AAVVMGameSession::GetPlayerPresetItems(const int32 ProfileId) cons
 
 TArray<int32> AAVVMGameSession::GetPlayerComplexDependencyLookup(const int32 ProfileId) const
 {
-	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
-	if (!ensureAlwaysMsgf(IsValid(JsonParser),
-						  TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
-	{
-		return TArray<int32>{};
-	}
-
-	const bool bHasResolvedProfile = SessionPayload.ResolvedProfiles.Contains(ProfileId);
-	if (!ensureAlwaysMsgf(bHasResolvedProfile,
-						  TEXT("Cannot resolve the Backend representation referenced by the provided Id.")))
-	{
-		return TArray<int32>{};
-	}
-
-	const FString ProfilePayload = SessionPayload.ResolvedProfiles[ProfileId];
-
-	FAVVMPlayerProfile OutPlayerProfile;
-	JsonParser->FromString(ProfilePayload, OutPlayerProfile);
-
-	return OutPlayerProfile.ComplexDependencyLookup;
+	const FAVVMPlayerProfile* PlayerProfile = FindPlayerProfile(ProfileId);
+	return (PlayerProfile != nullptr) ? PlayerProfile->ComplexDependencyLookup : TArray<int32>{};
 }
 
 TArray<int32> AAVVMGameSession::GetPlayerInventoryItems(const int32 ProfileId) const
 {
-	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
-	if (!ensureAlwaysMsgf(IsValid(JsonParser),
-	                      TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
-	{
-		return TArray<int32>{};
-	}
-
-	const bool bHasResolvedProfile = SessionPayload.ResolvedProfiles.Contains(ProfileId);
-	if (!ensureAlwaysMsgf(bHasResolvedProfile,
-	                      TEXT("Cannot resolve the Backend representation referenced by the provided Id.")))
-	{
-		return TArray<int32>{};
-	}
-
-	const FString ProfilePayload = SessionPayload.ResolvedProfiles[ProfileId];
-
-	FAVVMPlayerProfile OutPlayerProfile;
-	JsonParser->FromString(ProfilePayload, OutPlayerProfile);
-
-	return OutPlayerProfile.InventoryIds;
+	const FAVVMPlayerProfile* PlayerProfile = FindPlayerProfile(ProfileId);
+	return (PlayerProfile != nullptr) ? PlayerProfile->InventoryIds : TArray<int32>{};
 }
 
 TArray<int32> AAVVMGameSession::GetActorInventoryItems(const int32 ProfileId) const
@@ -344,67 +293,39 @@ TArray<int32> AAVVMGameSession::GetActorInventoryItems(const int32 ProfileId) co
 FString AAVVMGameSession::ModifyPlayerProfileInventory(const int32 ProfileId,
                                                        const TArray<int32>& NewItems)
 {
-	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
-	if (!ensureAlwaysMsgf(IsValid(JsonParser),
-	                      TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
+	FAVVMPlayerProfile* PlayerProfile = SessionPayload.ResolvedProfiles.Find(ProfileId);
+	if (!ensureAlwaysMsgf(PlayerProfile != nullptr,
+	                      TEXT("Cannot resolve the Backend representation referenced by the provided Id.")))
 	{
 		return FString();
 	}
 
-	const bool bHasResolvedProfile = SessionPayload.ResolvedProfiles.Contains(ProfileId);
-	if (!ensureAlwaysMsgf(bHasResolvedProfile,
-	                      TEXT("Cannot resolve the Backend representation referenced by the provided Id.")))
+	// @gdemers dirty profile with new data. the returned payload is submitted by the caller.
+	if (PlayerProfile->InventoryIds != NewItems)
 	{
-		return FString();
+		PlayerProfile->InventoryIds = NewItems;
+		SessionPayload.SerializedProfiles.Remove(ProfileId);
 	}
 
-	FAVVMPlayerProfile OutOldProfile;
-
-	FString& OldProfile = SessionPayload.ResolvedProfiles[ProfileId];
-	JsonParser->FromString(OldProfile, OutOldProfile);
-
-	// @gdemers dirty profile with new data.
-	OutOldProfile.InventoryIds = NewItems;
-	JsonParser->ToString(OutOldProfile, OldProfile);
-
-	return OldProfile;
+	return SerializePlayerProfile(ProfileId);
 }
 
 FGameplayTag AAVVMGameSession::GetPlayerPresetSlot(const int32 ProfileId,
                                                    const int32 PrivateItemId) const
 {
-	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
-	if (!ensureAlwaysMsgf(IsValid(JsonParser),
-	                      TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
-	{
-		return FGameplayTag::EmptyTag;
-	}
-
-	const bool bHasResolvedProfile = SessionPayload.ResolvedProfiles.Contains(ProfileId);
-	if (!ensureAlwaysMsgf(bHasResolvedProfile,
-	                      TEXT("Cannot resolve the Backend representation referenced by the provided Id.")))
+	const FAVVMPlayerProfile* PlayerProfile = FindPlayerProfile(ProfileId);
+	if (PlayerProfile == nullptr)
 	{
 		return FGameplayTag::EmptyTag;
 	}
 
-	const FString ProfilePayload = SessionPayload.ResolvedProfiles[ProfileId];
-
-	FAVVMPlayerProfile OutPlayerProfile;
-	JsonParser->FromString(ProfilePayload, OutPlayerProfile);
-
-	const bool bHasResolvedPreset = SessionPayload.ResolvedPresets.Contains(OutPlayerProfile.EquippedPresetId);
-	if (!ensureAlwaysMsgf(bHasResolvedPreset,
-	                      TEXT("Cannot resolve the Backend representation referenced by the provided Id.")))
+	const FAVVMPlayerPreset* PlayerPreset = FindPlayerPreset(PlayerProfile->EquippedPresetId);
+	if (PlayerPreset == nullptr)
 	{
 		return FGameplayTag::EmptyTag;
 	}
 
-	const FString PresetPayload = SessionPayload.ResolvedPresets[OutPlayerProfile.EquippedPresetId];
-
-	FAVVMPlayerPreset OutPlayerPreset;
-	JsonParser->FromString(PresetPayload, OutPlayerPreset);
-
-	const FGameplayTag* SearchResult = OutPlayerPreset.EquippedItems.FindKey(PrivateItemId);
+	const FGameplayTag* SearchResult = PlayerPreset->EquippedItems.FindKey(PrivateItemId);
 	return (SearchResult != nullptr) ? *SearchResult : FGameplayTag::EmptyTag;
 }
 
@@ -429,22 +350,15 @@ void AAVVMGameSession::MakePlayerProfileId(const APlayerState* PlayerState,
 	int32& OutProfileId = SessionPayload.ProfileIds.FindOrAdd(PlayerConnectionId);
 	OutProfileId = NewPlayerProfile.UniqueId;
 
-	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
-	if (!ensureAlwaysMsgf(IsValid(JsonParser),
-	                      TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
-	{
-		return;
-	}
-
-	FString& OutJsonPayload = SessionPayload.ResolvedProfiles.FindOrAdd(OutProfileId);
-	JsonParser->ToString(NewPlayerProfile, OutJsonPayload);
+	SessionPayload.ResolvedProfiles.Add(OutProfileId, NewPlayerProfile);
+	SessionPayload.SerializedProfiles.Remove(OutProfileId);
 
 #if !UE_BUILD_SHIPPING
 	// @gdemers violating constness on purpose. this workaround is for dev tooling ONLY.
 	auto* Target = Cast<AAVVMPlayerState>(const_cast<APlayerState*>(PlayerState));
 	if (IsValid(Target))
 	{
-		Target->SetClientSidedProfilePayload(OutJsonPayload);
+		Target->SetClientSidedProfilePayload(SerializePlayerProfile(OutProfileId));
 	}
 #endif
 }
@@ -462,24 +376,94 @@ void AAVVMGameSession::MakePlayerPresetId(const APlayerState* PlayerState,
 	int32& OutPresetId = SessionPayload.PresetIds.FindOrAdd(PlayerProfileId);
 	OutPresetId = NewPlayerPreset.UniqueId;
 
+	SessionPayload.ResolvedPresets.Add(OutPresetId, NewPlayerPreset);
+	SessionPayload.SerializedPresets.Remove(OutPresetId);
+
+#if !UE_BUILD_SHIPPING
+	// @gdemers violating constness on purpose. this workaround is for dev tooling ONLY.
+	auto* Target = Cast<AAVVMPlayerState>(const_cast<APlayerState*>(PlayerState));
+	if (IsValid(Target))
+	{
+		Target->SetClientSidedPresetPayload(SerializePlayerPreset(OutPresetId));
+	}
+#endif
+}
+
+const FAVVMPlayerProfile* AAVVMGameSession::FindPlayerProfile(const int32 ProfileId) const
+{
+	const FAVVMPlayerProfile* PlayerProfile = SessionPayload.ResolvedProfiles.Find(ProfileId);
+	ensureAlwaysMsgf(PlayerProfile != nullptr,
+	                 TEXT("Cannot resolve the Backend representation referenced by the provided Id."));
+
+	return PlayerProfile;
+}
+
+const FAVVMPlayerPreset* AAVVMGameSession::FindPlayerPreset(const int32 PresetId) const
+{
+	const FAVVMPlayerPreset* PlayerPreset = SessionPayload.ResolvedPresets.Find(PresetId);
+	ensureAlwaysMsgf(PlayerPreset != nullptr,
+	                 TEXT("Cannot resolve the Backend representation referenced by the provided Id."));
+
+	return PlayerPreset;
+}
+
+const FString& AAVVMGameSession::SerializePlayerProfile(const int32 ProfileId)
+{
+	// @gdemers clean entries are returned as is. JSON serialization only runs once per modification.
+	const FString* SerializedProfile = SessionPayload.SerializedProfiles.Find(ProfileId);
+	if (SerializedProfile != nullptr)
+	{
+		return *SerializedProfile;
+	}
+
+	static const FString EmptyPayload;
+
+	const FAVVMPlayerProfile* PlayerProfile = FindPlayerProfile(ProfileId);
+	if (PlayerProfile == nullptr)
+	{
+		return EmptyPayload;
+	}
+
 	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
 	if (!ensureAlwaysMsgf(IsValid(JsonParser),
 	                      TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
 	{
-		return;
+		return EmptyPayload;
 	}
 
-	FString& OutJsonPayload = SessionPayload.ResolvedPresets.FindOrAdd(OutPresetId);
-	JsonParser->ToString(NewPlayerPreset, OutJsonPayload);
+	FString& OutJsonPayload = SessionPayload.SerializedProfiles.Add(ProfileId);
+	JsonParser->ToString(*PlayerProfile, OutJsonPayload);
 
-#if !UE_BUILD_SHIPPING
-	// @gdemers violating constness on purpose. this workaround is for dev tooling ONLY.
-	auto* Target = Cast<AAVVMPlayerState>(const_cast<APlayerState*>(PlayerState));
-	if (IsValid(Target))
+	return OutJsonPayload;
+}
+
+const FString& AAVVMGameSession::SerializePlayerPreset(const int32 PresetId)
+{
+	const FString* SerializedPreset = SessionPayload.SerializedPresets.Find(PresetId);
+	if (SerializedPreset != nullptr)
 	{
-		Target->SetClientSidedPresetPayload(OutJsonPayload);
+		return *SerializedPreset;
 	}
-#endif
+
+	static const FString EmptyPayload;
+
+	const FAVVMPlayerPreset* PlayerPreset = FindPlayerPreset(PresetId);
+	if (PlayerPreset == nullptr)
+	{
+		return EmptyPayload;
+	}
+
+	UAVVMOnlinePlayerStringParser* JsonParser = FAVVMOnlineModule::GetJsonParser_Player();
+	if (!ensureAlwaysMsgf(IsValid(JsonParser),
+	                      TEXT("FAVVMOnlineModule::GetJsonParser doesn't reference a valid parser.")))
+	{
+		return EmptyPayload;
+	}
+
+	FString& OutJsonPayload = SessionPayload.SerializedPresets.Add(PresetId);
+	JsonParser->ToString(*PlayerPreset, OutJsonPayload);
+
+	return OutJsonPayload;
 }
 
 void AAVVMGameSession::AddPlayer(const FString& UniqueNetId)
@@ -540,4 +524,6 @@ void AAVVMGameSession::CleanupOldPlayerConnection(const int32 PlayerConnectionId
 	SessionPayload.PresetIds.Remove(ProfileId);
 	SessionPayload.ResolvedProfiles.Remove(ProfileId);
 	SessionPayload.ResolvedPresets.Remove(PresetId);
+	SessionPayload.SerializedProfiles.Remove(ProfileId);
+	SessionPayload.SerializedPresets.Remove(PresetId);
 }
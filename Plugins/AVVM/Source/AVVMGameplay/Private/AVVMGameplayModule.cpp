@@ -46,7 +46,7 @@ static FAutoConsoleVariableRef COverrideTickSchedulerJobAllotment(TEXT("c.SetTic
 static float CVarOverrideTickSchedulerTickRate = 0;
 static FAutoConsoleVariableRef COverrideTickSchedulerTickRate(TEXT("c.SetTickSchedulerTickRate"),
                                                               CVarOverrideTickSchedulerTickRate,
-                                                              TEXT("Set tick rate"),
+                                                              TEXT("Set tick rate. 0, or less, leave the serial lane unbounded"),
                                                               ECVF_Default);
 
 static float CVarOverrideTickSchedulerResetTimeJobQueuePriority = 0;
@@ -55,6 +55,12 @@ static FAutoConsoleVariableRef COverrideTickSchedulerResetTimeJobQueuePriority(T
                                                                                TEXT("Set time for priority queue reset. i.e put all jobs back to highest level."),
                                                                                ECVF_Default);
 
+static float CVarOverrideTickSchedulerMaxStaleness = 0;
+static FAutoConsoleVariableRef COverrideTickSchedulerMaxStaleness(TEXT("c.SetTickSchedulerMaxStaleness"),
+                                                                  CVarOverrideTickSchedulerMaxStaleness,
+                                                                  TEXT("Set max time an entity can go without ticking."),
+                                                                  ECVF_Default);
+
 namespace NSAVVMFunctor
 {
 #if !UE_BUILD_SHIPPING
@@ -102,6 +108,11 @@ void FAVVMGameplayModule::StartupModule()
 		auto& Delegate = COverrideTickSchedulerResetTimeJobQueuePriority->OnChangedDelegate();
 		HandleD = Delegate.AddStatic(NSAVVMFunctor::OnTickSchedulerCVarChanged);
 	}
+
+	{
+		auto& Delegate = COverrideTickSchedulerMaxStaleness->OnChangedDelegate();
+		HandleE = Delegate.AddStatic(NSAVVMFunctor::OnTickSchedulerCVarChanged);
+	}
 #endif
 }
 
@@ -127,6 +138,11 @@ void FAVVMGameplayModule::ShutdownModule()
 		auto& Delegate = COverrideTickSchedulerResetTimeJobQueuePriority->OnChangedDelegate();
 		Delegate.Remove(HandleD);
 	}
+
+	{
+		auto& Delegate = COverrideTickSchedulerMaxStaleness->OnChangedDelegate();
+		Delegate.Remove(HandleE);
+	}
 #endif
 
 	const bool bIsAvailable = IGameplayTagsModule::IsAvailable();
@@ -174,4 +190,9 @@ IConsoleVariable* FAVVMGameplayModule::GetCVarOverrideTickSchedulerResetTimeJobQ
 	return COverrideTickSchedulerResetTimeJobQueuePriority->AsVariable();
 }
 
+IConsoleVariable* FAVVMGameplayModule::GetCVarOverrideTickSchedulerMaxStaleness()
+{
+	return COverrideTickSchedulerMaxStaleness->AsVariable();
+}
+
 IMPLEMENT_MODULE(FAVVMGameplayModule, AVVMGameplay)
@@ -63,3 +63,23 @@ const FDataRegistryId& UAVVMGameplaySettings::GetStubDataProviderActorIdentifier
 {
 	return GetDefault<UAVVMGameplaySettings>()->StubDataProviderActorIdentifierId;
 }
+
+int32 UAVVMGameplaySettings::GetMaxPoseHistoryBytesPerCharacter()
+{
+	return GetDefault<UAVVMGameplaySettings>()->MaxPoseHistoryBytesPerCharacter;
+}
+
+int32 UAVVMGameplaySettings::GetMaxHitboxBodiesPerCharacter()
+{
+	return GetDefault<UAVVMGameplaySettings>()->MaxHitboxBodiesPerCharacter;
+}
+
+int32 UAVVMGameplaySettings::GetMaxNetFinalizedPerBackfillChunk()
+{
+	return GetDefault<UAVVMGameplaySettings>()->MaxNetFinalizedPerBackfillChunk;
+}
+
+float UAVVMGameplaySettings::GetNetRefreshBudgetMilliseconds()
+{
+	return GetDefault<UAVVMGameplaySettings>()->NetRefreshBudgetMilliseconds;
+}
@@ -19,13 +19,25 @@
 //SOFTWARE.
 #include "AVVMPlayerState.h"
 
+#include "AVVMGameplaySettings.h"
+#include "TimerManager.h"
 #include "Ability/AVVMAbilitySystemComponent.h"
+#include "Engine/World.h"
 #include "GameFramework/GameStateBase.h"
 #include "Kismet/GameplayStatics.h"
 #include "Net/AVVMDoesImplNetSynchronization.h"
 #include "Net/AVVMNetSynchronizationManager.h"
 #include "Net/UnrealNetwork.h"
 
+namespace NSAVVMNetRefresh
+{
+	template<typename TPendingNetRefresh>
+	static bool HasHigherPriority(const TPendingNetRefresh& Lhs, const TPendingNetRefresh& Rhs)
+	{
+		return (Lhs.Priority != Rhs.Priority) ? (Lhs.Priority > Rhs.Priority) : (Lhs.Sequence < Rhs.Sequence);
+	}
+}
+
 FAVVMPlayerStatePayload::FAVVMPlayerStatePayload(const APlayerState* NewPlayerState,
                                                  const bool bNewAddOrRemove)
 	: PlayerState(NewPlayerState),
@@ -73,6 +85,14 @@ void AAVVMPlayerState::BeginPlay()
 void AAVVMPlayerState::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
+
+	if (HasAuthority())
+	{
+		UAVVMNetSynchronizationManager::Static_UnregisterClient(GetWorld(), this);
+	}
+
+	PendingNetRefreshes.Reset();
+	bIsNetSynchronizationCompletePending = false;
 }
 
 void AAVVMPlayerState::ClientInitialize(class AController* C)
@@ -182,40 +202,138 @@ FOnSetPlayerUniqueNetIdDelegate& AAVVMPlayerState::GetOnSetPlayerUniqueNetIdDele
 
 void AAVVMPlayerState::Server_OnAutonomousPlayerBackfilling_Implementation()
 {
-	const UWorld* World = GetWorld();
-	TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>> NetFinalized = UAVVMNetSynchronizationManager::Static_GetAllNetFinalized(World);
-	Client_OnNetFinalized(NetFinalized);
+	// @gdemers always answer with a final chunk, even when the client is up to date. it fence its synchronization.
+	SendNetFinalizedChunk(true);
 }
 
-void AAVVMPlayerState::Client_OnNetFinalized_Implementation(const TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& NetFinalized)
+void AAVVMPlayerState::SendNetFinalizedChunk(const bool bForceSend)
 {
+	TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>> NetFinalized;
+	int32 Version = 0;
+	bool bIsFinalChunk = true;
+
+	const bool bShouldSend = UAVVMNetSynchronizationManager::Static_GetNextBackfillChunk(GetWorld(),
+	                                                                                      this,
+	                                                                                      bForceSend,
+	                                                                                      NetFinalized,
+	                                                                                      Version,
+	                                                                                      bIsFinalChunk);
+	if (bShouldSend)
+	{
+		Client_OnNetFinalized(NetFinalized, Version, bIsFinalChunk);
+	}
+}
+
+void AAVVMPlayerState::Client_OnNetFinalized_Implementation(const TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& NetFinalized,
+                                                            const int32 Version,
+                                                            const bool bIsFinalChunk)
+{
+	// @gdemers acknowledge first, so the server can send the next chunk while we refresh this one.
+	Server_OnNetFinalizedAcknowledged(Version);
+
+	for (const auto& Net : NetFinalized)
+	{
+		UObject* NetSystem = Net.GetObject();
+		if (!IsValid(NetSystem))
+		{
+			continue;
+		}
+
+		FAVVMPendingNetRefresh PendingNetRefresh;
+		PendingNetRefresh.NetSystem = NetSystem;
+		PendingNetRefresh.Priority = IAVVMDoesImplNetSynchronization::Execute_GetNetSynchronizationPriority(NetSystem);
+		PendingNetRefresh.Sequence = NextNetRefreshSequence++;
+		PendingNetRefresh.bIsNetRelevantForLocalClientOnly = IAVVMDoesImplNetSynchronization::Execute_IsNetRelevantForLocalClientOnly(NetSystem);
+		PendingNetRefreshes.HeapPush(MoveTemp(PendingNetRefresh), NSAVVMNetRefresh::HasHigherPriority<FAVVMPendingNetRefresh>);
+	}
+
+	// @gdemers the fence is raised once every pending refresh executed, which may span several frames. it's raised once per player
+	// state. later final chunks (i.e - systems finalized after the initial backfill) don't raise it again.
+	bIsNetSynchronizationCompletePending |= (bIsFinalChunk && !bHasNetSynchronizationCompleted);
+
+	if (!bIsNetRefreshScheduled)
+	{
+		ExecutePendingNetRefreshes();
+	}
+}
+
+void AAVVMPlayerState::ExecutePendingNetRefreshes()
+{
+	bIsNetRefreshScheduled = false;
+
+	// @gdemers the game state may not have replicated yet. retry next frame.
 	AGameStateBase* GameStateBase = UGameplayStatics::GetGameState(this);
 	if (!IsValid(GameStateBase))
 	{
+		bIsNetRefreshScheduled = true;
+		GetWorldTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &AAVVMPlayerState::ExecutePendingNetRefreshes));
 		return;
 	}
 
-	TArray<APlayerState*> PlayerStates = GameStateBase->PlayerArray;
-	for (const auto& Net : NetFinalized)
+	TArray<AAVVMPlayerState*> PlayerStates;
+	PlayerStates.Reserve(GameStateBase->PlayerArray.Num());
+	for (APlayerState* PlayerState : GameStateBase->PlayerArray)
 	{
-		UObject* NetSystem = Net.GetObject();
-		const bool bIsNetRelevantForLocalClientOnly = IAVVMDoesImplNetSynchronization::Execute_IsNetRelevantForLocalClientOnly(NetSystem);
-		if (bIsNetRelevantForLocalClientOnly)
+		auto* NewPlayerState = Cast<AAVVMPlayerState>(PlayerState);
+		if (IsValid(NewPlayerState))
+		{
+			PlayerStates.Add(NewPlayerState);
+		}
+	}
+
+	const double Budget = (UAVVMGameplaySettings::GetNetRefreshBudgetMilliseconds() / 1000.0);
+	const double StartTime = FPlatformTime::Seconds();
+
+	// @gdemers at least one refresh per frame, so a single expensive system cannot starve the pipeline.
+	do
+	{
+		if (PendingNetRefreshes.IsEmpty())
+		{
+			break;
+		}
+
+		FAVVMPendingNetRefresh PendingNetRefresh;
+		PendingNetRefreshes.HeapPop(PendingNetRefresh, NSAVVMNetRefresh::HasHigherPriority<FAVVMPendingNetRefresh>, EAllowShrinking::No);
+
+		UObject* NetSystem = PendingNetRefresh.NetSystem.Get();
+		if (!IsValid(NetSystem))
+		{
+			continue;
+		}
+
+		if (PendingNetRefresh.bIsNetRelevantForLocalClientOnly)
 		{
 			IAVVMDoesImplNetSynchronization::Execute_ClientRefresh(NetSystem, this);
 		}
 		else
 		{
-			for (APlayerState* PlayerState : PlayerStates)
-			{
-				IAVVMDoesImplNetSynchronization::Execute_ClientRefresh(NetSystem, Cast<AAVVMPlayerState>(PlayerState));
-			}
+			IAVVMDoesImplNetSynchronization::Execute_ClientRefreshBatch(NetSystem, PlayerStates);
 		}
 	}
+	while ((FPlatformTime::Seconds() - StartTime) < Budget);
+
+	if (!PendingNetRefreshes.IsEmpty())
+	{
+		bIsNetRefreshScheduled = true;
+		GetWorldTimerManager().SetTimerForNextTick(FTimerDelegate::CreateUObject(this, &AAVVMPlayerState::ExecutePendingNetRefreshes));
+	}
+	else if (bIsNetSynchronizationCompletePending)
+	{
+		bIsNetSynchronizationCompletePending = false;
+		bHasNetSynchronizationCompleted = true;
+
+		// @gdemers event acting as a fence system, and notify ui of initialization phase
+		// being completed. allow for proper presentation to never display intermediate state.
+		GetOnPostNetClientSynchronizationComplete().Broadcast(this);
+	}
+}
+
+void AAVVMPlayerState::Server_OnNetFinalizedAcknowledged_Implementation(const int32 Version)
+{
+	UAVVMNetSynchronizationManager::Static_AcknowledgeBackfill(GetWorld(), this, Version);
 
-	// @gdemers event acting as a fence system, and notify ui of initialization phase
-	// being completed. allow for proper presentation to never display intermediate state.
-	GetOnPostNetClientSynchronizationComplete().Broadcast(this);
+	// @gdemers systems may have finalized while the previous chunk was in flight. only the remaining delta is sent.
+	SendNetFinalizedChunk(false);
 }
 
 void AAVVMPlayerState::HandleSimulatedPlayerBackfilling()
@@ -20,7 +20,10 @@
 #include "AVVMPositionSamplerSubsystem.h"
 
 #include "AVVMCharacter.h"
-#include "EngineUtils.h"
+#include "AVVMGameplaySettings.h"
+#include "Components/SkeletalMeshComponent.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
 #include "Components/CapsuleComponent.h"
 #include "GameFramework/GameStateBase.h"
 #include "Kismet/GameplayStatics.h"
@@ -32,6 +35,248 @@ static FAutoConsoleVariableRef CEnablePositionSamplerSubsystem(TEXT("c.SetPositi
                                                                TEXT("0, or 1 for configuring the position sampler subsystem state"),
                                                                ECVF_Default);
 
+namespace NSAVVMPoseQuantization
+{
+	static constexpr double LocationPrecision = 32.0;
+	static constexpr int32 RotationBits = 20;
+	static constexpr uint64 RotationMask = ((1ull << RotationBits) - 1);
+	static constexpr double InvSqrt2 = 0.70710678118654752;
+
+	static int16 QuantizeLocation(const double Value)
+	{
+		return static_cast<int16>(FMath::Clamp<int64>(FMath::RoundToInt64(Value * LocationPrecision), MIN_int16, MAX_int16));
+	}
+
+	static double DequantizeLocation(const int16 Value)
+	{
+		return (static_cast<double>(Value) / LocationPrecision);
+	}
+
+	// @gdemers smallest three. the largest component is dropped, and rebuilt from the unit length constraint. remaining components
+	// are in range [-1/sqrt(2), 1/sqrt(2)].
+	static uint64 QuantizeRotation(const FQuat& Rotation)
+	{
+		const FQuat NormalizedRotation = Rotation.GetNormalized();
+		const double Components[4] = {NormalizedRotation.X, NormalizedRotation.Y, NormalizedRotation.Z, NormalizedRotation.W};
+
+		int32 LargestIndex = 0;
+		for (int32 i = 1; i < 4; ++i)
+		{
+			if (FMath::Abs(Components[i]) > FMath::Abs(Components[LargestIndex]))
+			{
+				LargestIndex = i;
+			}
+		}
+
+		// @gdemers q, and -q, are the same rotation. we flip so the dropped component is positive.
+		const double Sign = (Components[LargestIndex] < 0.0) ? -1.0 : 1.0;
+
+		uint64 OutRotation = static_cast<uint64>(LargestIndex);
+		int32 Shift = 2;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (i == LargestIndex)
+			{
+				continue;
+			}
+
+			const double Normalized = ((Components[i] * Sign / InvSqrt2) + 1.0) * 0.5;
+			const uint64 Quantized = static_cast<uint64>(FMath::Clamp<int64>(FMath::RoundToInt64(Normalized * RotationMask), 0, RotationMask));
+			OutRotation |= (Quantized << Shift);
+			Shift += RotationBits;
+		}
+
+		return OutRotation;
+	}
+
+	static FQuat DequantizeRotation(const uint64 Rotation)
+	{
+		const int32 LargestIndex = static_cast<int32>(Rotation & 0x3);
+
+		double Components[4];
+		double SumSquared = 0.0;
+		int32 Shift = 2;
+		for (int32 i = 0; i < 4; ++i)
+		{
+			if (i == LargestIndex)
+			{
+				continue;
+			}
+
+			const double Normalized = static_cast<double>((Rotation >> Shift) & RotationMask) / RotationMask;
+			Components[i] = ((Normalized * 2.0) - 1.0) * InvSqrt2;
+			SumSquared += (Components[i] * Components[i]);
+			Shift += RotationBits;
+		}
+
+		Components[LargestIndex] = FMath::Sqrt(FMath::Max(1.0 - SumSquared, 0.0));
+		return FQuat(Components[0], Components[1], Components[2], Components[3]).GetNormalized();
+	}
+}
+
+namespace NSAVVMTraceBatch
+{
+	static constexpr int32 NumLanes = 4;
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMCapsules is the set of candidate capsules, rewound at a single HitTime, as a structure-of-arrays padded to a
+	 *	multiple of NumLanes. Capsules are upright, and defined by the bottom of their segment, its height, and a radius.
+	 */
+	struct FAVVMCapsules
+	{
+		void Reset(const int32 NumCapsules)
+		{
+			const int32 NumPaddedCapsules = Align(NumCapsules, NumLanes);
+			BaseX.Reset(NumPaddedCapsules);
+			BaseY.Reset(NumPaddedCapsules);
+			BaseZ.Reset(NumPaddedCapsules);
+			Height.Reset(NumPaddedCapsules);
+			Radius.Reset(NumPaddedCapsules);
+			SlotIndices.Reset(NumPaddedCapsules);
+		}
+
+		void Add(const int32 SlotIndex, const double X, const double Y, const double Z, const double NewHeight, const double NewRadius)
+		{
+			BaseX.Add(X);
+			BaseY.Add(Y);
+			BaseZ.Add(Z);
+			Height.Add(NewHeight);
+			Radius.Add(NewRadius);
+			SlotIndices.Add(SlotIndex);
+		}
+
+		// @gdemers padding lanes have a negative radius, and never intersect.
+		void Pad()
+		{
+			while (!IsAligned(SlotIndices.Num(), NumLanes))
+			{
+				Add(INDEX_NONE, 0.0, 0.0, 0.0, 0.0, -UE_BIG_NUMBER);
+			}
+		}
+
+		int32 Num() const
+		{
+			return SlotIndices.Num();
+		}
+
+		TArray<double> BaseX;
+		TArray<double> BaseY;
+		TArray<double> BaseZ;
+		TArray<double> Height;
+		TArray<double> Radius;
+		TArray<int32> SlotIndices;
+	};
+
+	// @gdemers squared distance between a trace segment, and the segment of NumLanes capsules, starting at FirstLane. this is
+	// the clamped closest points between segments (Ericson, Real-Time Collision Detection, 5.1.9), made branchless. OutTraceTimes
+	// is the normalized position of the closest point along the trace.
+	static void ComputeSegmentDistances(const FAVVMCapsules& Capsules,
+	                                    const int32 FirstLane,
+	                                    const FVector& TraceStart,
+	                                    const FVector& TraceDirection,
+	                                    double* OutDistancesSquared,
+	                                    double* OutTraceTimes)
+	{
+		const VectorRegister4Double Zero = VectorZeroDouble();
+		const VectorRegister4Double One = VectorOneDouble();
+		const VectorRegister4Double Epsilon = VectorSetFloat1(UE_DOUBLE_SMALL_NUMBER);
+
+		// @gdemers D1 = (0, 0, H) is the capsule segment, D2 the trace segment, and R = P1 - P2 the offset between both starts.
+		const VectorRegister4Double H = VectorLoad(&Capsules.Height[FirstLane]);
+		const VectorRegister4Double Rx = VectorSubtract(VectorLoad(&Capsules.BaseX[FirstLane]), VectorSetFloat1(TraceStart.X));
+		const VectorRegister4Double Ry = VectorSubtract(VectorLoad(&Capsules.BaseY[FirstLane]), VectorSetFloat1(TraceStart.Y));
+		const VectorRegister4Double Rz = VectorSubtract(VectorLoad(&Capsules.BaseZ[FirstLane]), VectorSetFloat1(TraceStart.Z));
+		const VectorRegister4Double D2x = VectorSetFloat1(TraceDirection.X);
+		const VectorRegister4Double D2y = VectorSetFloat1(TraceDirection.Y);
+		const VectorRegister4Double D2z = VectorSetFloat1(TraceDirection.Z);
+
+		const VectorRegister4Double A = VectorMax(VectorMultiply(H, H), Epsilon);
+		const VectorRegister4Double B = VectorMultiply(H, D2z);
+		const VectorRegister4Double C = VectorMultiply(H, Rz);
+		const VectorRegister4Double E = VectorSetFloat1(FMath::Max(TraceDirection.SizeSquared(), UE_DOUBLE_SMALL_NUMBER));
+		const VectorRegister4Double F = VectorMultiplyAdd(D2x, Rx, VectorMultiplyAdd(D2y, Ry, VectorMultiply(D2z, Rz)));
+
+		// @gdemers closest point on infinite lines, clamped on the capsule, projected on the trace, and projected back on the capsule.
+		// parallel segments resolve to any valid pair.
+		const VectorRegister4Double Denominator = VectorMax(VectorSubtract(VectorMultiply(A, E), VectorMultiply(B, B)), Epsilon);
+		const VectorRegister4Double S0 = VectorMin(VectorMax(VectorDivide(VectorSubtract(VectorMultiply(B, F), VectorMultiply(C, E)), Denominator), Zero), One);
+		const VectorRegister4Double T = VectorMin(VectorMax(VectorDivide(VectorMultiplyAdd(B, S0, F), E), Zero), One);
+		const VectorRegister4Double S = VectorMin(VectorMax(VectorDivide(VectorSubtract(VectorMultiply(B, T), C), A), Zero), One);
+
+		const VectorRegister4Double Dx = VectorSubtract(Rx, VectorMultiply(D2x, T));
+		const VectorRegister4Double Dy = VectorSubtract(Ry, VectorMultiply(D2y, T));
+		const VectorRegister4Double Dz = VectorSubtract(VectorMultiplyAdd(H, S, Rz), VectorMultiply(D2z, T));
+
+		VectorStore(VectorMultiplyAdd(Dx, Dx, VectorMultiplyAdd(Dy, Dy, VectorMultiply(Dz, Dz))), OutDistancesSquared);
+		VectorStore(T, OutTraceTimes);
+	}
+
+	// @gdemers broad-phase. trace bounds, expanded by tolerance, against capsule bounds. whole blocks of NumLanes capsules are skipped.
+	static bool DoesBlockOverlap(const FAVVMCapsules& Capsules, const int32 FirstLane, const FBox& TraceBounds)
+	{
+		for (int32 Lane = FirstLane; Lane < (FirstLane + NumLanes); ++Lane)
+		{
+			const double Radius = Capsules.Radius[Lane];
+			const bool bDoesOverlap = (Capsules.BaseX[Lane] + Radius >= TraceBounds.Min.X) && (Capsules.BaseX[Lane] - Radius <= TraceBounds.Max.X) &&
+				(Capsules.BaseY[Lane] + Radius >= TraceBounds.Min.Y) && (Capsules.BaseY[Lane] - Radius <= TraceBounds.Max.Y) &&
+				(Capsules.BaseZ[Lane] + Capsules.Height[Lane] + Radius >= TraceBounds.Min.Z) && (Capsules.BaseZ[Lane] - Radius <= TraceBounds.Max.Z);
+
+			if (bDoesOverlap)
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
+	static void Trace(const FAVVMCapsules& Capsules,
+	                  const FAVVMTraceContextArgs& Params,
+	                  const int32 ClaimedSlotIndex,
+	                  int32& OutResolvedSlotIndex,
+	                  bool& bOutIsValidated)
+	{
+		OutResolvedSlotIndex = INDEX_NONE;
+		bOutIsValidated = false;
+
+		const FVector TraceDirection = (Params.TraceEnd - Params.TraceStart);
+		const FBox TraceBounds = FBox(FVector::Min(Params.TraceStart, Params.TraceEnd), FVector::Max(Params.TraceStart, Params.TraceEnd)).ExpandBy(FMath::Max(Params.Tolerance, 0.0));
+
+		double ClosestTraceTime = TNumericLimits<double>::Max();
+		double DistancesSquared[NumLanes];
+		double TraceTimes[NumLanes];
+
+		for (int32 FirstLane = 0; FirstLane < Capsules.Num(); FirstLane += NumLanes)
+		{
+			if (!DoesBlockOverlap(Capsules, FirstLane, TraceBounds))
+			{
+				continue;
+			}
+
+			ComputeSegmentDistances(Capsules, FirstLane, Params.TraceStart, TraceDirection, DistancesSquared, TraceTimes);
+
+			for (int32 i = 0; i < NumLanes; ++i)
+			{
+				const int32 Lane = (FirstLane + i);
+				const double Dist = FMath::Sqrt(DistancesSquared[i]) - Capsules.Radius[Lane];
+				if ((Capsules.SlotIndices[Lane] == INDEX_NONE) || (Dist >= Params.Tolerance))
+				{
+					continue;
+				}
+
+				bOutIsValidated |= (Capsules.SlotIndices[Lane] == ClaimedSlotIndex);
+				if (TraceTimes[i] < ClosestTraceTime)
+				{
+					ClosestTraceTime = TraceTimes[i];
+					OutResolvedSlotIndex = Capsules.SlotIndices[Lane];
+				}
+			}
+		}
+	}
+}
+
 bool UAVVMPositionSamplerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 {
 	const auto* World = Cast<UWorld>(Outer);
@@ -57,6 +302,12 @@ void UAVVMPositionSamplerSubsystem::Deinitialize()
 	Super::Deinitialize();
 
 	GameStateBase.Reset();
+	ActorToSlotIndex.Reset();
+	SlotCharacters.Reset();
+	SlotPoseHistoryIndices.Reset();
+	PoseHistories.Reset();
+	FreePoseHistoryIndices.Reset();
+	PositionHistory = FAVVMPositionHistory();
 }
 
 void UAVVMPositionSamplerSubsystem::Tick(float DeltaTime)
@@ -69,26 +320,28 @@ void UAVVMPositionSamplerSubsystem::Tick(float DeltaTime)
 		return;
 	}
 
-	for (TActorIterator<AAVVMCharacter> Iterator(GetWorld()); Iterator; ++Iterator)
+	const double SampleTimestamp = NewGameStateBase->GetServerWorldTimeSeconds();
+	for (int32 i = 0; i < SlotCharacters.Num(); ++i)
 	{
-		auto* Player = (*Iterator);
+		const AAVVMCharacter* Player = SlotCharacters[i].Get();
 		if (!IsValid(Player))
 		{
 			continue;
 		}
 
-		const auto* CapsuleComponent = (*Iterator)->GetCapsuleComponent();
+		const auto* CapsuleComponent = Player->GetCapsuleComponent();
 		if (!ensureAlwaysMsgf(IsValid(CapsuleComponent), TEXT("Collision Bounds are undefined on the server!")))
 		{
 			continue;
 		}
 
-		FAVVMPositionSample NewSample;
-		NewSample.SampleTimestamp = NewGameStateBase->GetServerWorldTimeSeconds();
-		NewSample.TransformExtent = FBoxCenterAndExtent(CapsuleComponent->Bounds);
+		PositionHistory.Sample(i, SampleTimestamp, CapsuleComponent->Bounds.Origin, CapsuleComponent->Bounds.BoxExtent);
 
-		FAVVMPositionSampler& PositionSampler = AuthoritativePositionSamplers.FindOrAdd(Player);
-		PositionSampler.Sample(NewSample);
+		const int32 PoseHistoryIndex = SlotPoseHistoryIndices[i];
+		if (PoseHistoryIndex != INDEX_NONE)
+		{
+			PoseHistories[PoseHistoryIndex].Sample(SampleTimestamp);
+		}
 	}
 }
 
@@ -105,17 +358,100 @@ FBoxCenterAndExtent UAVVMPositionSamplerSubsystem::Static_GetSampleExtent(const
 	return IsValid(Subsystem) ? Subsystem->GetSampleExtent(Target, Timestamp) : FBoxCenterAndExtent();
 }
 
+void UAVVMPositionSamplerSubsystem::Static_UnregisterCharacter(AAVVMCharacter* Character)
+{
+	auto* Subsystem = IsValid(Character) ? UAVVMPositionSamplerSubsystem::Get(Character->GetWorld()) : nullptr;
+	if (IsValid(Subsystem))
+	{
+		Subsystem->UnregisterCharacter(Character);
+	}
+}
+
+void UAVVMPositionSamplerSubsystem::Static_RegisterCharacter(AAVVMCharacter* Character)
+{
+	auto* Subsystem = IsValid(Character) ? UAVVMPositionSamplerSubsystem::Get(Character->GetWorld()) : nullptr;
+	if (IsValid(Subsystem))
+	{
+		Subsystem->RegisterCharacter(Character);
+	}
+}
+
+void UAVVMPositionSamplerSubsystem::Static_TraceBatch(const UWorld* World,
+                                                     const TArray<FAVVMTraceContextArgs>& Traces,
+                                                     TArray<FAVVMTraceResult>& OutResults)
+{
+	auto* Subsystem = UAVVMPositionSamplerSubsystem::Get(World);
+	if (IsValid(Subsystem))
+	{
+		Subsystem->TraceBatch(Traces, OutResults);
+	}
+	else
+	{
+		OutResults.Reset(Traces.Num());
+		OutResults.AddDefaulted(Traces.Num());
+	}
+}
+
+void UAVVMPositionSamplerSubsystem::Static_UnregisterPoseHistory(const AAVVMCharacter* Character)
+{
+	auto* Subsystem = IsValid(Character) ? UAVVMPositionSamplerSubsystem::Get(Character->GetWorld()) : nullptr;
+	if (!IsValid(Subsystem))
+	{
+		return;
+	}
+
+	const int32* SlotIndex = Subsystem->ActorToSlotIndex.Find(Character);
+	if (SlotIndex != nullptr)
+	{
+		Subsystem->UnregisterPoseHistory(*SlotIndex);
+	}
+}
+
+void UAVVMPositionSamplerSubsystem::Static_RegisterPoseHistory(AAVVMCharacter* Character)
+{
+	auto* Subsystem = IsValid(Character) ? UAVVMPositionSamplerSubsystem::Get(Character->GetWorld()) : nullptr;
+	if (IsValid(Subsystem))
+	{
+		Subsystem->RegisterPoseHistory(Character);
+	}
+}
+
+bool UAVVMPositionSamplerSubsystem::Static_DoesTraceIntersectPose(const UWorld* World,
+                                                                  const FAVVMTraceContextArgs& Params,
+                                                                  bool& bOutHasPoseHistory,
+                                                                  FName& OutBoneName)
+{
+	bOutHasPoseHistory = false;
+	OutBoneName = NAME_None;
+
+	auto* Subsystem = UAVVMPositionSamplerSubsystem::Get(World);
+	if (!IsValid(Subsystem))
+	{
+		return false;
+	}
+
+	const int32* SlotIndex = Subsystem->ActorToSlotIndex.Find(Params.HitActor);
+	const int32 PoseHistoryIndex = (SlotIndex != nullptr) ? Subsystem->SlotPoseHistoryIndices[*SlotIndex] : INDEX_NONE;
+	if (PoseHistoryIndex == INDEX_NONE)
+	{
+		return false;
+	}
+
+	bOutHasPoseHistory = true;
+	return Subsystem->PoseHistories[PoseHistoryIndex].DoesTraceIntersect(Params, OutBoneName);
+}
+
 UAVVMPositionSamplerSubsystem* UAVVMPositionSamplerSubsystem::Get(const UWorld* World)
 {
 	return UWorld::GetSubsystem<UAVVMPositionSamplerSubsystem>(World);
 }
 
-FBoxCenterAndExtent UAVVMPositionSamplerSubsystem::GetSampleExtent(const AActor* Target, const double Timestamp)
+FBoxCenterAndExtent UAVVMPositionSamplerSubsystem::GetSampleExtent(const AActor* Target, const double Timestamp) const
 {
-	const FAVVMPositionSampler* SearchResult = AuthoritativePositionSamplers.Find(Target);
+	const int32* SearchResult = ActorToSlotIndex.Find(Target);
 	if (SearchResult != nullptr)
 	{
-		return SearchResult->GetClosestSample(Timestamp);
+		return PositionHistory.GetClosestSample(*SearchResult, Timestamp);
 	}
 	else
 	{
@@ -123,54 +459,559 @@ FBoxCenterAndExtent UAVVMPositionSamplerSubsystem::GetSampleExtent(const AActor*
 	}
 }
 
-UAVVMPositionSamplerSubsystem::FAVVMPositionSampler::FAVVMPositionSampler()
+void UAVVMPositionSamplerSubsystem::UnregisterCharacter(const AActor* Character)
+{
+	int32 SlotIndex = INDEX_NONE;
+	if (ActorToSlotIndex.RemoveAndCopyValue(Character, SlotIndex))
+	{
+		UnregisterPoseHistory(SlotIndex);
+		SlotCharacters[SlotIndex].Reset();
+		PositionHistory.RemoveSlot(SlotIndex);
+	}
+}
+
+void UAVVMPositionSamplerSubsystem::RegisterCharacter(AAVVMCharacter* Character)
+{
+	if (ActorToSlotIndex.Contains(Character))
+	{
+		return;
+	}
+
+	const int32 SlotIndex = PositionHistory.AddSlot();
+	if (!SlotCharacters.IsValidIndex(SlotIndex))
+	{
+		SlotCharacters.SetNum(SlotIndex + 1);
+	}
+
+	while (!SlotPoseHistoryIndices.IsValidIndex(SlotIndex))
+	{
+		SlotPoseHistoryIndices.Add(INDEX_NONE);
+	}
+
+	SlotCharacters[SlotIndex] = Character;
+	ActorToSlotIndex.Add(Character, SlotIndex);
+}
+
+void UAVVMPositionSamplerSubsystem::TraceBatch(const TArray<FAVVMTraceContextArgs>& Traces, TArray<FAVVMTraceResult>& OutResults) const
+{
+	OutResults.Reset(Traces.Num());
+	OutResults.AddDefaulted(Traces.Num());
+
+	// @gdemers traces sharing a HitTime (i.e - pellets of a single shot) are grouped, so candidates are rewound once per group.
+	TArray<int32> TraceIndices;
+	TraceIndices.Reserve(Traces.Num());
+	for (int32 i = 0; i < Traces.Num(); ++i)
+	{
+		TraceIndices.Add(i);
+	}
+
+	TraceIndices.StableSort([&Traces](const int32 Lhs, const int32 Rhs)
+	{
+		return (Traces[Lhs].HitTime < Traces[Rhs].HitTime);
+	});
+
+	NSAVVMTraceBatch::FAVVMCapsules Capsules;
+
+	int32 GroupStart = 0;
+	while (GroupStart < TraceIndices.Num())
+	{
+		const double HitTime = Traces[TraceIndices[GroupStart]].HitTime;
+
+		int32 GroupEnd = (GroupStart + 1);
+		while ((GroupEnd < TraceIndices.Num()) && (Traces[TraceIndices[GroupEnd]].HitTime == HitTime))
+		{
+			++GroupEnd;
+		}
+
+		// @gdemers capsule reconstructed from the sample box, matching DoesTraceIntersectPositionSample.
+		Capsules.Reset(SlotCharacters.Num());
+		for (int32 SlotIndex = 0; SlotIndex < SlotCharacters.Num(); ++SlotIndex)
+		{
+			FVector Center;
+			FVector Extent;
+			if (SlotCharacters[SlotIndex].IsValid() && PositionHistory.TryGetClosestSample(SlotIndex, HitTime, Center, Extent))
+			{
+				Capsules.Add(SlotIndex, Center.X, Center.Y, Center.Z - Extent.Z, 2.0 * Extent.Z, Extent.X);
+			}
+		}
+
+		Capsules.Pad();
+
+		for (int32 i = GroupStart; i < GroupEnd; ++i)
+		{
+			const int32 TraceIndex = TraceIndices[i];
+			const FAVVMTraceContextArgs& Params = Traces[TraceIndex];
+			const int32* ClaimedSlotIndex = ActorToSlotIndex.Find(Params.HitActor);
+
+			int32 ResolvedSlotIndex = INDEX_NONE;
+			bool bIsValidated = false;
+			NSAVVMTraceBatch::Trace(Capsules, Params, (ClaimedSlotIndex != nullptr) ? *ClaimedSlotIndex : INDEX_NONE, ResolvedSlotIndex, bIsValidated);
+
+			FAVVMTraceResult& Result = OutResults[TraceIndex];
+			Result.ResolvedActor = (ResolvedSlotIndex != INDEX_NONE) ? SlotCharacters[ResolvedSlotIndex].Get() : nullptr;
+			Result.bIsValidated = bIsValidated;
+		}
+
+		GroupStart = GroupEnd;
+	}
+}
+
+void UAVVMPositionSamplerSubsystem::UnregisterPoseHistory(const int32 SlotIndex)
+{
+	const int32 PoseHistoryIndex = SlotPoseHistoryIndices[SlotIndex];
+	if (PoseHistoryIndex != INDEX_NONE)
+	{
+		PoseHistories[PoseHistoryIndex].Release();
+		FreePoseHistoryIndices.Add(PoseHistoryIndex);
+		SlotPoseHistoryIndices[SlotIndex] = INDEX_NONE;
+	}
+}
+
+void UAVVMPositionSamplerSubsystem::RegisterPoseHistory(AAVVMCharacter* Character)
+{
+	// @gdemers components begin play before their owner, so the character may not be registered yet.
+	RegisterCharacter(Character);
+
+	const int32 SlotIndex = ActorToSlotIndex.FindChecked(Character);
+	if (SlotPoseHistoryIndices[SlotIndex] != INDEX_NONE)
+	{
+		return;
+	}
+
+	const USkeletalMeshComponent* MeshComponent = Character->GetMesh();
+	if (!ensureAlwaysMsgf(IsValid(MeshComponent), TEXT("Pose history requires a skeletal mesh!")))
+	{
+		return;
+	}
+
+	const int32 MaxBodies = FMath::Clamp(UAVVMGameplaySettings::GetMaxHitboxBodiesPerCharacter(), 1, MAX_uint8);
+	const int32 SnapshotSize = (MaxBodies * sizeof(FAVVMQuantizedBoneTransform)) + sizeof(double) + sizeof(FVector) + sizeof(uint64) + sizeof(uint8);
+	const int32 Capacity = FMath::Max(UAVVMGameplaySettings::GetMaxPoseHistoryBytesPerCharacter() / SnapshotSize, 2);
+
+	const int32 PoseHistoryIndex = !FreePoseHistoryIndices.IsEmpty() ? FreePoseHistoryIndices.Pop(EAllowShrinking::No) : PoseHistories.AddDefaulted();
+	PoseHistories[PoseHistoryIndex].Init(MeshComponent, MaxBodies, Capacity);
+	SlotPoseHistoryIndices[SlotIndex] = PoseHistoryIndex;
+}
+
+int32 UAVVMPositionSamplerSubsystem::FAVVMPositionHistory::AddSlot()
+{
+	if (!FreeSlotIndices.IsEmpty())
+	{
+		return FreeSlotIndices.Pop(EAllowShrinking::No);
+	}
+
+	const int32 SlotIndex = HeadIndices.Add(0);
+	NumSamples.Add(0);
+	Timestamps.AddZeroed(SampleSize);
+	Centers.AddZeroed(SampleSize);
+	Extents.AddZeroed(SampleSize);
+	return SlotIndex;
+}
+
+void UAVVMPositionSamplerSubsystem::FAVVMPositionHistory::RemoveSlot(const int32 SlotIndex)
+{
+	HeadIndices[SlotIndex] = 0;
+	NumSamples[SlotIndex] = 0;
+	FreeSlotIndices.Add(SlotIndex);
+}
+
+void UAVVMPositionSamplerSubsystem::FAVVMPositionHistory::Sample(const int32 SlotIndex,
+                                                                 const double Timestamp,
+                                                                 const FVector& Center,
+                                                                 const FVector& Extent)
+{
+	// @gdemers timestamps have to remain monotonic for the binary search. a sample at the same server time replace the newest,
+	// and older samples are discarded.
+	int32& NumSlotSamples = NumSamples[SlotIndex];
+	if (NumSlotSamples > 0)
+	{
+		const int32 NewestSampleIndex = GetSampleIndex(SlotIndex, NumSlotSamples - 1);
+		if (Timestamp < Timestamps[NewestSampleIndex])
+		{
+			return;
+		}
+
+		if (Timestamp == Timestamps[NewestSampleIndex])
+		{
+			Centers[NewestSampleIndex] = Center;
+			Extents[NewestSampleIndex] = Extent;
+			return;
+		}
+	}
+
+	int32& HeadIndex = HeadIndices[SlotIndex];
+	const int32 SampleIndex = (SlotIndex * SampleSize) + HeadIndex;
+	Timestamps[SampleIndex] = Timestamp;
+	Centers[SampleIndex] = Center;
+	Extents[SampleIndex] = Extent;
+
+	HeadIndex = ((HeadIndex + 1) % SampleSize);
+	NumSlotSamples = FMath::Min(NumSlotSamples + 1, SampleSize);
+}
+
+FBoxCenterAndExtent UAVVMPositionSamplerSubsystem::FAVVMPositionHistory::GetClosestSample(const int32 SlotIndex, const double Timestamp) const
+{
+	FVector Center;
+	FVector Extent;
+	if (!ensureAlways(TryGetClosestSample(SlotIndex, Timestamp, Center, Extent)))
+	{
+		return FBoxCenterAndExtent();
+	}
+
+	return FBoxCenterAndExtent(Center, Extent);
+}
+
+bool UAVVMPositionSamplerSubsystem::FAVVMPositionHistory::TryGetClosestSample(const int32 SlotIndex,
+                                                                              const double Timestamp,
+                                                                              FVector& OutCenter,
+                                                                              FVector& OutExtent) const
+{
+	const int32 NumSlotSamples = NumSamples[SlotIndex];
+	if (NumSlotSamples == 0)
+	{
+		return false;
+	}
+
+	const bool bIsOlderThanHistory = (Timestamp < Timestamps[GetSampleIndex(SlotIndex, 0)]);
+	const bool bIsNewerThanHistory = (Timestamp > Timestamps[GetSampleIndex(SlotIndex, NumSlotSamples - 1)]);
+	if (bIsOlderThanHistory || bIsNewerThanHistory)
+	{
+		return false;
+	}
+
+	// @gdemers lower bound. first sample with a timestamp greater, or equal, to the requested one.
+	int32 First = 0;
+	int32 Count = NumSlotSamples;
+	while (Count > 0)
+	{
+		const int32 Step = (Count / 2);
+		const int32 Middle = (First + Step);
+		if (Timestamps[GetSampleIndex(SlotIndex, Middle)] < Timestamp)
+		{
+			First = (Middle + 1);
+			Count -= (Step + 1);
+		}
+		else
+		{
+			Count = Step;
+		}
+	}
+
+	const int32 UpperBoundIndex = GetSampleIndex(SlotIndex, First);
+	const int32 LowerBoundIndex = GetSampleIndex(SlotIndex, FMath::Max(First - 1, 0));
+
+	const double LowerTimestamp = Timestamps[LowerBoundIndex];
+	const double UpperTimestamp = Timestamps[UpperBoundIndex];
+	if ((Timestamp == UpperTimestamp) || (UpperTimestamp <= LowerTimestamp))
+	{
+		OutCenter = Centers[UpperBoundIndex];
+		OutExtent = Extents[UpperBoundIndex];
+		return true;
+	}
+
+	const double NormalizedDelta = (Timestamp - LowerTimestamp) / (UpperTimestamp - LowerTimestamp);
+	OutCenter = Centers[LowerBoundIndex] + ((Centers[UpperBoundIndex] - Centers[LowerBoundIndex]) * NormalizedDelta);
+	OutExtent = Extents[LowerBoundIndex];
+	return true;
+}
+
+int32 UAVVMPositionSamplerSubsystem::FAVVMPositionHistory::GetSampleIndex(const int32 SlotIndex, const int32 LogicalIndex) const
+{
+	const int32 OldestIndex = (HeadIndices[SlotIndex] - NumSamples[SlotIndex] + SampleSize);
+	return (SlotIndex * SampleSize) + ((OldestIndex + LogicalIndex) % SampleSize);
+}
+
+void UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::Init(const USkeletalMeshComponent* NewMeshComponent,
+                                                           const int32 NewMaxBodies,
+                                                           const int32 NewCapacity)
+{
+	MeshComponent = NewMeshComponent;
+	MaxBodies = NewMaxBodies;
+	Capacity = NewCapacity;
+	HeadIndex = 0;
+	NumSnapshots = 0;
+
+	// @gdemers SetNum keep the allocation of a pooled history, when the budget didn't change.
+	Timestamps.SetNumUninitialized(Capacity);
+	ComponentLocations.SetNumUninitialized(Capacity);
+	ComponentRotations.SetNumUninitialized(Capacity);
+	PoseBodiesIndices.SetNumUninitialized(Capacity);
+	BoneTransforms.SetNumUninitialized(Capacity * MaxBodies);
+}
+
+void UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::Release()
+{
+	MeshComponent.Reset();
+	PoseBodies.Reset();
+	HeadIndex = 0;
+	NumSnapshots = 0;
+}
+
+void UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::Sample(const double Timestamp)
+{
+	const USkeletalMeshComponent* NewMeshComponent = MeshComponent.Get();
+	if (!IsValid(NewMeshComponent))
+	{
+		return;
+	}
+
+	if ((NumSnapshots > 0) && (Timestamp <= Timestamps[GetSnapshotIndex(NumSnapshots - 1)]))
+	{
+		return;
+	}
+
+	const int32 PoseBodiesIndex = FindOrAddBodies(NewMeshComponent->GetPhysicsAsset());
+	if (PoseBodiesIndex == INDEX_NONE)
+	{
+		return;
+	}
+
+	Timestamps[HeadIndex] = Timestamp;
+	PoseBodiesIndices[HeadIndex] = static_cast<uint8>(PoseBodiesIndex);
+	SetComponentTransform(HeadIndex, NewMeshComponent->GetComponentTransform());
+
+	const TArray<FTransform>& ComponentSpaceTransforms = NewMeshComponent->GetComponentSpaceTransforms();
+	const TArray<int32>& BoneIndices = PoseBodies[PoseBodiesIndex].BoneIndices;
+	for (int32 i = 0; i < BoneIndices.Num(); ++i)
+	{
+		const FTransform& BoneTransform = ComponentSpaceTransforms.IsValidIndex(BoneIndices[i]) ? ComponentSpaceTransforms[BoneIndices[i]] : FTransform::Identity;
+		SetBoneTransform(HeadIndex, i, BoneTransform);
+	}
+
+	HeadIndex = ((HeadIndex + 1) % Capacity);
+	NumSnapshots = FMath::Min(NumSnapshots + 1, Capacity);
+}
+
+bool UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::DoesTraceIntersect(const FAVVMTraceContextArgs& Params, FName& OutBoneName) const
 {
-	static constexpr int32 SampleSize = 100;
-	Samples.Init(FAVVMPositionSample(), SampleSize);
+	OutBoneName = NAME_None;
+
+	FAVVMPoseRewind Rewind;
+	if (!TryRewind(Params.HitTime, Rewind))
+	{
+		return false;
+	}
+
+	const FAVVMPoseBodies& Bodies = PoseBodies[PoseBodiesIndices[Rewind.UpperSnapshotIndex]];
+	const UPhysicsAsset* PhysicsAsset = Bodies.PhysicsAsset.Get();
+	if (!IsValid(PhysicsAsset))
+	{
+		return false;
+	}
+
+	const FTransform ComponentTransform = GetRewoundComponentTransform(Rewind);
+
+	const FVector TraceDirection = (Params.TraceEnd - Params.TraceStart);
+	double ClosestDistance = TNumericLimits<double>::Max();
+
+	for (int32 i = 0; i < Bodies.BodySetupIndices.Num(); ++i)
+	{
+		const USkeletalBodySetup* BodySetup = PhysicsAsset->SkeletalBodySetups.IsValidIndex(Bodies.BodySetupIndices[i]) ? PhysicsAsset->SkeletalBodySetups[Bodies.BodySetupIndices[i]].Get() : nullptr;
+		if (!IsValid(BodySetup))
+		{
+			continue;
+		}
+
+		const FTransform BoneToWorld = (GetRewoundBoneTransform(Rewind, i) * ComponentTransform);
+
+		// @gdemers track the intersection closest to the trace start, so the reported bone is the first one hit.
+		auto TryIntersect = [&](const double Distance, const FVector& ClosestPointOnTrace)
+		{
+			const double DistanceFromStart = FVector::DistSquared(ClosestPointOnTrace, Params.TraceStart);
+			if ((Distance < Params.Tolerance) && (DistanceFromStart < ClosestDistance))
+			{
+				ClosestDistance = DistanceFromStart;
+				OutBoneName = BodySetup->BoneName;
+			}
+		};
+
+		for (const FKSphylElem& SphylElem : BodySetup->AggGeom.SphylElems)
+		{
+			const FTransform ElemToWorld = (SphylElem.GetTransform() * BoneToWorld);
+			const FVector A1 = ElemToWorld.TransformPosition(FVector(0.0, 0.0, -SphylElem.Length * 0.5));
+			const FVector B1 = ElemToWorld.TransformPosition(FVector(0.0, 0.0, SphylElem.Length * 0.5));
+
+			FVector P1, P2;
+			FMath::SegmentDistToSegment(A1, B1, Params.TraceStart, Params.TraceEnd, P1, P2);
+			TryIntersect((P2 - P1).Size() - SphylElem.Radius, P2);
+		}
+
+		for (const FKSphereElem& SphereElem : BodySetup->AggGeom.SphereElems)
+		{
+			const FVector Center = BoneToWorld.TransformPosition(SphereElem.Center);
+			const FVector ClosestPoint = FMath::ClosestPointOnSegment(Center, Params.TraceStart, Params.TraceEnd);
+			TryIntersect(FVector::Dist(ClosestPoint, Center) - SphereElem.Radius, ClosestPoint);
+		}
+
+		for (const FKBoxElem& BoxElem : BodySetup->AggGeom.BoxElems)
+		{
+			const FTransform ElemToWorld = (BoxElem.GetTransform() * BoneToWorld);
+			const FVector LocalStart = ElemToWorld.InverseTransformPosition(Params.TraceStart);
+			const FVector LocalEnd = ElemToWorld.InverseTransformPosition(Params.TraceEnd);
+			const FBox LocalBox = FBox(FVector(BoxElem.X, BoxElem.Y, BoxElem.Z) * -0.5, FVector(BoxElem.X, BoxElem.Y, BoxElem.Z) * 0.5).ExpandBy(FMath::Max(Params.Tolerance, 0.0));
+			if (FMath::LineBoxIntersection(LocalBox, LocalStart, LocalEnd, LocalEnd - LocalStart))
+			{
+				TryIntersect(-UE_BIG_NUMBER, FMath::ClosestPointOnSegment(ElemToWorld.GetLocation(), Params.TraceStart, Params.TraceEnd));
+			}
+		}
+	}
+
+	return (OutBoneName != NAME_None);
 }
 
-FBoxCenterAndExtent UAVVMPositionSamplerSubsystem::FAVVMPositionSampler::GetClosestSample(const double Timestamp) const
+int32 UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::FindOrAddBodies(const UPhysicsAsset* PhysicsAsset)
 {
-	const FAVVMPositionSample* ClosestLowerBound = nullptr;
-	const FAVVMPositionSample* ClosestUpperBound = nullptr;
+	if (!IsValid(PhysicsAsset))
+	{
+		return INDEX_NONE;
+	}
+
+	const int32 PoseBodiesIndex = PoseBodies.IndexOfByPredicate([PhysicsAsset](const FAVVMPoseBodies& Bodies)
+	{
+		return (Bodies.PhysicsAsset == PhysicsAsset);
+	});
+
+	if (PoseBodiesIndex != INDEX_NONE)
+	{
+		return PoseBodiesIndex;
+	}
 
-	for (int32 i = 0; i < Samples.Num(); ++i)
+	// @gdemers snapshots reference their bodies by index. dropping bodies invalidate the whole history.
+	if (PoseBodies.Num() >= MaxPoseBodies)
 	{
-		const FAVVMPositionSample& CurrSample = Samples[i];
-		if ((CurrSample.SampleTimestamp <= Timestamp) && ((ClosestLowerBound == nullptr) || (ClosestLowerBound->SampleTimestamp < CurrSample.SampleTimestamp)))
+		PoseBodies.Reset();
+		HeadIndex = 0;
+		NumSnapshots = 0;
+	}
+
+	const USkeletalMeshComponent* NewMeshComponent = MeshComponent.Get();
+
+	FAVVMPoseBodies& NewPoseBodies = PoseBodies.AddDefaulted_GetRef();
+	NewPoseBodies.PhysicsAsset = PhysicsAsset;
+
+	const int32 NumBodies = FMath::Min(PhysicsAsset->SkeletalBodySetups.Num(), MaxBodies);
+	for (int32 i = 0; i < NumBodies; ++i)
+	{
+		const USkeletalBodySetup* BodySetup = PhysicsAsset->SkeletalBodySetups[i].Get();
+		const int32 BoneIndex = IsValid(BodySetup) ? NewMeshComponent->GetBoneIndex(BodySetup->BoneName) : INDEX_NONE;
+		if (BoneIndex != INDEX_NONE)
 		{
-			ClosestLowerBound = &CurrSample;
+			NewPoseBodies.BodySetupIndices.Add(i);
+			NewPoseBodies.BoneIndices.Add(BoneIndex);
 		}
+	}
 
-		if ((CurrSample.SampleTimestamp >= Timestamp) && ((ClosestUpperBound == nullptr) || (ClosestUpperBound->SampleTimestamp > CurrSample.SampleTimestamp)))
+	return (PoseBodies.Num() - 1);
+}
+
+int32 UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::GetSnapshotIndex(const int32 LogicalIndex) const
+{
+	return ((HeadIndex - NumSnapshots + Capacity + LogicalIndex) % Capacity);
+}
+
+bool UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::TryRewind(const double Timestamp, FAVVMPoseRewind& OutRewind) const
+{
+	if ((NumSnapshots == 0) ||
+		(Timestamp < Timestamps[GetSnapshotIndex(0)]) ||
+		(Timestamp > Timestamps[GetSnapshotIndex(NumSnapshots - 1)]))
+	{
+		return false;
+	}
+
+	// @gdemers lower bound. first snapshot with a timestamp greater, or equal, to the requested one.
+	int32 First = 0;
+	int32 Count = NumSnapshots;
+	while (Count > 0)
+	{
+		const int32 Step = (Count / 2);
+		const int32 Middle = (First + Step);
+		if (Timestamps[GetSnapshotIndex(Middle)] < Timestamp)
+		{
+			First = (Middle + 1);
+			Count -= (Step + 1);
+		}
+		else
 		{
-			ClosestUpperBound = &CurrSample;
+			Count = Step;
 		}
 	}
 
-	FBoxCenterAndExtent Result;
-	if (!ensureAlways(ClosestLowerBound != nullptr) || !ensureAlways(ClosestUpperBound != nullptr))
+	OutRewind.UpperSnapshotIndex = GetSnapshotIndex(First);
+	OutRewind.LowerSnapshotIndex = GetSnapshotIndex(FMath::Max(First - 1, 0));
+
+	// @gdemers bone transforms are interpolated between snapshots recorded with the same physics asset. otherwise, we snap to the upper one.
+	const double LowerTimestamp = Timestamps[OutRewind.LowerSnapshotIndex];
+	const double UpperTimestamp = Timestamps[OutRewind.UpperSnapshotIndex];
+	OutRewind.bCanInterpolate = (UpperTimestamp > LowerTimestamp) && (PoseBodiesIndices[OutRewind.LowerSnapshotIndex] == PoseBodiesIndices[OutRewind.UpperSnapshotIndex]);
+	OutRewind.Alpha = OutRewind.bCanInterpolate ? FMath::Clamp((Timestamp - LowerTimestamp) / (UpperTimestamp - LowerTimestamp), 0.0, 1.0) : 1.0;
+	return true;
+}
+
+FTransform UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::GetBoneTransform(const int32 SnapshotIndex, const int32 BodyIndex) const
+{
+	const FAVVMQuantizedBoneTransform& QuantizedBoneTransform = BoneTransforms[(SnapshotIndex * MaxBodies) + BodyIndex];
+	const FVector Location = FVector(NSAVVMPoseQuantization::DequantizeLocation(QuantizedBoneTransform.Location[0]),
+	                                 NSAVVMPoseQuantization::DequantizeLocation(QuantizedBoneTransform.Location[1]),
+	                                 NSAVVMPoseQuantization::DequantizeLocation(QuantizedBoneTransform.Location[2]));
+
+	return FTransform(NSAVVMPoseQuantization::DequantizeRotation(QuantizedBoneTransform.Rotation), Location);
+}
+
+FTransform UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::GetComponentTransform(const int32 SnapshotIndex) const
+{
+	return FTransform(NSAVVMPoseQuantization::DequantizeRotation(ComponentRotations[SnapshotIndex]), ComponentLocations[SnapshotIndex]);
+}
+
+FTransform UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::GetRewoundBoneTransform(const FAVVMPoseRewind& Rewind, const int32 BodyIndex) const
+{
+	FTransform BoneTransform = GetBoneTransform(Rewind.UpperSnapshotIndex, BodyIndex);
+	if (Rewind.bCanInterpolate)
 	{
-		return Result;
+		BoneTransform.BlendWith(GetBoneTransform(Rewind.LowerSnapshotIndex, BodyIndex), 1.0 - Rewind.Alpha);
 	}
 
-	const double NormalizedDelta = (Timestamp - ClosestLowerBound->SampleTimestamp) / (ClosestUpperBound->SampleTimestamp - ClosestLowerBound->SampleTimestamp);
-	const FVector NewOrigin = ClosestLowerBound->TransformExtent.Center + ((ClosestUpperBound->TransformExtent.Center - ClosestLowerBound->TransformExtent.Center) * NormalizedDelta);
-	Result = FBoxCenterAndExtent(NewOrigin, ClosestLowerBound->TransformExtent.Extent);
+	return BoneTransform;
+}
+
+FTransform UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::GetRewoundComponentTransform(const FAVVMPoseRewind& Rewind) const
+{
+	FTransform ComponentTransform = GetComponentTransform(Rewind.UpperSnapshotIndex);
+	if (Rewind.bCanInterpolate)
+	{
+		ComponentTransform.BlendWith(GetComponentTransform(Rewind.LowerSnapshotIndex), 1.0 - Rewind.Alpha);
+	}
 
-	return Result;
+	return ComponentTransform;
 }
 
-void UAVVMPositionSamplerSubsystem::FAVVMPositionSampler::Sample(const FAVVMPositionSample& NewSample)
+void UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::SetBoneTransform(const int32 SnapshotIndex,
+                                                                       const int32 BodyIndex,
+                                                                       const FTransform& BoneTransform)
 {
-	Samples[CurrSampleIndex] = NewSample;
-	CurrSampleIndex = ((CurrSampleIndex + 1) % Samples.Num());
+	const FVector BoneLocation = BoneTransform.GetLocation();
+
+	FAVVMQuantizedBoneTransform& QuantizedBoneTransform = BoneTransforms[(SnapshotIndex * MaxBodies) + BodyIndex];
+	QuantizedBoneTransform.Rotation = NSAVVMPoseQuantization::QuantizeRotation(BoneTransform.GetRotation());
+	QuantizedBoneTransform.Location[0] = NSAVVMPoseQuantization::QuantizeLocation(BoneLocation.X);
+	QuantizedBoneTransform.Location[1] = NSAVVMPoseQuantization::QuantizeLocation(BoneLocation.Y);
+	QuantizedBoneTransform.Location[2] = NSAVVMPoseQuantization::QuantizeLocation(BoneLocation.Z);
+}
+
+void UAVVMPositionSamplerSubsystem::FAVVMPoseHistory::SetComponentTransform(const int32 SnapshotIndex, const FTransform& ComponentTransform)
+{
+	ComponentLocations[SnapshotIndex] = ComponentTransform.GetLocation();
+	ComponentRotations[SnapshotIndex] = NSAVVMPoseQuantization::QuantizeRotation(ComponentTransform.GetRotation());
 }
 
 bool UAVVMTraceUtils::DoesTraceIntersectPositionSample(const UWorld* World, const FAVVMTraceContextArgs& Params)
 {
-	bool bResult = false;
 	const FBoxCenterAndExtent BoxExtentAtTime = UAVVMPositionSamplerSubsystem::Static_GetSampleExtent(World, Params.HitActor, Params.HitTime);
+	return DoesTraceIntersectSample(BoxExtentAtTime, Params);
+}
+
+bool UAVVMTraceUtils::DoesTraceIntersectSample(const FBoxCenterAndExtent& BoxExtentAtTime, const FAVVMTraceContextArgs& Params)
+{
+	bool bResult = false;
 	const FVector A1 = BoxExtentAtTime.Center - FVector(0, 0, BoxExtentAtTime.Extent.Z);
 	const FVector B1 = BoxExtentAtTime.Center + FVector(0, 0, BoxExtentAtTime.Extent.Z);
 
@@ -188,3 +1029,17 @@ bool UAVVMTraceUtils::DoesTraceIntersectPositionSample(const UWorld* World, cons
 
 	return bResult;
 }
+
+void UAVVMTraceUtils::DoTracesIntersectPositionSamples(const UWorld* World,
+                                                       const TArray<FAVVMTraceContextArgs>& Params,
+                                                       TArray<FAVVMTraceResult>& OutResults)
+{
+	UAVVMPositionSamplerSubsystem::Static_TraceBatch(World, Params, OutResults);
+}
+
+bool UAVVMTraceUtils::DoesTraceIntersectPoseSample(const UWorld* World, const FAVVMTraceContextArgs& Params, FName& OutBoneName)
+{
+	bool bHasPoseHistory = false;
+	const bool bResult = UAVVMPositionSamplerSubsystem::Static_DoesTraceIntersectPose(World, Params, bHasPoseHistory, OutBoneName);
+	return bHasPoseHistory ? bResult : DoesTraceIntersectPositionSample(World, Params);
+}
@@ -24,7 +24,13 @@
 #include "AVVMToolkitUtils.h"
 #include "AVVMWorldSetting.h"
 #include "NativeGameplayTags.h"
+#include "Async/ParallelFor.h"
 #include "TimerManager.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include "ProfilingDebugging/CsvProfiler.h"
+#include "Stats/Stats.h"
 
 // @gdemers WARNING : Careful about Server-Client mismatch. Server grants tags so this module has to be available there.
 UE_DEFINE_GAMEPLAY_TAG(TAG_WORLD_RULE_TICK_SCHEDULING, "WorldRule.TickScheduling");
@@ -36,6 +42,38 @@ static FAutoConsoleVariableRef CEnableTickSchedulerSubsystem(TEXT("c.SetTickSche
                                                              TEXT("0, or 1 for configuring the tick scheduler subsystem state"),
                                                              ECVF_Default);
 
+DECLARE_STATS_GROUP(TEXT("AVVMTickScheduler"), STATGROUP_AVVMTickScheduler, STATCAT_Advanced);
+DECLARE_CYCLE_STAT(TEXT("Parallel Lane"), STAT_AVVMTickScheduler_ParallelLane, STATGROUP_AVVMTickScheduler);
+DECLARE_CYCLE_STAT(TEXT("Serial Lane"), STAT_AVVMTickScheduler_SerialLane, STATGROUP_AVVMTickScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Entities Ticked"), STAT_AVVMTickScheduler_NumTicked, STATGROUP_AVVMTickScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Entities Deferred"), STAT_AVVMTickScheduler_NumDeferred, STATGROUP_AVVMTickScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Demotions"), STAT_AVVMTickScheduler_NumDemotions, STATGROUP_AVVMTickScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Promotions"), STAT_AVVMTickScheduler_NumPromotions, STATGROUP_AVVMTickScheduler);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Parallel Entities Ticked"), STAT_AVVMTickScheduler_NumParallelTicked, STATGROUP_AVVMTickScheduler);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Nanoseconds Per Entity"), STAT_AVVMTickScheduler_NanosecondsPerEntity, STATGROUP_AVVMTickScheduler);
+DECLARE_FLOAT_COUNTER_STAT(TEXT("Frame Budget Consumed"), STAT_AVVMTickScheduler_FrameBudgetConsumed, STATGROUP_AVVMTickScheduler);
+
+CSV_DEFINE_CATEGORY(AVVMTickScheduler, true);
+
+namespace NSAVVMTickScheduler
+{
+	void ExecuteTick(AActor* Actor, const float DeltaTime)
+	{
+		Actor->Tick(DeltaTime);
+	}
+
+	void ExecuteTick(UActorComponent* ActorComponent, const float DeltaTime)
+	{
+		ActorComponent->TickComponent(DeltaTime, ELevelTick::LEVELTICK_All, nullptr);
+	}
+
+#if CSV_PROFILER
+	// @gdemers csv stat names are expected to be string literals.
+	static const char* const CsvLevelNumTicked[] = {"Level0_NumTicked", "Level1_NumTicked", "Level2_NumTicked", "Level3_NumTicked"};
+	static const char* const CsvLevelNumDeferred[] = {"Level0_NumDeferred", "Level1_NumDeferred", "Level2_NumDeferred", "Level3_NumDeferred"};
+#endif
+}
+
 bool UAVVMTickScheduler::ShouldCreateSubsystem(UObject* Outer) const
 {
 	const auto* World = Cast<UWorld>(Outer);
@@ -70,174 +108,105 @@ void UAVVMTickScheduler::Deinitialize()
 
 void UAVVMTickScheduler::Tick(float DeltaTime)
 {
-	// @gdemers entries subject to priority changes.
-	TArray<FAVVMJobQueue> LongRunningJobs;
-	LongRunningJobs.Reserve(MultiLevelFeedbackQueue.PriorityQueue.Num());
+	TRACE_CPUPROFILER_EVENT_SCOPE(UAVVMTickScheduler::Tick);
+	CSV_SCOPED_TIMING_STAT(AVVMTickScheduler, Tick);
+
+	// @gdemers IMPORTANT : Reset, and not Empty. counters cover the last frame only.
+	LevelCounters.Reset();
+	LevelCounters.SetNumZeroed(MultiLevelFeedbackQueue.PriorityQueue.Num());
+	ParallelLaneCounters = FAVVMTickSchedulerCounters();
 
 	// @gdemers we ensure that any addition/removal during the frame won't conflict with existing entry during our tick.
-	TArray<FAVVMJobQueue> TempJobQueue = MoveTemp(MultiLevelFeedbackQueue.PriorityQueue);
-	int32 NextPriorityLevel = 0;
+	// Those are deferred, and flushed once all jobs executed.
+	bIsTicking = true;
+
+	// @gdemers entities receive the time elapsed since they last ticked, and not the frame delta time. world time
+	// account for time dilation, and pause.
+	const UWorld* World = GetWorld();
+	const double WorldTime = IsValid(World) ? World->GetTimeSeconds() : 0.0;
+
+	// @gdemers parallel lane isn't preempted. it run first, and joins before the serial lane begins.
+	{
+		SCOPE_CYCLE_COUNTER(STAT_AVVMTickScheduler_ParallelLane);
+		const double ParallelLaneBegin = FPlatformTime::Seconds();
+		ExecuteParallelLane(WorldTime);
+		ParallelLaneSeconds = (FPlatformTime::Seconds() - ParallelLaneBegin);
+	}
+
+	SCOPE_CYCLE_COUNTER(STAT_AVVMTickScheduler_SerialLane);
 
 	// @gdemers timestamp tick begin.
 	const double TickBegin = FPlatformTime::Seconds();
 
-	// @gdemers go over all priority level, starting at highest (i.e - 0). 
-	for (auto JobQueueIterator = TempJobQueue.CreateIterator(); JobQueueIterator; ++JobQueueIterator)
+	// @gdemers fair-share. each runner is granted a portion of the remaining frame budget, proportional to the number
+	// of entities it owns. budget left unused by a runner rolls over to the next.
+	int32 RemainingEntities = MultiLevelFeedbackQueue.GetNumSerialEntities();
+	auto GetFairShareBudget = [this, TickBegin, &RemainingEntities](const int32 NumEntities)
 	{
-		// @gdemers clamp index.
-		NextPriorityLevel = FMath::Clamp(NextPriorityLevel + 1, 0, TempJobQueue.Num() - 1);
-
-		// @gdemers execute tick on all actors of class.
-		for (auto& [Class, Runner_Actor] : JobQueueIterator->Jobs_Actor)
+		// @gdemers a TickRate of 0, or less, leave the serial lane unbounded (i.e - rule, and console override default).
+		if (TickRate <= 0.f)
 		{
-			if (Runner_Actor.Entities.IsEmpty())
-			{
-				continue;
-			}
+			return MAX_dbl;
+		}
 
-			// @gdemers timestamp before executing job.
-			const double Before = FPlatformTime::Seconds();
+		const double RemainingBudget = FMath::Max(0.0, TickRate - (FPlatformTime::Seconds() - TickBegin));
+		const double Budget = (RemainingEntities > 0) ? (RemainingBudget * NumEntities / RemainingEntities) : 0.0;
+		RemainingEntities -= NumEntities;
+		return Budget;
+	};
 
-			// @gdemers run job for the given actor type. our expectation is that the tick process
-			// is small enough to keep this actor type at the highest level of priority.
-			for (auto Iterator = Runner_Actor.Entities.CreateIterator(); Iterator; ++Iterator)
-			{
-				AActor* Actor = Iterator->Get();
-				if (!IsValid(Actor))
-				{
-					Iterator.RemoveCurrentSwap();
-					continue;
-				}
-
-				Actor->Tick(DeltaTime);
-
-				// @gdemers timestamp after executing job.
-				const double Now = FPlatformTime::Seconds();
-
-				// @gdemers was the job longer than the allotment defined by user, and should we
-				// lower our priority due to long-running job.
-				const bool bWasLongRunningProcess = ((Now - Before) > GlobalJobAllotment);
-				if (bWasLongRunningProcess)
-				{
-					// @gdemers we already ticked our actor, the next index was skipped. we need to swap entries to ensure all actors will eventually update.
-					// if not now, on next frame,
-					const int32 NextIndex = ((Iterator.GetIndex() + 1) % Runner_Actor.Entities.Num());
-					Algo::Rotate(Runner_Actor.Entities, NextIndex);
-
-					// @gdemers ensure execution ordering, preventing Move semantic to be discarded by compiler when doing argument inlining.
-					TArray<TWeakObjectPtr<AActor>> TempActors = MoveTemp(Runner_Actor.Entities);
-					LongRunningJobs[NextPriorityLevel].Append(Class.Get(), TempActors);
-					break;
-				}
-			}
+	// @gdemers go over all priority level, starting at highest (i.e - 0). we no longer break out once the frame budget
+	// is exhausted, runners only tick entities that reached the max staleness past that point.
+	for (int32 PriorityLevel = 0; PriorityLevel < MultiLevelFeedbackQueue.PriorityQueue.Num(); ++PriorityLevel)
+	{
+		const FAVVMJobQueue& JobQueue = MultiLevelFeedbackQueue.PriorityQueue[PriorityLevel];
+
+		// @gdemers execute tick on all actors of class. our expectation is that the tick process
+		// is small enough to keep this actor type at the highest level of priority.
+		for (const int32 RunnerIndex : JobQueue.Jobs_Actor)
+		{
+			FAVVMRunner_Actor& Runner = MultiLevelFeedbackQueue.Runners_Actor[RunnerIndex];
+			ExecuteRunner(Runner, WorldTime, GetFairShareBudget(Runner.Entities.Num()));
+			EvaluatePriorityLevel(Runner, RunnerIndex, false);
 		}
 
 		// @gdemers component may require to react to actor position updates, and are bound to actor so
 		// they should be updated after the actor.
 		// Note : Ticking dependent components shouldnt be required right after parent updates. Otherwise, we suffer hops that counter-effect
 		// the optimization in place.
-		for (auto& [Class, Runner_ActorComponent] : JobQueueIterator->Jobs_ActorComponent)
+		for (const int32 RunnerIndex : JobQueue.Jobs_ActorComponent)
 		{
-			if (Runner_ActorComponent.Entities.IsEmpty())
-			{
-				continue;
-			}
-
-			const double Before = FPlatformTime::Seconds();
-
-			for (auto Iterator = Runner_ActorComponent.Entities.CreateIterator(); Iterator; ++Iterator)
-			{
-				UActorComponent* Component = Iterator->Get();
-				if (!IsValid(Component))
-				{
-					Iterator.RemoveCurrentSwap();
-					continue;
-				}
-
-				Component->TickComponent(DeltaTime, ELevelTick::LEVELTICK_All, nullptr);
-
-				const double Now = FPlatformTime::Seconds();
-
-				const bool bWasLongRunningProcess = ((Now - Before) > GlobalJobAllotment);
-				if (bWasLongRunningProcess)
-				{
-					const int32 NextIndex = ((Iterator.GetIndex() + 1) % Runner_ActorComponent.Entities.Num());
-					Algo::Rotate(Runner_ActorComponent.Entities, NextIndex);
-
-					TArray<TWeakObjectPtr<UActorComponent>> TempActorComponents = MoveTemp(Runner_ActorComponent.Entities);
-					LongRunningJobs[NextPriorityLevel].Append(Class.Get(), TempActorComponents);
-					break;
-				}
-			}
-		}
-
-		// @gdemers we may want to split processing our tick data over multiple frame to ensure more consistent frame rate.
-		const double TickNow = FPlatformTime::Seconds();
-		const bool bWasLongTick = ((TickNow - TickBegin) > TickRate);
-		if (bWasLongTick)
-		{
-			break;
+			FAVVMRunner_ActorComponent& Runner = MultiLevelFeedbackQueue.Runners_ActorComponent[RunnerIndex];
+			ExecuteRunner(Runner, WorldTime, GetFairShareBudget(Runner.Entities.Num()));
+			EvaluatePriorityLevel(Runner, RunnerIndex, true);
 		}
 	}
 
-	// @gdemers start from back since we last executed those entries, and are likely to be already in register caches.
-	for (int32 i = TempJobQueue.Num() - 1; i >= 0; --i)
-	{
-		// @gdemers push back everything in the priority queue with new placement.
-		// IMPORTANT : Do not reset, content may have changed between the start, and end of this function for our Actors,
-		// and their components.
-		FAVVMJobQueue& Dest = MultiLevelFeedbackQueue.PriorityQueue[i];
+	SerialLaneSeconds = (FPlatformTime::Seconds() - TickBegin);
+	bIsTicking = false;
 
-		for (auto& [Class, Runner_Actor] : TempJobQueue[i].Jobs_Actor)
-		{
-			const bool bDoesContains = LongRunningJobs[i].Jobs_Actor.Contains(Class);
-			if (bDoesContains)
-			{
-				TArray<TWeakObjectPtr<AActor>> TempActors = MoveTemp(LongRunningJobs[i].Jobs_Actor[Class].Entities);
-				const int32 NewHandle = Dest.Append(Class.Get(), TempActors);
-				TickerHandles.FindOrAdd(Class, NewHandle);
-			}
-		}
+	PublishStats();
 
-		for (auto& [Class, Runner_ActorComponent] : TempJobQueue[i].Jobs_ActorComponent)
-		{
-			const bool bDoesContains = LongRunningJobs[i].Jobs_ActorComponent.Contains(Class);
-			if (bDoesContains)
-			{
-				TArray<TWeakObjectPtr<UActorComponent>> TempActorComponents = MoveTemp(LongRunningJobs[i].Jobs_ActorComponent[Class].Entities);
-				const int32 NewHandle = Dest.Append(Class.Get(), TempActorComponents);
-				TickerHandles.FindOrAdd(Class, NewHandle);
-			}
-		}
+	// @gdemers move runners across priority levels. runners are moved by index, the dense storage stays in place.
+	for (const FAVVMPriorityChange& PendingPriorityChange : PendingPriorityChanges)
+	{
+		MultiLevelFeedbackQueue.SetPriorityLevel(PendingPriorityChange.RunnerIndex,
+		                                         PendingPriorityChange.PriorityLevel,
+		                                         PendingPriorityChange.bIsActorComponent);
 	}
 
+	// @gdemers IMPORTANT : Reset, and not Empty. we want to keep our allocation around for the next frame.
+	PendingPriorityChanges.Reset();
+
+	FlushPendingOperations();
+
 	// @gdemers after a period of time, we want all job queues to be put at the highest priority,
 	// and grant longer process a chance to run on the cpu again.
 	ResetJobQueuePriorityDeltaTime += DeltaTime;
 	if (ResetJobQueuePriorityDeltaTime > GlobalResetTimeJobQueuePriority)
 	{
 		ResetJobQueuePriorityDeltaTime = 0.f;
-
-		const int32 Count = MultiLevelFeedbackQueue.PriorityQueue.Num();
-		for (int32 i = 1; i < Count; ++i)
-		{
-			FAVVMJobQueue& Dest = MultiLevelFeedbackQueue.PriorityQueue[0];
-			FAVVMJobQueue& Src = MultiLevelFeedbackQueue.PriorityQueue[i];
-
-			for (auto& [Class, Runner_Actor] : Src.Jobs_Actor)
-			{
-				TArray<TWeakObjectPtr<AActor>> TempActors = MoveTemp(Src.Jobs_Actor[Class].Entities);
-				const int32 NewHandle = Dest.Append(Class.Get(), TempActors);
-				TickerHandles.FindOrAdd(Class, NewHandle);
-			}
-
-			for (auto& [Class, Runner_ActorComponent] : Src.Jobs_ActorComponent)
-			{
-				TArray<TWeakObjectPtr<UActorComponent>> TempActorComponents = MoveTemp(Src.Jobs_ActorComponent[Class].Entities);
-				const int32 NewHandle = Dest.Append(Class.Get(), TempActorComponents);
-				TickerHandles.FindOrAdd(Class, NewHandle);
-			}
-		}
+		MultiLevelFeedbackQueue.ResetPriority();
 	}
 }
 
@@ -246,6 +215,24 @@ TStatId UAVVMTickScheduler::GetStatId() const
 	RETURN_QUICK_DECLARE_CYCLE_STAT(UAVVMTickScheduler, STATGROUP_Tickables);
 }
 
+FAVVMTickSchedulerStats UAVVMTickScheduler::GetStats() const
+{
+	FAVVMTickSchedulerStats OutStats;
+	OutStats.Levels = LevelCounters;
+	OutStats.ParallelLane = ParallelLaneCounters;
+	OutStats.SerialLaneSeconds = SerialLaneSeconds;
+	OutStats.ParallelLaneSeconds = ParallelLaneSeconds;
+	OutStats.FrameBudgetConsumed = (TickRate > 0.f) ? (SerialLaneSeconds / TickRate) : 0.0;
+	OutStats.GlobalJobAllotment = GlobalJobAllotment;
+	OutStats.TickRate = TickRate;
+	OutStats.MaxStaleness = MaxStaleness;
+	OutStats.bShowDebugOverlay = bShowDebugOverlay;
+
+	GatherRunnerStats(MultiLevelFeedbackQueue.Runners_Actor, OutStats);
+	GatherRunnerStats(MultiLevelFeedbackQueue.Runners_ActorComponent, OutStats);
+	return OutStats;
+}
+
 void UAVVMTickScheduler::Static_Register(const UWorld* World,
                                          const TScriptInterface<IAVVMDoesSupportManualTicking>& ManualTickActor)
 {
@@ -290,23 +277,70 @@ void UAVVMTickScheduler::Register(const TScriptInterface<IAVVMDoesSupportManualT
 		return;
 	}
 
+	if (bIsTicking)
+	{
+		PendingRegistrations.Add(ManualTicker.GetObject());
+	}
+	else
+	{
+		RegisterEntity(ManualTicker.GetObject());
+	}
+}
+
+void UAVVMTickScheduler::UnRegister(const TScriptInterface<IAVVMDoesSupportManualTicking>& ManualTicker)
+{
+	if (!UAVVMToolkitUtils::IsNativeScriptInterfaceValid(ManualTicker))
+	{
+		return;
+	}
+
+	const TWeakObjectPtr<UObject> WeakEntity = ManualTicker.GetObject();
+
+	// @gdemers an entity may unregister during the same frame it registered.
+	PendingRegistrations.RemoveSwap(WeakEntity, EAllowShrinking::No);
+
+	FAVVMTickHandle OutHandle;
+	const bool bWasRemoved = TickerHandles.RemoveAndCopyValue(WeakEntity, OutHandle);
+	if (!bWasRemoved)
+	{
+		return;
+	}
+
+	if (bIsTicking)
+	{
+		PendingRemovals.Add(OutHandle);
+	}
+	else
+	{
+		MultiLevelFeedbackQueue.Pop(OutHandle);
+	}
+}
+
+void UAVVMTickScheduler::RegisterEntity(UObject* Entity)
+{
+	if (!IsValid(Entity) || TickerHandles.Contains(Entity))
+	{
+		return;
+	}
+
 	// @gdemers Notes : New jobs entering the system should be placed at the higher priority, and
 	// moved based on allotment time spent during execution time.
-	auto* Actor = Cast<AActor>(ManualTicker.GetObject());
+	const UWorld* World = GetWorld();
+	const double WorldTime = IsValid(World) ? World->GetTimeSeconds() : 0.0;
+
+	auto* Actor = Cast<AActor>(Entity);
 	if (IsValid(Actor))
 	{
-		const UClass* Class = Actor->GetClass();
-		const int64 OutHandle = MultiLevelFeedbackQueue.Push(Class, Actor);
-		TickerHandles.FindOrAdd(Class, OutHandle);
+		const FAVVMTickHandle OutHandle = MultiLevelFeedbackQueue.Push(Actor->GetClass(), Actor, WorldTime);
+		TickerHandles.Add(Actor, OutHandle);
 		return;
 	}
 
-	auto* ActorComponent = Cast<UActorComponent>(ManualTicker.GetObject());
+	auto* ActorComponent = Cast<UActorComponent>(Entity);
 	if (IsValid(ActorComponent))
 	{
-		const UClass* Class = ActorComponent->GetClass();
-		const int64 OutHandle = MultiLevelFeedbackQueue.Push(Class, ActorComponent);
-		TickerHandles.FindOrAdd(Class, OutHandle);
+		const FAVVMTickHandle OutHandle = MultiLevelFeedbackQueue.Push(ActorComponent->GetClass(), ActorComponent, WorldTime);
+		TickerHandles.Add(ActorComponent, OutHandle);
 		return;
 	}
 
@@ -314,43 +348,248 @@ void UAVVMTickScheduler::Register(const TScriptInterface<IAVVMDoesSupportManualT
 	                 TEXT("Tick aggregation is only supported on AActor derived types, and UActorComponent derived types."));
 }
 
-void UAVVMTickScheduler::UnRegister(const TScriptInterface<IAVVMDoesSupportManualTicking>& ManualTicker)
+void UAVVMTickScheduler::ExecuteParallelLane(const double WorldTime)
 {
-	if (!UAVVMToolkitUtils::IsNativeScriptInterfaceValid(ManualTicker))
+	const FAVVMJobQueue& JobQueue = MultiLevelFeedbackQueue.ParallelJobQueue;
+	for (const int32 RunnerIndex : JobQueue.Jobs_Actor)
+	{
+		GatherParallelRunner(MultiLevelFeedbackQueue.Runners_Actor[RunnerIndex], WorldTime);
+	}
+
+	for (const int32 RunnerIndex : JobQueue.Jobs_ActorComponent)
+	{
+		GatherParallelRunner(MultiLevelFeedbackQueue.Runners_ActorComponent[RunnerIndex], WorldTime);
+	}
+
+	if (ParallelTickJobs.IsEmpty())
 	{
 		return;
 	}
 
-	auto* Actor = Cast<AActor>(ManualTicker.GetObject());
-	if (IsValid(Actor))
+	ParallelLaneCounters.NumTicked = ParallelTickJobs.Num();
+
+	// @gdemers entities of all classes are flattened in a single batch so idle workers steal from the remaining range,
+	// instead of waiting on a per-class join.
+	static constexpr int32 MinBatchSize = 16;
+	const EParallelForFlags Flags = bAllowParallelTick ? EParallelForFlags::Unbalanced : EParallelForFlags::ForceSingleThread;
+	ParallelFor(TEXT("AVVMTickScheduler.ParallelTick"), ParallelTickJobs.Num(), MinBatchSize, [this](const int32 Index)
 	{
-		const UClass* Class = Actor->GetClass();
-		const bool bDoesContains = TickerHandles.Contains(Class);
-		if (bDoesContains)
+		const FAVVMParallelTickJob& ParallelTickJob = ParallelTickJobs[Index];
+		ParallelTickJob.Ticker->ParallelTick(ParallelTickJob.DeltaTime);
+	}, Flags);
+
+	// @gdemers commit on the game thread. an entity may be destroyed by another entity commit.
+	for (const FAVVMParallelTickJob& ParallelTickJob : ParallelTickJobs)
+	{
+		if (IsValid(ParallelTickJob.Entity))
 		{
-			const int64 OutHandle = TickerHandles[Class];
-			MultiLevelFeedbackQueue.Pop(OutHandle, Actor);
+			ParallelTickJob.Ticker->CommitTick(ParallelTickJob.DeltaTime);
 		}
+	}
+
+	// @gdemers IMPORTANT : Reset, and not Empty. we want to keep our allocation around for the next frame.
+	ParallelTickJobs.Reset();
+}
+
+template <typename TEntity>
+void UAVVMTickScheduler::GatherParallelRunner(TAVVMRunner<TEntity>& Runner, const double WorldTime)
+{
+	Runner.Counters.NumTicked = 0;
+
+	for (int32 DenseIndex = 0; DenseIndex < Runner.Entities.Num(); ++DenseIndex)
+	{
+		TEntity* Entity = Runner.Entities[DenseIndex].Get();
+		if (!IsValid(Entity))
+		{
+			const int32 SlotIndex = Runner.SlotIndices[DenseIndex];
+			PendingRemovals.Add(FAVVMTickHandle{SlotIndex, MultiLevelFeedbackQueue.Slots[SlotIndex].Generation});
+			TickerHandles.Remove(Runner.Entities[DenseIndex]);
+			continue;
+		}
+
+		auto* Ticker = Cast<IAVVMDoesSupportManualTicking>(Entity);
+		if (Ticker != nullptr)
+		{
+			const double AccumulatedDeltaTime = (WorldTime - Runner.LastTickTimes[DenseIndex]);
+			ParallelTickJobs.Add(FAVVMParallelTickJob{Entity, Ticker, static_cast<float>(AccumulatedDeltaTime)});
+			Runner.LastTickTimes[DenseIndex] = WorldTime;
+			++Runner.Counters.NumTicked;
+		}
+	}
+}
+
+void UAVVMTickScheduler::FlushPendingOperations()
+{
+	for (const FAVVMTickHandle& Handle : PendingRemovals)
+	{
+		MultiLevelFeedbackQueue.Pop(Handle);
+	}
+
+	for (const TWeakObjectPtr<UObject>& WeakEntity : PendingRegistrations)
+	{
+		RegisterEntity(WeakEntity.Get());
+	}
+
+	PendingRemovals.Reset();
+	PendingRegistrations.Reset();
+}
 
+template <typename TEntity>
+void UAVVMTickScheduler::ExecuteRunner(TAVVMRunner<TEntity>& Runner, const double WorldTime, const double Budget)
+{
+	Runner.Counters.NumTicked = 0;
+	Runner.Counters.NumDeferred = 0;
+
+	const int32 Count = Runner.Entities.Num();
+	if (Count == 0)
+	{
 		return;
 	}
 
-	auto* ActorComponent = Cast<UActorComponent>(ManualTicker.GetObject());
-	if (IsValid(ActorComponent))
+	TRACE_CPUPROFILER_EVENT_SCOPE_TEXT(*Runner.DebugName);
+
+	// @gdemers timestamp before executing job. an unbounded runner never defer.
+	const double Before = FPlatformTime::Seconds();
+	const bool bIsBudgetBounded = (Budget < MAX_dbl);
+	const double Deadline = bIsBudgetBounded ? (Before + Budget) : MAX_dbl;
+
+	int32 NumTicked = 0;
+	int32 NumDeferred = 0;
+	int32 FirstDeferredIndex = INDEX_NONE;
+
+	// @gdemers start at the cursor so entities deferred on the previous pass are the first to run.
+	for (int32 i = 0; i < Count; ++i)
 	{
-		const UClass* Class = Actor->GetClass();
-		const bool bDoesContains = TickerHandles.Contains(Class);
-		if (bDoesContains)
+		const int32 DenseIndex = ((Runner.Cursor + i) % Count);
+
+		TEntity* Entity = Runner.Entities[DenseIndex].Get();
+		if (!IsValid(Entity))
 		{
-			const int64 OutHandle = TickerHandles[Class];
-			MultiLevelFeedbackQueue.Pop(OutHandle, ActorComponent);
+			// @gdemers entity was destroyed without unregistering. removal is deferred so our dense indices remain valid during iteration.
+			const int32 SlotIndex = Runner.SlotIndices[DenseIndex];
+			PendingRemovals.Add(FAVVMTickHandle{SlotIndex, MultiLevelFeedbackQueue.Slots[SlotIndex].Generation});
+			TickerHandles.Remove(Runner.Entities[DenseIndex]);
+			continue;
 		}
 
-		return;
+		const double AccumulatedDeltaTime = (WorldTime - Runner.LastTickTimes[DenseIndex]);
+		const bool bIsStale = (AccumulatedDeltaTime >= MaxStaleness);
+
+		// @gdemers once we defer an entity, all remaining entities of this pass are deferred unless stale. this keeps the
+		// round-robin order intact. the expected cost of the next entity is predicted from our moving average.
+		const bool bIsOverBudget = bIsBudgetBounded && ((FirstDeferredIndex != INDEX_NONE) || ((FPlatformTime::Seconds() + Runner.AverageCostPerEntity) > Deadline));
+		if (bIsOverBudget && !bIsStale)
+		{
+			if (FirstDeferredIndex == INDEX_NONE)
+			{
+				FirstDeferredIndex = DenseIndex;
+			}
+
+			++NumDeferred;
+			continue;
+		}
+
+		NSAVVMTickScheduler::ExecuteTick(Entity, static_cast<float>(AccumulatedDeltaTime));
+		Runner.LastTickTimes[DenseIndex] = WorldTime;
+		++NumTicked;
 	}
 
-	ensureAlwaysMsgf(IsValid(Actor) || IsValid(ActorComponent),
-	                 TEXT("Tick aggregation is only supported on AActor derived types, and UActorComponent derived types."));
+	// @gdemers timestamp after executing job, and record the exponentially weighted cost per entity for this class.
+	if (NumTicked > 0)
+	{
+		const double CostPerEntity = ((FPlatformTime::Seconds() - Before) / NumTicked);
+		Runner.AverageCostPerEntity = FMath::Lerp(Runner.AverageCostPerEntity, CostPerEntity, static_cast<double>(CostSmoothingFactor));
+	}
+
+	if (FirstDeferredIndex != INDEX_NONE)
+	{
+		Runner.Cursor = FirstDeferredIndex;
+	}
+
+	Runner.Counters.NumTicked = NumTicked;
+	Runner.Counters.NumDeferred = NumDeferred;
+
+	FAVVMTickSchedulerCounters& OutLevelCounters = LevelCounters[Runner.PriorityLevel];
+	OutLevelCounters.NumTicked += NumTicked;
+	OutLevelCounters.NumDeferred += NumDeferred;
+}
+
+template <typename TEntity>
+void UAVVMTickScheduler::EvaluatePriorityLevel(TAVVMRunner<TEntity>& Runner, const int32 RunnerIndex, const bool bIsActorComponent)
+{
+	// @gdemers we compare the projected cost of ticking the whole class, and not the elapsed time of this pass, which is capped by our budget.
+	// a single slow frame doesn't demote a class, and a class that became cheap is promoted back without waiting for the global reset.
+	static constexpr double PromotionThreshold = 0.5;
+	const double ProjectedCost = (Runner.AverageCostPerEntity * Runner.Entities.Num());
+	const int32 LowestPriorityLevel = (MultiLevelFeedbackQueue.PriorityQueue.Num() - 1);
+
+	if (Runner.PriorityLevel < LowestPriorityLevel && ProjectedCost > GlobalJobAllotment)
+	{
+		PendingPriorityChanges.Add(FAVVMPriorityChange{RunnerIndex, Runner.PriorityLevel + 1, bIsActorComponent});
+		++Runner.Counters.NumDemotions;
+		++LevelCounters[Runner.PriorityLevel].NumDemotions;
+	}
+	else if (Runner.PriorityLevel > 0 && ProjectedCost < (GlobalJobAllotment * PromotionThreshold))
+	{
+		PendingPriorityChanges.Add(FAVVMPriorityChange{RunnerIndex, Runner.PriorityLevel - 1, bIsActorComponent});
+		++Runner.Counters.NumPromotions;
+		++LevelCounters[Runner.PriorityLevel].NumPromotions;
+	}
+}
+
+template <typename TEntity>
+void UAVVMTickScheduler::GatherRunnerStats(const TArray<TAVVMRunner<TEntity>>& Runners, FAVVMTickSchedulerStats& OutStats)
+{
+	for (const TAVVMRunner<TEntity>& Runner : Runners)
+	{
+		FAVVMTickSchedulerClassStats& OutClassStats = OutStats.Classes.AddDefaulted_GetRef();
+		OutClassStats.ClassName = Runner.DebugName;
+		OutClassStats.Counters = Runner.Counters;
+		OutClassStats.NumEntities = Runner.Entities.Num();
+		OutClassStats.PriorityLevel = Runner.PriorityLevel;
+		OutClassStats.NanosecondsPerEntity = (Runner.AverageCostPerEntity * 1e9);
+		OutClassStats.bDoesSupportParallelTick = Runner.bDoesSupportParallelTick;
+	}
+}
+
+void UAVVMTickScheduler::PublishStats()
+{
+	FAVVMTickSchedulerCounters Total;
+	for (const FAVVMTickSchedulerCounters& Counters : LevelCounters)
+	{
+		Total.NumTicked += Counters.NumTicked;
+		Total.NumDeferred += Counters.NumDeferred;
+		Total.NumDemotions += Counters.NumDemotions;
+		Total.NumPromotions += Counters.NumPromotions;
+	}
+
+	const double NanosecondsPerEntity = (Total.NumTicked > 0) ? ((SerialLaneSeconds * 1e9) / Total.NumTicked) : 0.0;
+	const double FrameBudgetConsumed = (TickRate > 0.f) ? (SerialLaneSeconds / TickRate) : 0.0;
+
+	SET_DWORD_STAT(STAT_AVVMTickScheduler_NumTicked, Total.NumTicked);
+	SET_DWORD_STAT(STAT_AVVMTickScheduler_NumDeferred, Total.NumDeferred);
+	SET_DWORD_STAT(STAT_AVVMTickScheduler_NumDemotions, Total.NumDemotions);
+	SET_DWORD_STAT(STAT_AVVMTickScheduler_NumPromotions, Total.NumPromotions);
+	SET_DWORD_STAT(STAT_AVVMTickScheduler_NumParallelTicked, ParallelLaneCounters.NumTicked);
+	SET_FLOAT_STAT(STAT_AVVMTickScheduler_NanosecondsPerEntity, NanosecondsPerEntity);
+	SET_FLOAT_STAT(STAT_AVVMTickScheduler_FrameBudgetConsumed, FrameBudgetConsumed);
+
+	CSV_CUSTOM_STAT(AVVMTickScheduler, NumTicked, Total.NumTicked, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AVVMTickScheduler, NumDeferred, Total.NumDeferred, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AVVMTickScheduler, NumDemotions, Total.NumDemotions, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AVVMTickScheduler, NumPromotions, Total.NumPromotions, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AVVMTickScheduler, NumParallelTicked, ParallelLaneCounters.NumTicked, ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AVVMTickScheduler, NanosecondsPerEntity, static_cast<float>(NanosecondsPerEntity), ECsvCustomStatOp::Set);
+	CSV_CUSTOM_STAT(AVVMTickScheduler, FrameBudgetConsumed, static_cast<float>(FrameBudgetConsumed), ECsvCustomStatOp::Set);
+
+#if CSV_PROFILER
+	static_assert(UE_ARRAY_COUNT(NSAVVMTickScheduler::CsvLevelNumTicked) == FAVVMMLFQ::NumFeedbackLevels, "Csv stat names require one entry per priority level.");
+	for (int32 i = 0; i < LevelCounters.Num(); ++i)
+	{
+		FCsvProfiler::RecordCustomStat(NSAVVMTickScheduler::CsvLevelNumTicked[i], CSV_CATEGORY_INDEX(AVVMTickScheduler), LevelCounters[i].NumTicked, ECsvCustomStatOp::Set);
+		FCsvProfiler::RecordCustomStat(NSAVVMTickScheduler::CsvLevelNumDeferred[i], CSV_CATEGORY_INDEX(AVVMTickScheduler), LevelCounters[i].NumDeferred, ECsvCustomStatOp::Set);
+	}
+#endif
 }
 
 void UAVVMTickScheduler::GetSetProjectTickSchedulerRule()
@@ -377,78 +616,217 @@ void UAVVMTickScheduler::InitRule()
 		GlobalResetTimeJobQueuePriority = Rule->GetGlobalResetTimeJobQueuePriority();
 		GlobalJobAllotment = Rule->GetGlobalJobAllotment();
 		TickRate = Rule->GetTickRate();
+		bAllowParallelTick = Rule->GetAllowParallelTick();
+		MaxStaleness = Rule->GetMaxStaleness();
+		CostSmoothingFactor = Rule->GetCostSmoothingFactor();
+		bShowDebugOverlay = Rule->GetShowDebugOverlay();
+	}
+}
+
+UAVVMTickScheduler::FAVVMTickHandle UAVVMTickScheduler::FAVVMMLFQ::Push(const UClass* Class, UActorComponent* ActorComponent, const double WorldTime)
+{
+	if (!IsValid(Class) || !IsValid(ActorComponent))
+	{
+		return FAVVMTickHandle();
 	}
+
+	return Push(Runners_ActorComponent, RunnerIndices_ActorComponent, Class, ActorComponent, WorldTime, true);
 }
 
-int64 UAVVMTickScheduler::FAVVMJobQueue::Add(const UClass* Class, UActorComponent* ActorComponent)
+UAVVMTickScheduler::FAVVMTickHandle UAVVMTickScheduler::FAVVMMLFQ::Push(const UClass* Class, AActor* Actor, const double WorldTime)
 {
-	FAVVMRunner_ActorComponent& OutResult = Jobs_ActorComponent.FindOrAdd(Class);
-	OutResult.Entities.AddUnique(ActorComponent);
-	return reinterpret_cast<int64>(&OutResult.Entities);
+	if (!IsValid(Class) || !IsValid(Actor))
+	{
+		return FAVVMTickHandle();
+	}
+
+	return Push(Runners_Actor, RunnerIndices_Actor, Class, Actor, WorldTime, false);
 }
 
-int64 UAVVMTickScheduler::FAVVMJobQueue::Add(const UClass* Class, AActor* Actor)
+void UAVVMTickScheduler::FAVVMMLFQ::Pop(const FAVVMTickHandle& Handle)
 {
-	FAVVMRunner_Actor& OutResult = Jobs_Actor.FindOrAdd(Class);
-	OutResult.Entities.AddUnique(Actor);
-	return reinterpret_cast<int64>(&OutResult.Entities);
+	// @gdemers a stale handle is expected when an entity was flushed after being destroyed, and then unregistered.
+	const bool bIsHandleValid = (Handle.IsValid() && Slots.IsValidIndex(Handle.SlotIndex) && Slots[Handle.SlotIndex].Generation == Handle.Generation);
+	if (!bIsHandleValid)
+	{
+		return;
+	}
+
+	FAVVMTickSlot& Slot = Slots[Handle.SlotIndex];
+	if (Slot.bIsActorComponent)
+	{
+		Pop(Runners_ActorComponent, Slot);
+	}
+	else
+	{
+		Pop(Runners_Actor, Slot);
+	}
+
+	// @gdemers bump generation so any outstanding handle to this slot becomes stale.
+	++Slot.Generation;
+	Slot.RunnerIndex = INDEX_NONE;
+	Slot.DenseIndex = INDEX_NONE;
+	FreeSlotIndices.Add(Handle.SlotIndex);
 }
 
-int64 UAVVMTickScheduler::FAVVMJobQueue::Append(const UClass* Class, const TArray<TWeakObjectPtr<UActorComponent>>& ActorComponents)
+void UAVVMTickScheduler::FAVVMMLFQ::SetPriorityLevel(const int32 RunnerIndex, const int32 PriorityLevel, const bool bIsActorComponent)
 {
-	FAVVMRunner_ActorComponent& Runner_ActorComponent = Jobs_ActorComponent.FindOrAdd(Class);
-	Runner_ActorComponent.Entities.Append(ActorComponents);
-	return reinterpret_cast<int64>(&Jobs_ActorComponent[Class].Entities);
+	if (bIsActorComponent)
+	{
+		SetPriorityLevel(Runners_ActorComponent, RunnerIndex, PriorityLevel, bIsActorComponent);
+	}
+	else
+	{
+		SetPriorityLevel(Runners_Actor, RunnerIndex, PriorityLevel, bIsActorComponent);
+	}
 }
 
-int64 UAVVMTickScheduler::FAVVMJobQueue::Append(const UClass* Class, const TArray<TWeakObjectPtr<AActor>>& Actors)
+int32 UAVVMTickScheduler::FAVVMMLFQ::GetNumSerialEntities() const
 {
-	FAVVMRunner_Actor& Runner_Actor = Jobs_Actor.FindOrAdd(Class);
-	Runner_Actor.Entities.Append(Actors);
-	return reinterpret_cast<int64>(&Jobs_Actor[Class].Entities);
+	int32 OutResult = 0;
+	for (const FAVVMJobQueue& JobQueue : PriorityQueue)
+	{
+		for (const int32 RunnerIndex : JobQueue.Jobs_Actor)
+		{
+			OutResult += Runners_Actor[RunnerIndex].Entities.Num();
+		}
+
+		for (const int32 RunnerIndex : JobQueue.Jobs_ActorComponent)
+		{
+			OutResult += Runners_ActorComponent[RunnerIndex].Entities.Num();
+		}
+	}
+
+	return OutResult;
 }
 
-int64 UAVVMTickScheduler::FAVVMMLFQ::Push(const UClass* Class, UActorComponent* ActorComponent)
+void UAVVMTickScheduler::FAVVMMLFQ::ResetPriority()
 {
-	if (!IsValid(Class) || !IsValid(ActorComponent))
+	// @gdemers rebuild level 0 from the runner storage, preserving registration order. runners on the parallel lane are left untouched.
+	for (FAVVMJobQueue& JobQueue : PriorityQueue)
 	{
-		return INDEX_NONE;
+		JobQueue.Jobs_Actor.Reset();
+		JobQueue.Jobs_ActorComponent.Reset();
 	}
 
-	FAVVMJobQueue& JobQueue = PriorityQueue[0];
-	const int64 OutHandle = JobQueue.Add(Class, ActorComponent);
-	return OutHandle;
+	FAVVMJobQueue& Dest = PriorityQueue[0];
+	for (int32 i = 0; i < Runners_Actor.Num(); ++i)
+	{
+		if (!Runners_Actor[i].bDoesSupportParallelTick)
+		{
+			Runners_Actor[i].PriorityLevel = 0;
+			Runners_Actor[i].JobIndex = Dest.Jobs_Actor.Add(i);
+		}
+	}
+
+	for (int32 i = 0; i < Runners_ActorComponent.Num(); ++i)
+	{
+		if (!Runners_ActorComponent[i].bDoesSupportParallelTick)
+		{
+			Runners_ActorComponent[i].PriorityLevel = 0;
+			Runners_ActorComponent[i].JobIndex = Dest.Jobs_ActorComponent.Add(i);
+		}
+	}
 }
 
-int64 UAVVMTickScheduler::FAVVMMLFQ::Push(const UClass* Class, AActor* Actor)
+template <typename TEntity>
+UAVVMTickScheduler::FAVVMTickHandle UAVVMTickScheduler::FAVVMMLFQ::Push(TArray<TAVVMRunner<TEntity>>& Runners,
+                                                                        TMap<TWeakObjectPtr<const UClass>, int32>& RunnerIndices,
+                                                                        const UClass* Class,
+                                                                        TEntity* Entity,
+                                                                        const double WorldTime,
+                                                                        const bool bIsActorComponent)
 {
-	if (!IsValid(Class) || !IsValid(Actor))
+	// @gdemers runners are created once per class, and we ALWAYS want new jobs to push onto the highest level.
+	int32* RunnerIndex = RunnerIndices.Find(Class);
+	if (RunnerIndex == nullptr)
 	{
-		return INDEX_NONE;
+		const auto* Ticker = Cast<IAVVMDoesSupportManualTicking>(Entity);
+		const bool bDoesSupportParallelTick = (Ticker != nullptr && Ticker->DoesSupportParallelTick());
+
+		const int32 NewRunnerIndex = Runners.AddDefaulted();
+		TAVVMRunner<TEntity>& NewRunner = Runners[NewRunnerIndex];
+		NewRunner.Class = Class;
+		NewRunner.DebugName = Class->GetName();
+		NewRunner.PriorityLevel = 0;
+		NewRunner.bDoesSupportParallelTick = bDoesSupportParallelTick;
+
+		FAVVMJobQueue& JobQueue = bDoesSupportParallelTick ? ParallelJobQueue : PriorityQueue[0];
+		NewRunner.JobIndex = JobQueue.GetJobs(bIsActorComponent).Add(NewRunnerIndex);
+		RunnerIndex = &RunnerIndices.Add(Class, NewRunnerIndex);
 	}
 
-	// @gdemers we ALWAYS want new jobs to push onto the highest level.
-	FAVVMJobQueue& JobQueue = PriorityQueue[0];
-	const int64 OutHandle = JobQueue.Add(Class, Actor);
-	return OutHandle;
+	TAVVMRunner<TEntity>& Runner = Runners[*RunnerIndex];
+
+	const int32 SlotIndex = AllocateSlot();
+	FAVVMTickSlot& Slot = Slots[SlotIndex];
+	Slot.RunnerIndex = *RunnerIndex;
+	Slot.DenseIndex = Runner.Entities.Add(Entity);
+	Slot.bIsActorComponent = bIsActorComponent;
+	Runner.SlotIndices.Add(SlotIndex);
+	Runner.LastTickTimes.Add(WorldTime);
+
+	return FAVVMTickHandle{SlotIndex, Slot.Generation};
 }
 
-void UAVVMTickScheduler::FAVVMMLFQ::Pop(const int64 Handle, UActorComponent* ActorComponent) const
+template <typename TEntity>
+void UAVVMTickScheduler::FAVVMMLFQ::Pop(TArray<TAVVMRunner<TEntity>>& Runners, const FAVVMTickSlot& Slot)
 {
-	auto* PtrToArray = reinterpret_cast<TArray<TWeakObjectPtr<UActorComponent>>*>(Handle);
-	if (ensureAlwaysMsgf(PtrToArray != nullptr,
-	                     TEXT("Invalid Handle. Verify that the handle is pointing to the collection type we expect to use during removal process.")))
+	TAVVMRunner<TEntity>& Runner = Runners[Slot.RunnerIndex];
+
+	// @gdemers swap-remove. the last entity takes the removed entity place, so we redirect its slot.
+	const int32 LastIndex = (Runner.Entities.Num() - 1);
+	if (Slot.DenseIndex != LastIndex)
 	{
-		PtrToArray->Remove(ActorComponent);
+		Slots[Runner.SlotIndices[LastIndex]].DenseIndex = Slot.DenseIndex;
 	}
+
+	Runner.Entities.RemoveAtSwap(Slot.DenseIndex, EAllowShrinking::No);
+	Runner.SlotIndices.RemoveAtSwap(Slot.DenseIndex, EAllowShrinking::No);
+	Runner.LastTickTimes.RemoveAtSwap(Slot.DenseIndex, EAllowShrinking::No);
+
+	if (Runner.Cursor >= Runner.Entities.Num())
+	{
+		Runner.Cursor = 0;
+	}
+}
+
+template <typename TEntity>
+void UAVVMTickScheduler::FAVVMMLFQ::SetPriorityLevel(TArray<TAVVMRunner<TEntity>>& Runners,
+                                                      const int32 RunnerIndex,
+                                                      const int32 PriorityLevel,
+                                                      const bool bIsActorComponent)
+{
+	TAVVMRunner<TEntity>& Runner = Runners[RunnerIndex];
+
+	// @gdemers clamp index.
+	const int32 NextPriorityLevel = FMath::Clamp(PriorityLevel, 0, PriorityQueue.Num() - 1);
+	if (NextPriorityLevel == Runner.PriorityLevel)
+	{
+		return;
+	}
+
+	// @gdemers swap-remove from the current level. the runner taking our place requires its job index to be redirected.
+	TArray<int32>& Src = PriorityQueue[Runner.PriorityLevel].GetJobs(bIsActorComponent);
+	const int32 LastIndex = (Src.Num() - 1);
+	if (Runner.JobIndex != LastIndex)
+	{
+		Runners[Src[LastIndex]].JobIndex = Runner.JobIndex;
+	}
+
+	Src.RemoveAtSwap(Runner.JobIndex, EAllowShrinking::No);
+
+	TArray<int32>& Dest = PriorityQueue[NextPriorityLevel].GetJobs(bIsActorComponent);
+	Runner.JobIndex = Dest.Add(RunnerIndex);
+	Runner.PriorityLevel = NextPriorityLevel;
 }
 
-void UAVVMTickScheduler::FAVVMMLFQ::Pop(const int64 Handle, AActor* Actor) const
+int32 UAVVMTickScheduler::FAVVMMLFQ::AllocateSlot()
 {
-	auto* PtrToArray = reinterpret_cast<TArray<TWeakObjectPtr<AActor>>*>(Handle);
-	if (ensureAlwaysMsgf(PtrToArray != nullptr,
-	                     TEXT("Invalid Handle. Verify that the handle is pointing to the collection type we expect to use during removal process.")))
+	if (!FreeSlotIndices.IsEmpty())
 	{
-		PtrToArray->Remove(Actor);
+		return FreeSlotIndices.Pop(EAllowShrinking::No);
 	}
+
+	return Slots.AddDefaulted();
 }
@@ -62,3 +62,32 @@ float UAVVMTickSchedulerRule::GetTickRate() const
 		return TickRate;
 	}
 }
+
+bool UAVVMTickSchedulerRule::GetAllowParallelTick() const
+{
+	return bAllowParallelTick;
+}
+
+float UAVVMTickSchedulerRule::GetMaxStaleness() const
+{
+	const bool bDoesOverride = FAVVMGameplayModule::GetCVarEnableOverrideTickSchedulerRule()->GetBool();
+	if (bDoesOverride)
+	{
+		const float MaxStalenessOverride = FAVVMGameplayModule::GetCVarOverrideTickSchedulerMaxStaleness()->GetFloat();
+		return MaxStalenessOverride;
+	}
+	else
+	{
+		return MaxStaleness;
+	}
+}
+
+float UAVVMTickSchedulerRule::GetCostSmoothingFactor() const
+{
+	return CostSmoothingFactor;
+}
+
+bool UAVVMTickSchedulerRule::GetShowDebugOverlay() const
+{
+	return bShowDebugOverlay;
+}
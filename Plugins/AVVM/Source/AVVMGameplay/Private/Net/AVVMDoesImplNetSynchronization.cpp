@@ -18,3 +18,14 @@
 //OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
 //SOFTWARE.
 #include "Net/AVVMDoesImplNetSynchronization.h"
+
+#include "AVVMPlayerState.h"
+
+void IAVVMDoesImplNetSynchronization::ClientRefreshBatch_Implementation(const TArray<AAVVMPlayerState*>& PlayerStates) const
+{
+	UObject* NetSystem = _getUObject();
+	for (const AAVVMPlayerState* PlayerState : PlayerStates)
+	{
+		IAVVMDoesImplNetSynchronization::Execute_ClientRefresh(NetSystem, PlayerState);
+	}
+}
@@ -20,6 +20,8 @@
 #include "Net/AVVMNetSynchronizationManager.h"
 
 #include "AVVMGameplayModule.h"
+#include "AVVMGameplaySettings.h"
+#include "AVVMLogger.h"
 #include "AVVMToolkitUtils.h"
 #include "Engine/World.h"
 #include "Net/AVVMDoesImplNetSynchronization.h"
@@ -40,6 +42,7 @@ void UAVVMNetSynchronizationManager::Deinitialize()
 {
 	Super::Deinitialize();
 	NetFinalized.Reset();
+	ClientBackfillStates.Reset();
 }
 
 TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>> UAVVMNetSynchronizationManager::Static_GetAllNetFinalized(const UWorld* World)
@@ -57,6 +60,39 @@ void UAVVMNetSynchronizationManager::Static_Register(const UWorld* World, const
 	}
 }
 
+bool UAVVMNetSynchronizationManager::Static_GetNextBackfillChunk(const UWorld* World,
+                                                                const AAVVMPlayerState* PlayerState,
+                                                                const bool bForceSend,
+                                                                TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& OutChunk,
+                                                                int32& OutVersion,
+                                                                bool& bOutIsFinalChunk)
+{
+	OutChunk.Reset();
+	OutVersion = 0;
+	bOutIsFinalChunk = true;
+
+	auto* NetManager = UAVVMNetSynchronizationManager::Get(World);
+	return IsValid(NetManager) ? NetManager->GetNextBackfillChunk(PlayerState, bForceSend, OutChunk, OutVersion, bOutIsFinalChunk) : false;
+}
+
+void UAVVMNetSynchronizationManager::Static_AcknowledgeBackfill(const UWorld* World, const AAVVMPlayerState* PlayerState, const int32 Version)
+{
+	auto* NetManager = UAVVMNetSynchronizationManager::Get(World);
+	if (IsValid(NetManager))
+	{
+		NetManager->AcknowledgeBackfill(PlayerState, Version);
+	}
+}
+
+void UAVVMNetSynchronizationManager::Static_UnregisterClient(const UWorld* World, const AAVVMPlayerState* PlayerState)
+{
+	auto* NetManager = UAVVMNetSynchronizationManager::Get(World);
+	if (IsValid(NetManager))
+	{
+		NetManager->ClientBackfillStates.Remove(PlayerState);
+	}
+}
+
 UAVVMNetSynchronizationManager* UAVVMNetSynchronizationManager::Get(const UWorld* World)
 {
 	return UWorld::GetSubsystem<UAVVMNetSynchronizationManager>(World);
@@ -76,3 +112,70 @@ void UAVVMNetSynchronizationManager::Register(const UActorComponent* ReplicatedC
 		NetFinalized.AddUnique(NetSynchronization);
 	}
 }
+
+bool UAVVMNetSynchronizationManager::GetNextBackfillChunk(const AAVVMPlayerState* PlayerState,
+                                                         const bool bForceSend,
+                                                         TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& OutChunk,
+                                                         int32& OutVersion,
+                                                         bool& bOutIsFinalChunk)
+{
+	if (!IsValid(PlayerState))
+	{
+		return false;
+	}
+
+	FAVVMClientBackfillState& BackfillState = ClientBackfillStates.FindOrAdd(PlayerState);
+	if (BackfillState.InFlightVersion != INDEX_NONE)
+	{
+		return false;
+	}
+
+	const int32 LatestVersion = NetFinalized.Num();
+	if (!bForceSend && (BackfillState.AcknowledgedVersion >= LatestVersion))
+	{
+		return false;
+	}
+
+	const int32 MaxChunkSize = FMath::Max(UAVVMGameplaySettings::GetMaxNetFinalizedPerBackfillChunk(), 1);
+
+	int32 Version = BackfillState.AcknowledgedVersion;
+	while ((Version < LatestVersion) && (OutChunk.Num() < MaxChunkSize))
+	{
+		// @gdemers systems destroyed since their registration, or irrelevant to this client, are skipped but still consume their version.
+		const TScriptInterface<IAVVMDoesImplNetSynchronization>& NetSynchronization = NetFinalized[Version++];
+		if (UAVVMToolkitUtils::IsNativeScriptInterfaceValid(NetSynchronization) &&
+			IAVVMDoesImplNetSynchronization::Execute_IsNetRelevantForClient(NetSynchronization.GetObject(), PlayerState))
+		{
+			OutChunk.Add(NetSynchronization);
+		}
+	}
+
+	OutVersion = Version;
+	bOutIsFinalChunk = (Version >= LatestVersion);
+	BackfillState.InFlightVersion = Version;
+	return true;
+}
+
+void UAVVMNetSynchronizationManager::AcknowledgeBackfill(const AAVVMPlayerState* PlayerState, const int32 Version)
+{
+	FAVVMClientBackfillState* BackfillState = ClientBackfillStates.Find(PlayerState);
+	if (BackfillState == nullptr)
+	{
+		return;
+	}
+
+	// @gdemers clients may only acknowledge the chunk in flight. stale, or forged, versions are ignored.
+	if ((BackfillState->InFlightVersion == INDEX_NONE) || (Version != BackfillState->InFlightVersion))
+	{
+		AVVM_LOGGER_WARNING(LogGameplay,
+		                    PlayerState,
+		                    this,
+		                    TEXT("Ignoring backfill acknowledgement of version %d. Expected %d."),
+		                    Version,
+		                    BackfillState->InFlightVersion);
+		return;
+	}
+
+	BackfillState->AcknowledgedVersion = Version;
+	BackfillState->InFlightVersion = INDEX_NONE;
+}
@@ -0,0 +1,50 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Components/ActorComponent.h"
+#include "Net/AVVMDoesImplNetSynchronization.h"
+
+#include "AVVMAutomatedTestNetSynchronizationComponent.generated.h"
+
+/**
+ *	Class description:
+ *
+ *	UAVVMAutomatedTestNetSynchronizationComponent is a synthetic net finalized system, used to validate backfill chunking and
+ *	the client refresh budget. It count its own refreshes.
+ */
+UCLASS()
+class AVVMGAMEPLAY_API UAVVMAutomatedTestNetSynchronizationComponent : public UActorComponent,
+                                                                       public IAVVMDoesImplNetSynchronization
+{
+	GENERATED_BODY()
+
+public:
+	// IAVVMDoesImplNetSynchronization
+	virtual void Finalized_Implementation() override;
+	virtual void ClientRefresh_Implementation(const AAVVMPlayerState* PlayerState) const override;
+	virtual int32 GetNetSynchronizationPriority_Implementation() const override;
+	virtual bool IsNetRelevantForLocalClientOnly_Implementation() const override;
+
+	int32 Priority = 0;
+	mutable int32 NumRefreshes = 0;
+};
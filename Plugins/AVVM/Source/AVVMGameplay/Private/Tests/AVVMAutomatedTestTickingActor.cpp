@@ -0,0 +1,146 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "AVVMAutomatedTestTickingActor.h"
+
+namespace NSAVVMAutomatedTestTicking
+{
+	// @gdemers entity owned state. large enough to span multiple cache lines.
+	static constexpr int32 NumSamples = 16;
+
+	void InitSamples(TArray<FVector>& Positions, TArray<FVector>& Velocities)
+	{
+		Positions.Init(FVector::ZeroVector, NumSamples);
+		Velocities.Reserve(NumSamples);
+		for (int32 i = 0; i < NumSamples; ++i)
+		{
+			Velocities.Add(FVector(i, NumSamples - i, 1.0));
+		}
+	}
+
+	double Simulate(TArray<FVector>& Positions, const TArray<FVector>& Velocities, const float DeltaTime)
+	{
+		double OutChecksum = 0.0;
+		for (int32 i = 0; i < Positions.Num(); ++i)
+		{
+			Positions[i] += Velocities[i] * DeltaTime;
+			OutChecksum += Positions[i].X + Positions[i].Y + Positions[i].Z;
+		}
+
+		return OutChecksum;
+	}
+}
+
+FAVVMAutomatedTestTickRecorder* FAVVMAutomatedTestTickRecorder::Active = nullptr;
+
+void FAVVMAutomatedTestTickRecorder::Record(const int32 ClassId, const UObject* Entity)
+{
+	check(IsInGameThread());
+
+	FAVVMAutomatedTestTickRecorder* Recorder = Active;
+	if (Recorder == nullptr)
+	{
+		return;
+	}
+
+	const auto Address = reinterpret_cast<UPTRINT>(Entity);
+	if (Recorder->NumTicks > 0)
+	{
+		Recorder->NumClassSwitches += (ClassId != Recorder->LastClassId) ? 1 : 0;
+		Recorder->AccumulatedStride += (Address > Recorder->LastAddress) ? (Address - Recorder->LastAddress) : (Recorder->LastAddress - Address);
+	}
+
+	Recorder->LastClassId = ClassId;
+	Recorder->LastAddress = Address;
+	++Recorder->NumTicks;
+}
+
+void FAVVMAutomatedTestTickRecorder::Reset()
+{
+	NumTicks = 0;
+	NumClassSwitches = 0;
+	AccumulatedStride = 0;
+	LastClassId = INDEX_NONE;
+	LastAddress = 0;
+}
+
+AAVVMAutomatedTestTickingActor::AAVVMAutomatedTestTickingActor(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// @gdemers the benchmark decide which of native ticking, or the scheduler, drive this actor.
+	PrimaryActorTick.bCanEverTick = true;
+	PrimaryActorTick.bStartWithTickEnabled = false;
+
+	NSAVVMAutomatedTestTicking::InitSamples(Positions, Velocities);
+}
+
+void AAVVMAutomatedTestTickingActor::Tick(float DeltaSeconds)
+{
+	Super::Tick(DeltaSeconds);
+
+	Checksum += NSAVVMAutomatedTestTicking::Simulate(Positions, Velocities, DeltaSeconds);
+	RecordTick(DeltaSeconds);
+}
+
+void AAVVMAutomatedTestTickingActor::RecordTick(const float DeltaTime)
+{
+	++NumTicks;
+	LastDeltaTime = DeltaTime;
+	FAVVMAutomatedTestTickRecorder::Record(GetClassId(), this);
+
+	if (OnTicked)
+	{
+		OnTicked(*this);
+	}
+}
+
+bool AAVVMAutomatedTestTickingActor_Parallel::DoesSupportParallelTick() const
+{
+	return true;
+}
+
+void AAVVMAutomatedTestTickingActor_Parallel::ParallelTick(const float DeltaTime)
+{
+	// @gdemers worker thread. only touch state owned by this entity.
+	PendingChecksum = NSAVVMAutomatedTestTicking::Simulate(Positions, Velocities, DeltaTime);
+}
+
+void AAVVMAutomatedTestTickingActor_Parallel::CommitTick(const float DeltaTime)
+{
+	Checksum += PendingChecksum;
+	RecordTick(DeltaTime);
+}
+
+UAVVMAutomatedTestTickingComponent::UAVVMAutomatedTestTickingComponent(const FObjectInitializer& ObjectInitializer)
+	: Super(ObjectInitializer)
+{
+	// @gdemers the benchmark decide which of native ticking, or the scheduler, drive this component.
+	PrimaryComponentTick.bCanEverTick = true;
+	PrimaryComponentTick.bStartWithTickEnabled = false;
+
+	NSAVVMAutomatedTestTicking::InitSamples(Positions, Velocities);
+}
+
+void UAVVMAutomatedTestTickingComponent::TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
+{
+	Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
+
+	Checksum += NSAVVMAutomatedTestTicking::Simulate(Positions, Velocities, DeltaTime);
+	FAVVMAutomatedTestTickRecorder::Record(GetClassId(), this);
+}
@@ -0,0 +1,175 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AVVMDoesSupportManualTicking.h"
+#include "Components/ActorComponent.h"
+#include "GameFramework/Actor.h"
+
+#include "AVVMAutomatedTestTickingActor.generated.h"
+
+/**
+ *	Class description:
+ *
+ *	FAVVMAutomatedTestTickRecorder accumulate, on the game thread, the order in which synthetic entities ticked. Class switches
+ *	between two consecutive ticks (i.e - vtable, and code reload), and the address distance between two consecutive entities
+ *	(i.e - data locality) are used as cache-miss proxies, since hardware counters aren't available to automation tests.
+ */
+struct FAVVMAutomatedTestTickRecorder
+{
+	static void Record(const int32 ClassId, const UObject* Entity);
+
+	void Reset();
+
+	int64 NumTicks = 0;
+	int64 NumClassSwitches = 0;
+	uint64 AccumulatedStride = 0;
+	int32 LastClassId = INDEX_NONE;
+	UPTRINT LastAddress = 0;
+
+	// @gdemers set by the benchmark for the duration of the measured frames only. synthetic entities don't record when null.
+	static FAVVMAutomatedTestTickRecorder* Active;
+};
+
+/**
+ *	Class description:
+ *
+ *	AAVVMAutomatedTestTickingActor is a synthetic Actor used to test the UAVVMTickScheduler, and benchmark native ticking against it.
+ *	Each instance own heap allocated state, and run a small integration over it when ticked.
+ */
+UCLASS(Abstract)
+class AVVMGAMEPLAY_API AAVVMAutomatedTestTickingActor : public AActor,
+                                                        public IAVVMDoesSupportManualTicking
+{
+	GENERATED_BODY()
+
+public:
+	AAVVMAutomatedTestTickingActor(const FObjectInitializer& ObjectInitializer);
+	virtual void Tick(float DeltaSeconds) override;
+	virtual int32 GetClassId() const PURE_VIRTUAL(AAVVMAutomatedTestTickingActor::GetClassId, return INDEX_NONE;);
+
+	int32 GetNumTicks() const { return NumTicks; }
+	float GetLastDeltaTime() const { return LastDeltaTime; }
+
+	// @gdemers test hook. invoked on the game thread once ticked, or once the parallel tick is committed.
+	TFunction<void(AAVVMAutomatedTestTickingActor&)> OnTicked;
+
+protected:
+	void RecordTick(const float DeltaTime);
+
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	double Checksum = 0.0;
+	/*Ticks received from either native ticking, or the scheduler*/
+	int32 NumTicks = 0;
+	float LastDeltaTime = 0.f;
+};
+
+UCLASS()
+class AVVMGAMEPLAY_API AAVVMAutomatedTestTickingActor_A : public AAVVMAutomatedTestTickingActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 GetClassId() const override { return 0; }
+};
+
+UCLASS()
+class AVVMGAMEPLAY_API AAVVMAutomatedTestTickingActor_B : public AAVVMAutomatedTestTickingActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 GetClassId() const override { return 1; }
+};
+
+UCLASS()
+class AVVMGAMEPLAY_API AAVVMAutomatedTestTickingActor_C : public AAVVMAutomatedTestTickingActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 GetClassId() const override { return 2; }
+};
+
+/**
+ *	Class description:
+ *
+ *	AAVVMAutomatedTestTickingActor_Parallel is a synthetic Actor that opt-in the scheduler parallel lane. Natively, it tick
+ *	like any other synthetic Actor.
+ */
+UCLASS()
+class AVVMGAMEPLAY_API AAVVMAutomatedTestTickingActor_Parallel : public AAVVMAutomatedTestTickingActor
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 GetClassId() const override { return 3; }
+
+	// IAVVMDoesSupportManualTicking
+	virtual bool DoesSupportParallelTick() const override;
+	virtual void ParallelTick(const float DeltaTime) override;
+	virtual void CommitTick(const float DeltaTime) override;
+
+protected:
+	double PendingChecksum = 0.0;
+};
+
+/**
+ *	Class description:
+ *
+ *	UAVVMAutomatedTestTickingComponent is a synthetic ActorComponent used to benchmark native ticking against the UAVVMTickScheduler.
+ */
+UCLASS(Abstract)
+class AVVMGAMEPLAY_API UAVVMAutomatedTestTickingComponent : public UActorComponent,
+                                                            public IAVVMDoesSupportManualTicking
+{
+	GENERATED_BODY()
+
+public:
+	UAVVMAutomatedTestTickingComponent(const FObjectInitializer& ObjectInitializer);
+	virtual void TickComponent(float DeltaTime, enum ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
+	virtual int32 GetClassId() const PURE_VIRTUAL(UAVVMAutomatedTestTickingComponent::GetClassId, return INDEX_NONE;);
+
+protected:
+	TArray<FVector> Positions;
+	TArray<FVector> Velocities;
+	double Checksum = 0.0;
+};
+
+UCLASS()
+class AVVMGAMEPLAY_API UAVVMAutomatedTestTickingComponent_A : public UAVVMAutomatedTestTickingComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 GetClassId() const override { return 4; }
+};
+
+UCLASS()
+class AVVMGAMEPLAY_API UAVVMAutomatedTestTickingComponent_B : public UAVVMAutomatedTestTickingComponent
+{
+	GENERATED_BODY()
+
+public:
+	virtual int32 GetClassId() const override { return 5; }
+};
@@ -19,9 +19,26 @@
 //SOFTWARE.
 #include "Misc/AutomationTest.h"
 
+#include "AVVMActorPoolSubsystem.h"
 #include "AVVMAutomatedTestGameplayActor.h"
+#include "AVVMAutomatedTestNetSynchronizationComponent.h"
+#include "AVVMAutomatedTestTickingActor.h"
+#include "AVVMCharacter.h"
+#include "AVVMGameSession.h"
+#include "AVVMGameplayModule.h"
+#include "AVVMGameplaySettings.h"
+#include "AVVMPlayerState.h"
+#include "AVVMPositionSamplerSubsystem.h"
+#include "AVVMTickScheduler.h"
+#include "AVVMTickSchedulerRule.h"
 #include "AVVMToolkitUtils.h"
+#include "Components/SkeletalMeshComponent.h"
 #include "Engine/AssetManager.h"
+#include "Engine/SkeletalMesh.h"
+#include "GameFramework/GameStateBase.h"
+#include "Net/AVVMNetSynchronizationManager.h"
+#include "PhysicsEngine/PhysicsAsset.h"
+#include "PhysicsEngine/SkeletalBodySetup.h"
 #include "Resources/AVVMResourceManagerComponent.h"
 
 #if WITH_AUTOMATION_TESTS
@@ -203,11 +220,973 @@ bool AVVMResourceManagerComponentTest::RunTest(const FString& Parameters)
 /**
  *	Class description:
  *
- *	AVVMTickSchedulerTest is an Automated Test running validation on ability loading process and attribute initialization.
+ *	AVVMTickSchedulerTest is an Automated Test running validation on the UAVVMTickScheduler slot map, deferred registration, priority
+ *	levels, budget deferral, and parallel lane. Settings are written on the scheduler directly, and the moving average cost is frozen
+ *	so deferral doesn't depend on the machine running the test.
  */
 IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMTickSchedulerTest, "AutomatedTest.CustomGroup.AVVMTickSchedulerTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
 bool AVVMTickSchedulerTest::RunTest(const FString& Parameters)
 {
-	// Make the test pass by returning true, or fail by returning false.
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	// @gdemers unbounded, and without priority change, unless a case says otherwise.
+	const TStrongObjectPtr<UAVVMTickScheduler> Scheduler(NewObject<UAVVMTickScheduler>(World));
+	Scheduler->TickRate = 0.f;
+	Scheduler->MaxStaleness = 0.125f;
+	Scheduler->GlobalJobAllotment = MAX_flt;
+	Scheduler->GlobalResetTimeJobQueuePriority = MAX_flt;
+	Scheduler->CostSmoothingFactor = 0.f;
+	Scheduler->bAllowParallelTick = true;
+
+	static constexpr float FrameDeltaTime = (1.f / 32.f);
+	static constexpr float BoundedTickRate = 0.001f;
+	/*Cost, in seconds, no bounded budget can cover*/
+	static constexpr double PinnedCostPerEntity = 1.0;
+
+	UClass* ClassA = AAVVMAutomatedTestTickingActor_A::StaticClass();
+	UClass* ClassB = AAVVMAutomatedTestTickingActor_B::StaticClass();
+	UClass* ClassParallel = AAVVMAutomatedTestTickingActor_Parallel::StaticClass();
+
+	const auto Spawn = [World, &Scheduler](UClass* ActorClass)
+	{
+		auto* Actor = World->SpawnActor<AAVVMAutomatedTestTickingActor>(ActorClass);
+		if (IsValid(Actor))
+		{
+			Scheduler->Register(TScriptInterface<IAVVMDoesSupportManualTicking>(Actor));
+		}
+
+		return Actor;
+	};
+
+	// @gdemers runners are stored by value. fetch again after any registration of a new class.
+	const auto GetRunnerIndex = [&Scheduler](const UClass* ActorClass)
+	{
+		const int32* RunnerIndex = Scheduler->MultiLevelFeedbackQueue.RunnerIndices_Actor.Find(ActorClass);
+		return (RunnerIndex != nullptr) ? *RunnerIndex : INDEX_NONE;
+	};
+
+	const auto GetRunner = [&Scheduler, &GetRunnerIndex](const UClass* ActorClass) -> UAVVMTickScheduler::FAVVMRunner_Actor&
+	{
+		return Scheduler->MultiLevelFeedbackQueue.Runners_Actor[GetRunnerIndex(ActorClass)];
+	};
+
+	AAVVMAutomatedTestTickingActor* A0 = Spawn(ClassA);
+	AAVVMAutomatedTestTickingActor* A1 = Spawn(ClassA);
+	AAVVMAutomatedTestTickingActor* A2 = Spawn(ClassA);
+	UTEST_TRUE("Spawned Actors.", IsValid(A0) && IsValid(A1) && IsValid(A2))
+
+	// @gdemers swap-remove. the last entity takes the removed entity place, and its slot is redirected.
+	const UAVVMTickScheduler::FAVVMTickHandle HandleA0 = Scheduler->TickerHandles.FindRef(A0);
+	const UAVVMTickScheduler::FAVVMTickHandle HandleA2 = Scheduler->TickerHandles.FindRef(A2);
+	Scheduler->UnRegister(TScriptInterface<IAVVMDoesSupportManualTicking>(A0));
+
+	UTEST_EQUAL("Num Entities after UnRegister.", GetRunner(ClassA).Entities.Num(), 2)
+	UTEST_EQUAL("Redirected Dense Index.", Scheduler->MultiLevelFeedbackQueue.Slots[HandleA2.SlotIndex].DenseIndex, 0)
+	UTEST_EQUAL("Redirected Slot Index.", GetRunner(ClassA).SlotIndices[0], HandleA2.SlotIndex)
+	UTEST_TRUE("Redirected Entity.", GetRunner(ClassA).Entities[0].Get() == A2)
+
+	// @gdemers the freed slot is reused under a new generation. the handle of the removed entity is stale, and ignored.
+	AAVVMAutomatedTestTickingActor* A3 = Spawn(ClassA);
+	UTEST_NOT_NULL("Spawned Actor.", A3)
+
+	const UAVVMTickScheduler::FAVVMTickHandle HandleA3 = Scheduler->TickerHandles.FindRef(A3);
+	UTEST_EQUAL("Reused Slot.", HandleA3.SlotIndex, HandleA0.SlotIndex)
+	UTEST_NOT_EQUAL("Bumped Generation.", HandleA3.Generation, HandleA0.Generation)
+
+	Scheduler->MultiLevelFeedbackQueue.Pop(HandleA0);
+	UTEST_EQUAL("Stale Handle Ignored.", GetRunner(ClassA).Entities.Num(), 3)
+	UTEST_TRUE("Stale Handle Entity Kept.", GetRunner(ClassA).Entities[Scheduler->MultiLevelFeedbackQueue.Slots[HandleA3.SlotIndex].DenseIndex].Get() == A3)
+
+	// @gdemers registration, and removal, requested while ticking are deferred until every runner executed.
+	AAVVMAutomatedTestTickingActor* Late = nullptr;
+	int32 NumEntitiesDuringTick = INDEX_NONE;
+	A2->OnTicked = [&](AAVVMAutomatedTestTickingActor&)
+	{
+		Late = Spawn(ClassB);
+		Scheduler->UnRegister(TScriptInterface<IAVVMDoesSupportManualTicking>(A1));
+		NumEntitiesDuringTick = GetRunner(ClassA).Entities.Num();
+	};
+
+	Scheduler->Tick(FrameDeltaTime);
+	A2->OnTicked = nullptr;
+
+	UTEST_NOT_NULL("Spawned Actor while Ticking.", Late)
+	UTEST_EQUAL("Num Entities while Ticking.", NumEntitiesDuringTick, 3)
+	UTEST_EQUAL("Late Entity Ticks.", Late->GetNumTicks(), 0)
+	UTEST_TRUE("Pending Operations Flushed.", Scheduler->PendingRegistrations.IsEmpty() && Scheduler->PendingRemovals.IsEmpty())
+	UTEST_TRUE("Registered after Tick.", Scheduler->TickerHandles.Contains(Late))
+	UTEST_FALSE("UnRegistered after Tick.", Scheduler->TickerHandles.Contains(A1))
+	UTEST_EQUAL("Num Entities after Tick.", GetRunner(ClassA).Entities.Num(), 2)
+
+	const int32 NumTicksA1 = A1->GetNumTicks();
+	Scheduler->Tick(FrameDeltaTime);
+	UTEST_EQUAL("Late Entity Ticked.", Late->GetNumTicks(), 1)
+	UTEST_EQUAL("Removed Entity Ticks.", A1->GetNumTicks(), NumTicksA1)
+
+	// @gdemers priority changes compare the projected cost of a class (i.e - cost per entity, times entity count) against the allotment.
+	// the runner taking the demoted runner place in its job queue is redirected.
+	Scheduler->GlobalJobAllotment = 1.f;
+	GetRunner(ClassA).AverageCostPerEntity = PinnedCostPerEntity;
+	GetRunner(ClassB).AverageCostPerEntity = 0.0;
+
+	Scheduler->Tick(FrameDeltaTime);
+	UTEST_EQUAL("Demoted Level.", GetRunner(ClassA).PriorityLevel, 1)
+	UTEST_EQUAL("Num Demotions.", GetRunner(ClassA).Counters.NumDemotions, 1)
+	UTEST_TRUE("Demoted Job Queue.", Scheduler->MultiLevelFeedbackQueue.PriorityQueue[1].Jobs_Actor[GetRunner(ClassA).JobIndex] == GetRunnerIndex(ClassA))
+	UTEST_TRUE("Redirected Job Queue.", Scheduler->MultiLevelFeedbackQueue.PriorityQueue[0].Jobs_Actor[GetRunner(ClassB).JobIndex] == GetRunnerIndex(ClassB))
+
+	const int32 NumTicksA2 = A2->GetNumTicks();
+	GetRunner(ClassA).AverageCostPerEntity = 0.0;
+
+	Scheduler->Tick(FrameDeltaTime);
+	UTEST_EQUAL("Demoted Entity Ticked.", A2->GetNumTicks(), NumTicksA2 + 1)
+	UTEST_EQUAL("Promoted Level.", GetRunner(ClassA).PriorityLevel, 0)
+	UTEST_EQUAL("Num Promotions.", GetRunner(ClassA).Counters.NumPromotions, 1)
+	UTEST_TRUE("Promoted Job Queue.", Scheduler->MultiLevelFeedbackQueue.PriorityQueue[0].Jobs_Actor[GetRunner(ClassA).JobIndex] == GetRunnerIndex(ClassA))
+
+	Scheduler->GlobalJobAllotment = MAX_flt;
+
+	// @gdemers bounded serial lane. only stale entities tick, and the cursor stops on the first deferred entity. dense storage
+	// is {A2, A3, A4}, A2 alone is stale.
+	AAVVMAutomatedTestTickingActor* A4 = Spawn(ClassA);
+	UTEST_NOT_NULL("Spawned Actor.", A4)
+
+	{
+		const double WorldTime = World->GetTimeSeconds();
+
+		UAVVMTickScheduler::FAVVMRunner_Actor& RunnerA = GetRunner(ClassA);
+		UTEST_TRUE("Dense Order.", (RunnerA.Entities[0].Get() == A2) && (RunnerA.Entities[1].Get() == A3) && (RunnerA.Entities[2].Get() == A4))
+
+		RunnerA.AverageCostPerEntity = PinnedCostPerEntity;
+		RunnerA.Cursor = 0;
+		RunnerA.LastTickTimes = {WorldTime - Scheduler->MaxStaleness, WorldTime, WorldTime};
+	}
+
+	TArray<const AAVVMAutomatedTestTickingActor*> TickOrder;
+	for (AAVVMAutomatedTestTickingActor* Actor : {A2, A3, A4})
+	{
+		Actor->OnTicked = [&TickOrder](AAVVMAutomatedTestTickingActor& Ticked)
+		{
+			TickOrder.Add(&Ticked);
+		};
+	}
+
+	Scheduler->TickRate = BoundedTickRate;
+	Scheduler->Tick(FrameDeltaTime);
+	UTEST_EQUAL("Num Stale Ticked.", TickOrder.Num(), 1)
+	UTEST_TRUE("Stale Entity Ticked.", TickOrder[0] == A2)
+	UTEST_EQUAL_TOLERANCE("Stale Entity Delta Time.", A2->GetLastDeltaTime(), Scheduler->MaxStaleness, KINDA_SMALL_NUMBER)
+	UTEST_EQUAL("Num Deferred.", GetRunner(ClassA).Counters.NumDeferred, 2)
+	UTEST_EQUAL("Cursor on First Deferred.", GetRunner(ClassA).Cursor, 1)
+
+	// @gdemers the next pass start at the cursor, so entities deferred on the previous pass run first.
+	TickOrder.Reset();
+	Scheduler->TickRate = 0.f;
+	Scheduler->Tick(FrameDeltaTime);
+	UTEST_EQUAL("Num Resumed Ticked.", TickOrder.Num(), 3)
+	UTEST_TRUE("Resumed Order.", (TickOrder[0] == A3) && (TickOrder[1] == A4) && (TickOrder[2] == A2))
+
+	for (AAVVMAutomatedTestTickingActor* Actor : {A2, A3, A4})
+	{
+		Actor->OnTicked = nullptr;
+	}
+
+	// @gdemers whatever the budget, an entity doesn't go longer than MaxStaleness without ticking. 4 frames here.
+	static constexpr int32 NumStalenessFrames = 8;
+	const TArray<AAVVMAutomatedTestTickingActor*> StalenessActors = {A2, A3, A4};
+
+	TArray<int32> NumTicksBefore;
+	for (const AAVVMAutomatedTestTickingActor* Actor : StalenessActors)
+	{
+		NumTicksBefore.Add(Actor->GetNumTicks());
+	}
+
+	{
+		UAVVMTickScheduler::FAVVMRunner_Actor& RunnerA = GetRunner(ClassA);
+		RunnerA.AverageCostPerEntity = PinnedCostPerEntity;
+		for (double& LastTickTime : RunnerA.LastTickTimes)
+		{
+			LastTickTime = World->GetTimeSeconds();
+		}
+	}
+
+	Scheduler->TickRate = BoundedTickRate;
+	for (int32 Frame = 0; Frame < NumStalenessFrames; ++Frame)
+	{
+		TestWorld.TickTestWorld(FrameDeltaTime);
+		Scheduler->Tick(FrameDeltaTime);
+	}
+
+	for (int32 i = 0; i < StalenessActors.Num(); ++i)
+	{
+		UTEST_EQUAL("Num Stale Ticks.", StalenessActors[i]->GetNumTicks() - NumTicksBefore[i], 2)
+		UTEST_EQUAL_TOLERANCE("Stale Delta Time.", StalenessActors[i]->GetLastDeltaTime(), Scheduler->MaxStaleness, KINDA_SMALL_NUMBER)
+	}
+
+	// @gdemers parallel runners are kept off the priority levels. ParallelTick run on workers, and CommitTick on the game thread
+	// once joined.
+	static constexpr int32 NumParallelActors = 3;
+
+	TArray<AAVVMAutomatedTestTickingActor*> ParallelActors;
+	for (int32 i = 0; i < NumParallelActors; ++i)
+	{
+		ParallelActors.Add(Spawn(ClassParallel));
+		UTEST_NOT_NULL("Spawned Parallel Actor.", ParallelActors.Last())
+	}
+
+	Scheduler->TickRate = 0.f;
+	Scheduler->Tick(FrameDeltaTime);
+	UTEST_TRUE("Parallel Runner.", GetRunner(ClassParallel).bDoesSupportParallelTick)
+	UTEST_TRUE("Parallel Job Queue.", Scheduler->MultiLevelFeedbackQueue.ParallelJobQueue.Jobs_Actor.Contains(GetRunnerIndex(ClassParallel)))
+	UTEST_EQUAL("Parallel Lane Num Ticked.", Scheduler->GetStats().ParallelLane.NumTicked, NumParallelActors)
+
+	for (const AAVVMAutomatedTestTickingActor* Actor : ParallelActors)
+	{
+		UTEST_EQUAL("Committed Ticks.", Actor->GetNumTicks(), 1)
+	}
+
+	TestWorld.EndPlayInTestWorld();
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMTickSchedulerDefaultRuleTest is an Automated Test running validation on a UAVVMTickSchedulerRule left to its defaults. A TickRate
+ *	of 0 leave the serial lane unbounded, so every entity tick each frame, and none are deferred until stale.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMTickSchedulerDefaultRuleTest, "AutomatedTest.CustomGroup.AVVMTickSchedulerDefaultRuleTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMTickSchedulerDefaultRuleTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	// @gdemers rule getters return console overrides when enabled. the rule defaults wouldn't be under test.
+	if (FAVVMGameplayModule::GetCVarEnableOverrideTickSchedulerRule()->GetBool())
+	{
+		AddWarning(TEXT("c.SetTickSchedulerRule is enabled. Rule defaults are overridden by console variables."));
+		return true;
+	}
+
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	const TStrongObjectPtr<UAVVMTickSchedulerRule> Rule(NewObject<UAVVMTickSchedulerRule>(GetTransientPackage()));
+	const TStrongObjectPtr<UAVVMTickScheduler> Scheduler(NewObject<UAVVMTickScheduler>(World));
+	Scheduler->TickSchedulerRule = Rule.Get();
+	Scheduler->InitRule();
+
+	// @gdemers frames shorter than the default MaxStaleness. a bounded serial lane would defer every entity until stale.
+	static constexpr int32 NumActors = 8;
+	static constexpr int32 NumFrames = 12;
+	static constexpr float FrameDeltaTime = (1.f / 64.f);
+
+	TArray<AAVVMAutomatedTestTickingActor*> Actors;
+	for (int32 i = 0; i < NumActors; ++i)
+	{
+		UClass* ActorClass = ((i % 2) == 0) ? AAVVMAutomatedTestTickingActor_A::StaticClass() : AAVVMAutomatedTestTickingActor_B::StaticClass();
+		auto* Actor = World->SpawnActor<AAVVMAutomatedTestTickingActor>(ActorClass);
+		UTEST_NOT_NULL("Spawned Actor.", Actor)
+
+		Scheduler->Register(TScriptInterface<IAVVMDoesSupportManualTicking>(Actor));
+		Actors.Add(Actor);
+	}
+
+	for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+	{
+		TestWorld.TickTestWorld(FrameDeltaTime);
+		Scheduler->Tick(FrameDeltaTime);
+
+		int32 NumTicked = 0;
+		int32 NumDeferred = 0;
+		for (const FAVVMTickSchedulerCounters& LevelCounters : Scheduler->GetStats().Levels)
+		{
+			NumTicked += LevelCounters.NumTicked;
+			NumDeferred += LevelCounters.NumDeferred;
+		}
+
+		UTEST_EQUAL("Num Ticked per Frame.", NumTicked, NumActors)
+		UTEST_EQUAL("Num Deferred per Frame.", NumDeferred, 0)
+	}
+
+	for (const AAVVMAutomatedTestTickingActor* Actor : Actors)
+	{
+		UTEST_EQUAL("Num Ticks.", Actor->GetNumTicks(), NumFrames)
+		UTEST_EQUAL_TOLERANCE("Last Delta Time.", Actor->GetLastDeltaTime(), FrameDeltaTime, KINDA_SMALL_NUMBER)
+	}
+
+	TestWorld.EndPlayInTestWorld();
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMPositionHistoryTest is an Automated Test running validation on position sampler history rewind.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMPositionHistoryTest, "AutomatedTest.CustomGroup.AVVMPositionHistoryTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMPositionHistoryTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	using FAVVMPositionHistory = UAVVMPositionSamplerSubsystem::FAVVMPositionHistory;
+
+	FAVVMPositionHistory PositionHistory;
+	const int32 SlotA = PositionHistory.AddSlot();
+	const int32 SlotB = PositionHistory.AddSlot();
+	UTEST_NOT_EQUAL("Dense Slots.", SlotA, SlotB)
+
+	// @gdemers wrap around the ring buffer, so only the most recent SampleSize samples remain.
+	const FVector Extent = FVector(34.0, 34.0, 88.0);
+	const int32 NumSamples = FAVVMPositionHistory::SampleSize + (FAVVMPositionHistory::SampleSize / 2);
+	for (int32 i = 0; i < NumSamples; ++i)
+	{
+		PositionHistory.Sample(SlotA, i, FVector(i * 10.0, 0.0, 0.0), Extent);
+		PositionHistory.Sample(SlotB, i, FVector(0.0, i * 10.0, 0.0), Extent);
+	}
+
+	// @gdemers out of order samples are discarded.
+	PositionHistory.Sample(SlotA, 0.0, FVector::ZeroVector, Extent);
+
+	const FBoxCenterAndExtent Interpolated = PositionHistory.GetClosestSample(SlotA, NumSamples - 10.5);
+	UTEST_EQUAL_TOLERANCE("Interpolated Sample.", Interpolated.Center.X, (NumSamples - 10.5) * 10.0, UE_KINDA_SMALL_NUMBER)
+
+	const FBoxCenterAndExtent Oldest = PositionHistory.GetClosestSample(SlotB, NumSamples - FAVVMPositionHistory::SampleSize);
+	UTEST_EQUAL_TOLERANCE("Oldest Sample.", Oldest.Center.Y, (NumSamples - FAVVMPositionHistory::SampleSize) * 10.0, UE_KINDA_SMALL_NUMBER)
+
+	const FBoxCenterAndExtent Newest = PositionHistory.GetClosestSample(SlotB, NumSamples - 1);
+	UTEST_EQUAL_TOLERANCE("Newest Sample.", Newest.Center.Y, (NumSamples - 1) * 10.0, UE_KINDA_SMALL_NUMBER)
+
+	// @gdemers released slots are reused.
+	PositionHistory.RemoveSlot(SlotA);
+	UTEST_EQUAL("Recycled Slot.", PositionHistory.AddSlot(), SlotA)
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMPoseHistoryTest is an Automated Test running validation on pose history quantization, rewind between snapshots, and traces
+ *	against poses recorded from a mesh.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMPoseHistoryTest, "AutomatedTest.CustomGroup.AVVMPoseHistoryTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMPoseHistoryTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	using FAVVMPoseHistory = UAVVMPositionSamplerSubsystem::FAVVMPoseHistory;
+
+	// @gdemers no mesh. snapshots are written by hand, so the test doesn't depend on an animated server mesh.
+	FAVVMPoseHistory PoseHistory;
+	PoseHistory.Init(nullptr, 1, 4);
+
+	// @gdemers smallest three. 20 bits over [-1/sqrt(2), 1/sqrt(2)] is a step of ~1.35e-6 per component, so the round trip
+	// stays well below 0.001 degree. edge cases cover a dropped w, a negative largest component, and ties.
+	TArray<FQuat> Rotations = {FQuat::Identity,
+	                           FQuat(FVector::XAxisVector, UE_PI),
+	                           FQuat(-0.5, -0.5, 0.5, -0.5),
+	                           FQuat(0.5, 0.5, 0.5, 0.5)};
+
+	FRandomStream RandomStream(1337);
+	for (int32 i = 0; i < 1024; ++i)
+	{
+		Rotations.Add(FQuat(RandomStream.VRand(), RandomStream.FRandRange(-UE_PI, UE_PI)));
+	}
+
+	double MaxRotationError = 0.0;
+	for (const FQuat& Rotation : Rotations)
+	{
+		PoseHistory.SetBoneTransform(0, 0, FTransform(Rotation));
+		MaxRotationError = FMath::Max(MaxRotationError, FMath::RadiansToDegrees(Rotation.AngularDistance(PoseHistory.GetBoneTransform(0, 0).GetRotation())));
+	}
+
+	UTEST_TRUE("Smallest Three Round Trip.", MaxRotationError < 0.001)
+
+	// @gdemers 1/32 cm precision, so half a step of error at most. out of range locations clamp to [-1024, 1023.96875] cm.
+	const FVector Location = FVector(12.3456, -1023.9, 0.01);
+	PoseHistory.SetBoneTransform(0, 0, FTransform(Location));
+	UTEST_TRUE("Location Round Trip.", PoseHistory.GetBoneTransform(0, 0).GetLocation().Equals(Location, 1.0 / 64.0))
+
+	PoseHistory.SetBoneTransform(0, 0, FTransform(FVector(2000.0, -2000.0, 1024.0)));
+	const FVector ClampedLocation = PoseHistory.GetBoneTransform(0, 0).GetLocation();
+	UTEST_EQUAL("Location Clamp Max.", ClampedLocation.X, MAX_int16 / 32.0)
+	UTEST_EQUAL("Location Clamp Min.", ClampedLocation.Y, MIN_int16 / 32.0)
+	UTEST_EQUAL("Location Clamp Upper Bound.", ClampedLocation.Z, MAX_int16 / 32.0)
+
+	auto AddSnapshot = [&PoseHistory](const double Timestamp, const uint8 PoseBodiesIndex, const FTransform& ComponentTransform, const FTransform& BoneTransform)
+	{
+		const int32 SnapshotIndex = PoseHistory.HeadIndex;
+		PoseHistory.Timestamps[SnapshotIndex] = Timestamp;
+		PoseHistory.PoseBodiesIndices[SnapshotIndex] = PoseBodiesIndex;
+		PoseHistory.SetComponentTransform(SnapshotIndex, ComponentTransform);
+		PoseHistory.SetBoneTransform(SnapshotIndex, 0, BoneTransform);
+		PoseHistory.HeadIndex = ((PoseHistory.HeadIndex + 1) % PoseHistory.Capacity);
+		PoseHistory.NumSnapshots = FMath::Min(PoseHistory.NumSnapshots + 1, PoseHistory.Capacity);
+	};
+
+	const FQuat LowerRotation = FQuat::Identity;
+	const FQuat UpperRotation = FQuat(FVector::ZAxisVector, UE_HALF_PI);
+	AddSnapshot(1.0, 0, FTransform::Identity, FTransform::Identity);
+	AddSnapshot(2.0, 0, FTransform(UpperRotation, FVector(100.0, 0.0, 0.0)), FTransform(UpperRotation, FVector(10.0, 20.0, 30.0)));
+
+	FAVVMPoseHistory::FAVVMPoseRewind Rewind;
+	UTEST_FALSE("Rewind Older Than History.", PoseHistory.TryRewind(0.5, Rewind))
+	UTEST_FALSE("Rewind Newer Than History.", PoseHistory.TryRewind(2.5, Rewind))
+
+	// @gdemers BlendWith is a lerp on location, and a normalized lerp on rotation.
+	UTEST_TRUE("Rewind Between Snapshots.", PoseHistory.TryRewind(1.25, Rewind))
+	UTEST_TRUE("Rewind Interpolate.", Rewind.bCanInterpolate)
+	UTEST_EQUAL_TOLERANCE("Rewind Alpha.", Rewind.Alpha, 0.25, UE_KINDA_SMALL_NUMBER)
+
+	const FTransform RewoundBoneTransform = PoseHistory.GetRewoundBoneTransform(Rewind, 0);
+	const FQuat ExpectedRotation = FQuat::FastLerp(LowerRotation, UpperRotation, 0.25).GetNormalized();
+	UTEST_TRUE("Rewound Bone Location.", RewoundBoneTransform.GetLocation().Equals(FVector(2.5, 5.0, 7.5), 1.0 / 32.0))
+	UTEST_TRUE("Rewound Bone Rotation.", FMath::RadiansToDegrees(ExpectedRotation.AngularDistance(RewoundBoneTransform.GetRotation())) < 0.01)
+	UTEST_TRUE("Rewound Component Location.", PoseHistory.GetRewoundComponentTransform(Rewind).GetLocation().Equals(FVector(25.0, 0.0, 0.0), UE_KINDA_SMALL_NUMBER))
+
+	// @gdemers exact timestamps resolve to their own snapshot.
+	UTEST_TRUE("Rewind Oldest Snapshot.", PoseHistory.TryRewind(1.0, Rewind))
+	UTEST_TRUE("Oldest Snapshot Location.", PoseHistory.GetRewoundBoneTransform(Rewind, 0).GetLocation().Equals(FVector::ZeroVector, UE_KINDA_SMALL_NUMBER))
+	UTEST_TRUE("Rewind Newest Snapshot.", PoseHistory.TryRewind(2.0, Rewind))
+	UTEST_TRUE("Newest Snapshot Location.", PoseHistory.GetRewoundBoneTransform(Rewind, 0).GetLocation().Equals(FVector(10.0, 20.0, 30.0), 1.0 / 64.0))
+
+	// @gdemers snapshots recorded with different physics asset aren't interpolated. we snap to the upper one.
+	AddSnapshot(3.0, 1, FTransform::Identity, FTransform(FVector(-10.0, 0.0, 0.0)));
+	UTEST_TRUE("Rewind Across Physics Asset Swap.", PoseHistory.TryRewind(2.5, Rewind))
+	UTEST_FALSE("Physics Asset Swap Interpolate.", Rewind.bCanInterpolate)
+	UTEST_TRUE("Physics Asset Swap Location.", PoseHistory.GetRewoundBoneTransform(Rewind, 0).GetLocation().Equals(FVector(-10.0, 0.0, 0.0), 1.0 / 64.0))
+
+	// @gdemers wrap around the ring buffer, so the oldest snapshot is dropped.
+	AddSnapshot(4.0, 1, FTransform::Identity, FTransform(FVector(-20.0, 0.0, 0.0)));
+	AddSnapshot(5.0, 1, FTransform::Identity, FTransform(FVector(-30.0, 0.0, 0.0)));
+	UTEST_FALSE("Rewind Dropped Snapshot.", PoseHistory.TryRewind(1.5, Rewind))
+	UTEST_TRUE("Rewind After Wrap Around.", PoseHistory.TryRewind(4.5, Rewind))
+	UTEST_TRUE("Wrap Around Location.", PoseHistory.GetRewoundBoneTransform(Rewind, 0).GetLocation().Equals(FVector(-25.0, 0.0, 0.0), 1.0 / 32.0))
+
+	// @gdemers record through Sample, so bodies are resolved by FindOrAddBodies. a single root bone, with a sphere body. the mesh
+	// isn't animated, so the bone stays at the component origin, and only the component moves between snapshots.
+	const FName RootBoneName = TEXT("Root");
+
+	auto* SkeletalMesh = NewObject<USkeletalMesh>(GetTransientPackage());
+	{
+		FReferenceSkeletonModifier RefSkeletonModifier(SkeletalMesh->GetRefSkeleton(), nullptr);
+		RefSkeletonModifier.Add(FMeshBoneInfo(RootBoneName, RootBoneName.ToString(), INDEX_NONE), FTransform::Identity);
+	}
+
+	constexpr float SphereRadius = 10.f;
+	auto* PhysicsAsset = NewObject<UPhysicsAsset>(GetTransientPackage());
+	auto* BodySetup = NewObject<USkeletalBodySetup>(PhysicsAsset);
+	BodySetup->BoneName = RootBoneName;
+	BodySetup->AggGeom.SphereElems.Add(FKSphereElem(SphereRadius));
+	PhysicsAsset->SkeletalBodySetups.Add(BodySetup);
+	SkeletalMesh->SetPhysicsAsset(PhysicsAsset);
+
+	auto* MeshComponent = NewObject<USkeletalMeshComponent>(GetTransientPackage());
+	MeshComponent->SetSkeletalMeshAsset(SkeletalMesh);
+	UTEST_TRUE("Mesh Physics Asset.", MeshComponent->GetPhysicsAsset() == PhysicsAsset)
+
+	FAVVMPoseHistory SampledPoseHistory;
+	SampledPoseHistory.Init(MeshComponent, 1, 4);
+
+	MeshComponent->SetWorldLocation(FVector::ZeroVector);
+	SampledPoseHistory.Sample(1.0);
+	MeshComponent->SetWorldLocation(FVector(100.0, 0.0, 0.0));
+	SampledPoseHistory.Sample(2.0);
+
+	UTEST_EQUAL("Sampled Snapshots.", SampledPoseHistory.NumSnapshots, 2)
+	UTEST_EQUAL("Sampled Pose Bodies.", SampledPoseHistory.PoseBodies.Num(), 1)
+	UTEST_EQUAL("Sampled Bodies.", SampledPoseHistory.PoseBodies[0].BoneIndices.Num(), 1)
+	UTEST_EQUAL("Bodies Found.", SampledPoseHistory.FindOrAddBodies(PhysicsAsset), 0)
+
+	// @gdemers halfway between snapshots, the body is centered on X = 50.
+	FAVVMTraceContextArgs Params;
+	Params.HitTime = 1.5;
+	Params.Tolerance = 1.0;
+	Params.TraceStart = FVector(50.0, 0.0, -100.0);
+	Params.TraceEnd = FVector(50.0, 0.0, 100.0);
+
+	FName HitBoneName = NAME_None;
+	UTEST_TRUE("Interpolated Pose Hit.", SampledPoseHistory.DoesTraceIntersect(Params, HitBoneName))
+	UTEST_TRUE("Interpolated Pose Hit Bone.", HitBoneName == RootBoneName)
+
+	// @gdemers the body was there on the oldest snapshot, but has moved away since.
+	Params.TraceStart = FVector(0.0, 0.0, -100.0);
+	Params.TraceEnd = FVector(0.0, 0.0, 100.0);
+	UTEST_FALSE("Interpolated Pose Miss.", SampledPoseHistory.DoesTraceIntersect(Params, HitBoneName))
+	UTEST_TRUE("Interpolated Pose Miss Bone.", HitBoneName.IsNone())
+
+	Params.HitTime = 1.0;
+	UTEST_TRUE("Oldest Pose Hit.", SampledPoseHistory.DoesTraceIntersect(Params, HitBoneName))
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMTraceBatchTest is an Automated Test running validation on the batched trace kernel, against per-trace validation.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMTraceBatchTest, "AutomatedTest.CustomGroup.AVVMTraceBatchTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMTraceBatchTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	// @gdemers the subsystem isn't created in a standalone world. it's built directly, and characters are registered by hand.
+	auto* Subsystem = NewObject<UAVVMPositionSamplerSubsystem>(World);
+	UTEST_NOT_NULL("UAVVMPositionSamplerSubsystem.", Subsystem)
+
+	// @gdemers 5 characters, so the last block of 4 lanes hold 3 padding lanes.
+	constexpr int32 NumCharacters = 5;
+	const FVector Extent = FVector(34.0, 34.0, 88.0);
+
+	TArray<AAVVMCharacter*> Characters;
+	for (int32 i = 0; i < NumCharacters; ++i)
+	{
+		auto* Character = World->SpawnActor<AAVVMCharacter>();
+		UTEST_NOT_NULL("Spawned Character.", Character)
+
+		Subsystem->RegisterCharacter(Character);
+		Characters.Add(Character);
+
+		// @gdemers characters move along Y over time, so traces at different HitTimes are rewound differently.
+		const int32 SlotIndex = Subsystem->ActorToSlotIndex.FindChecked(Character);
+		for (int32 Timestamp = 0; Timestamp < 4; ++Timestamp)
+		{
+			Subsystem->PositionHistory.Sample(SlotIndex, Timestamp, FVector(i * 200.0, Timestamp * 25.0, 100.0 + (i * 10.0)), Extent);
+		}
+	}
+
+	FRandomStream RandomStream(0x41564D4D);
+	const double HitTimes[] = {0.0, 0.5, 1.25, 3.0};
+
+	TArray<FAVVMTraceContextArgs> Traces;
+	for (int32 i = 0; i < 256; ++i)
+	{
+		FAVVMTraceContextArgs& Params = Traces.AddDefaulted_GetRef();
+		Params.HitActor = Characters[i % NumCharacters];
+		Params.HitTime = HitTimes[i % UE_ARRAY_COUNT(HitTimes)];
+		Params.Tolerance = RandomStream.FRandRange(0.0, 10.0);
+		Params.TraceStart = FVector(RandomStream.FRandRange(-200.0, 1000.0), RandomStream.FRandRange(-200.0, 300.0), RandomStream.FRandRange(-100.0, 400.0));
+		Params.TraceEnd = FVector(RandomStream.FRandRange(-200.0, 1000.0), RandomStream.FRandRange(-200.0, 300.0), RandomStream.FRandRange(-100.0, 400.0));
+	}
+
+	// @gdemers traces parallel to the capsule segments. along the axis, grazing the radius, and just outside of it.
+	for (int32 i = 0; i < NumCharacters; ++i)
+	{
+		const FVector Base = FVector(i * 200.0, 0.0, 0.0);
+		for (const double Offset : {0.0, Extent.X - 1.0, Extent.X + 1.0})
+		{
+			FAVVMTraceContextArgs& Params = Traces.AddDefaulted_GetRef();
+			Params.HitActor = Characters[i];
+			Params.TraceStart = Base + FVector(Offset, 0.0, -50.0);
+			Params.TraceEnd = Base + FVector(Offset, 0.0, 400.0);
+		}
+	}
+
+	// @gdemers traces through the origin of the padding lanes, away from any character. padding must never resolve.
+	{
+		FAVVMTraceContextArgs& Params = Traces.AddDefaulted_GetRef();
+		Params.HitActor = Characters[0];
+		Params.HitTime = 3.0;
+		Params.TraceStart = FVector(-100.0, -100.0, -100.0);
+		Params.TraceEnd = FVector::ZeroVector;
+	}
+
+	// @gdemers degenerate trace, of length zero, inside a capsule.
+	{
+		FAVVMTraceContextArgs& Params = Traces.AddDefaulted_GetRef();
+		Params.HitActor = Characters[2];
+		Params.TraceStart = Params.TraceEnd = FVector(400.0, 0.0, 120.0);
+	}
+
+	TArray<FAVVMTraceResult> Results;
+	Subsystem->TraceBatch(Traces, Results);
+	UTEST_EQUAL("Results Count.", Results.Num(), Traces.Num())
+
+	for (int32 TraceIndex = 0; TraceIndex < Traces.Num(); ++TraceIndex)
+	{
+		const FAVVMTraceContextArgs& Params = Traces[TraceIndex];
+		const FAVVMTraceResult& Result = Results[TraceIndex];
+
+		bool bIsAmbiguous = false;
+		bool bExpectedIsValidated = false;
+		const AActor* ExpectedActor = nullptr;
+		double ClosestTraceTime = TNumericLimits<double>::Max();
+
+		for (const AAVVMCharacter* Character : Characters)
+		{
+			FAVVMTraceContextArgs CharacterParams = Params;
+			CharacterParams.HitActor = Character;
+
+			const FBoxCenterAndExtent Sample = Subsystem->GetSampleExtent(Character, Params.HitTime);
+			const bool bDoesIntersect = UAVVMTraceUtils::DoesTraceIntersectSample(Sample, CharacterParams);
+
+			// @gdemers traces landing on the tolerance boundary may differ by rounding between both paths. those are skipped.
+			FVector P1, P2;
+			FMath::SegmentDistToSegment(Sample.Center - FVector(0.0, 0.0, Sample.Extent.Z), Sample.Center + FVector(0.0, 0.0, Sample.Extent.Z), Params.TraceStart, Params.TraceEnd, P1, P2);
+			const double Dist = (P2 - P1).Size() - Sample.Extent.X;
+			bIsAmbiguous |= FMath::IsNearlyEqual(Dist, Params.Tolerance, 1e-3);
+
+			if (!bDoesIntersect)
+			{
+				continue;
+			}
+
+			bExpectedIsValidated |= (Character == Params.HitActor);
+
+			const FVector TraceDirection = (Params.TraceEnd - Params.TraceStart);
+			const double TraceTime = TraceDirection.IsNearlyZero() ? 0.0 : (((P2 - Params.TraceStart) | TraceDirection) / TraceDirection.SizeSquared());
+			if (TraceTime < ClosestTraceTime)
+			{
+				ClosestTraceTime = TraceTime;
+				ExpectedActor = Character;
+			}
+		}
+
+		if (bIsAmbiguous)
+		{
+			continue;
+		}
+
+		UTEST_EQUAL(*FString::Printf(TEXT("Trace %d Validated."), TraceIndex), Result.bIsValidated, bExpectedIsValidated)
+		UTEST_EQUAL(*FString::Printf(TEXT("Trace %d Resolved."), TraceIndex), (Result.ResolvedActor.Get() != nullptr), (ExpectedActor != nullptr))
+
+		if (ExpectedActor == nullptr)
+		{
+			continue;
+		}
+
+		const FBoxCenterAndExtent Sample = Subsystem->GetSampleExtent(Result.ResolvedActor.Get(), Params.HitTime);
+		FAVVMTraceContextArgs ResolvedParams = Params;
+		ResolvedParams.HitActor = Result.ResolvedActor.Get();
+		UTEST_TRUE(*FString::Printf(TEXT("Trace %d Resolved Actor Intersected."), TraceIndex), UAVVMTraceUtils::DoesTraceIntersectSample(Sample, ResolvedParams))
+
+		// @gdemers parallel segments have no unique closest pair, so both paths may resolve different, equally valid, actors.
+		const FVector TraceDirection = (Params.TraceEnd - Params.TraceStart);
+		const bool bIsParallel = FMath::IsNearlyZero(TraceDirection.X) && FMath::IsNearlyZero(TraceDirection.Y);
+		if (!bIsParallel)
+		{
+			UTEST_EQUAL(*FString::Printf(TEXT("Trace %d Closest Resolved Actor."), TraceIndex), Result.ResolvedActor.Get(), ExpectedActor)
+		}
+	}
+
+	const FAVVMTraceResult& PaddingResult = Results[Traces.Num() - 2];
+	UTEST_FALSE("Padding Lanes Validated.", PaddingResult.bIsValidated)
+	UTEST_NULL("Padding Lanes Resolved.", PaddingResult.ResolvedActor.Get())
+
+	const FAVVMTraceResult& DegenerateResult = Results[Traces.Num() - 1];
+	UTEST_TRUE("Degenerate Trace Validated.", DegenerateResult.bIsValidated)
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMActorPoolTest is an Automated Test running validation on actor recycling, and pool counters.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMActorPoolTest, "AutomatedTest.CustomGroup.AVVMActorPoolTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMActorPoolTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	auto* ActorPoolSubsystem = UWorld::GetSubsystem<UAVVMActorPoolSubsystem>(World);
+	UTEST_NOT_NULL("UAVVMActorPoolSubsystem.", ActorPoolSubsystem)
+
+	const UClass* ActorClass = AAVVMAutomatedTestGameplayActor::StaticClass();
+
+	// @gdemers classes that aren't pooled are destroyed on release.
+	AActor* Unpooled = UAVVMActorPoolSubsystem::Static_AcquireActor(World, ActorClass, FTransform::Identity);
+	UTEST_NOT_NULL("Spawned Actor.", Unpooled)
+	UAVVMActorPoolSubsystem::Static_ReleaseActor(World, Unpooled);
+	UTEST_TRUE("Destroyed Actor.", Unpooled->IsActorBeingDestroyed())
+
+	ActorPoolSubsystem->Pools.FindOrAdd(ActorClass).MaxPooledCount = 1;
+
+	AActor* ActorA = UAVVMActorPoolSubsystem::Static_AcquireActor(World, ActorClass, FTransform::Identity);
+	AActor* ActorB = UAVVMActorPoolSubsystem::Static_AcquireActor(World, ActorClass, FTransform::Identity);
+	UTEST_EQUAL("High Water Mark.", UAVVMActorPoolSubsystem::Static_GetPoolStats(World, ActorClass).HighWaterMark, 2)
+
+	// @gdemers the pool is full after the first release.
+	UAVVMActorPoolSubsystem::Static_ReleaseActor(World, ActorA);
+	UAVVMActorPoolSubsystem::Static_ReleaseActor(World, ActorB);
+	UTEST_TRUE("Pooled Actor Hidden.", ActorA->IsHidden())
+	UTEST_TRUE("Overflow Actor Destroyed.", ActorB->IsActorBeingDestroyed())
+
+	const FTransform Transform = FTransform(FVector(100.0, 0.0, 0.0));
+	AActor* Reused = UAVVMActorPoolSubsystem::Static_AcquireActor(World, ActorClass, Transform);
+	UTEST_EQUAL("Reused Actor.", Reused, ActorA)
+	UTEST_FALSE("Reused Actor Visible.", Reused->IsHidden())
+	UTEST_TRUE("Reused Actor Transform.", Reused->GetActorLocation().Equals(Transform.GetLocation()))
+
+	const FAVVMActorPoolStats Stats = UAVVMActorPoolSubsystem::Static_GetPoolStats(World, ActorClass);
+	UTEST_EQUAL("Num Reused.", Stats.NumReused, 1)
+	UTEST_EQUAL("Num Active.", Stats.NumActive, 1)
+
+	TestWorld.EndPlayInTestWorld();
+#endif
+	return true;
+}
+
+#if WITH_AUTOMATION_TESTS
+/**
+ *	Class description:
+ *
+ *	FAVVMScopedNetSettings override the backfill chunk size, and the client refresh budget, for the lifetime of a test.
+ */
+class FAVVMScopedNetSettings
+{
+public:
+	FAVVMScopedNetSettings(const int32 NewMaxNetFinalizedPerBackfillChunk, const float NewNetRefreshBudgetMilliseconds)
+	{
+		auto* Settings = GetMutableDefault<UAVVMGameplaySettings>();
+		PrevMaxNetFinalizedPerBackfillChunk = Settings->MaxNetFinalizedPerBackfillChunk;
+		PrevNetRefreshBudgetMilliseconds = Settings->NetRefreshBudgetMilliseconds;
+		Settings->MaxNetFinalizedPerBackfillChunk = NewMaxNetFinalizedPerBackfillChunk;
+		Settings->NetRefreshBudgetMilliseconds = NewNetRefreshBudgetMilliseconds;
+	}
+
+	~FAVVMScopedNetSettings()
+	{
+		auto* Settings = GetMutableDefault<UAVVMGameplaySettings>();
+		Settings->MaxNetFinalizedPerBackfillChunk = PrevMaxNetFinalizedPerBackfillChunk;
+		Settings->NetRefreshBudgetMilliseconds = PrevNetRefreshBudgetMilliseconds;
+	}
+
+private:
+	int32 PrevMaxNetFinalizedPerBackfillChunk = 0;
+	float PrevNetRefreshBudgetMilliseconds = 0.f;
+};
+#endif
+
+/**
+ *	Class description:
+ *
+ *	AVVMNetBackfillTest is an Automated Test running validation on backfill chunking, acknowledgement, and the budgeted client refresh.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMNetBackfillTest, "AutomatedTest.CustomGroup.AVVMNetBackfillTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMNetBackfillTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	auto* NetManager = UWorld::GetSubsystem<UAVVMNetSynchronizationManager>(World);
+	UTEST_NOT_NULL("UAVVMNetSynchronizationManager.", NetManager)
+
+	// @gdemers chunks of 2 systems, and no refresh budget, so each frame refresh exactly one system.
+	FAVVMScopedNetSettings ScopedSettings(2, 0.f);
+
+	// @gdemers ignored acknowledgements are logged. the test world is standalone, so the client acknowledgement RPC execute locally.
+	// the first one creates the backfill state, without a chunk in flight, and the 2 later client chunks are ignored. the server
+	// side then ignores 2 mismatching versions, and a duplicate acknowledgement.
+	AddExpectedError(TEXT("Ignoring backfill acknowledgement"), EAutomationExpectedErrorFlags::Contains, 5);
+
+	// @gdemers the client refresh wait on a replicated game state.
+	if (!IsValid(World->GetGameState()))
+	{
+		World->SetGameState(World->SpawnActor<AGameStateBase>());
+	}
+
+	auto* PlayerState = World->SpawnActor<AAVVMPlayerState>();
+	UTEST_NOT_NULL("Spawned Player State.", PlayerState)
+
+	int32 NumFences = 0;
+	PlayerState->GetOnPostNetClientSynchronizationComplete().AddLambda([&NumFences](const AAVVMPlayerState* Target)
+	{
+		++NumFences;
+	});
+
+	AActor* Owner = World->SpawnActor<AActor>();
+	UTEST_NOT_NULL("Spawned Owner.", Owner)
+
+	const int32 Priorities[] = {0, 5, 1, 5, 3};
+	TArray<UAVVMAutomatedTestNetSynchronizationComponent*> Components;
+	TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>> NetFinalized;
+	for (const int32 Priority : Priorities)
+	{
+		auto* Component = NewObject<UAVVMAutomatedTestNetSynchronizationComponent>(Owner);
+		Component->Priority = Priority;
+		Components.Add(Component);
+		NetFinalized.Add(TScriptInterface<IAVVMDoesImplNetSynchronization>(Component));
+	}
+
+	// @gdemers client side first, while the server registry is empty, so the acknowledgement of each chunk doesn't send another one.
+	// systems are refreshed by priority, and in arrival order for equal priorities. the first chunk refresh once on arrival.
+	PlayerState->Client_OnNetFinalized_Implementation({NetFinalized[0], NetFinalized[1], NetFinalized[2]}, 3, false);
+	PlayerState->Client_OnNetFinalized_Implementation({NetFinalized[3], NetFinalized[4]}, 5, true);
+	UTEST_EQUAL("Refresh On Arrival.", Components[1]->NumRefreshes, 1)
+
+	const int32 ExpectedOrder[] = {3, 4, 2, 0};
+	for (int32 i = 0; i < UE_ARRAY_COUNT(ExpectedOrder); ++i)
+	{
+		UTEST_EQUAL("Fence Pending.", NumFences, 0)
+
+		PlayerState->ExecutePendingNetRefreshes();
+		UTEST_EQUAL("Refresh Order.", Components[ExpectedOrder[i]]->NumRefreshes, 1)
+
+		int32 NumRefreshes = 0;
+		for (const auto* Component : Components)
+		{
+			NumRefreshes += Component->NumRefreshes;
+		}
+
+		UTEST_EQUAL("One Refresh Per Frame.", NumRefreshes, i + 2)
+	}
+
+	UTEST_EQUAL("Fence Raised.", NumFences, 1)
+
+	// @gdemers a later delta is refreshed, but doesn't raise the fence again.
+	PlayerState->Client_OnNetFinalized_Implementation({NetFinalized[0]}, 6, true);
+	UTEST_EQUAL("Delta Refreshed.", Components[0]->NumRefreshes, 2)
+	UTEST_EQUAL("Fence Raised Once.", NumFences, 1)
+
+	// @gdemers server side. 5 systems, sent in chunks of 2, with a single chunk in flight.
+	for (const auto* Component : Components)
+	{
+		NetManager->Register(Component);
+	}
+
+	TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>> Chunk;
+	int32 Version = 0;
+	bool bIsFinalChunk = false;
+	UTEST_TRUE("First Chunk.", NetManager->GetNextBackfillChunk(PlayerState, true, Chunk, Version, bIsFinalChunk))
+	UTEST_EQUAL("First Chunk Size.", Chunk.Num(), 2)
+	UTEST_EQUAL("First Chunk Version.", Version, 2)
+	UTEST_FALSE("First Chunk Isn't Final.", bIsFinalChunk)
+
+	Chunk.Reset();
+	UTEST_FALSE("Chunk In Flight.", NetManager->GetNextBackfillChunk(PlayerState, true, Chunk, Version, bIsFinalChunk))
+
+	// @gdemers acknowledgements that don't match the chunk in flight are ignored.
+	NetManager->AcknowledgeBackfill(PlayerState, 5);
+	NetManager->AcknowledgeBackfill(PlayerState, 1);
+	UTEST_EQUAL("Ignored Acknowledgement.", NetManager->ClientBackfillStates.FindChecked(PlayerState).AcknowledgedVersion, 0)
+	UTEST_FALSE("Chunk Still In Flight.", NetManager->GetNextBackfillChunk(PlayerState, true, Chunk, Version, bIsFinalChunk))
+
+	NetManager->AcknowledgeBackfill(PlayerState, 2);
+	UTEST_TRUE("Second Chunk.", NetManager->GetNextBackfillChunk(PlayerState, false, Chunk, Version, bIsFinalChunk))
+	UTEST_EQUAL("Second Chunk Size.", Chunk.Num(), 2)
+	UTEST_EQUAL("Second Chunk Version.", Version, 4)
+	UTEST_FALSE("Second Chunk Isn't Final.", bIsFinalChunk)
+
+	NetManager->AcknowledgeBackfill(PlayerState, 4);
+	Chunk.Reset();
+	UTEST_TRUE("Last Chunk.", NetManager->GetNextBackfillChunk(PlayerState, false, Chunk, Version, bIsFinalChunk))
+	UTEST_EQUAL("Last Chunk Size.", Chunk.Num(), 1)
+	UTEST_EQUAL("Last Chunk Version.", Version, 5)
+	UTEST_TRUE("Last Chunk Is Final.", bIsFinalChunk)
+
+	NetManager->AcknowledgeBackfill(PlayerState, 5);
+	UTEST_EQUAL("Acknowledged Version.", NetManager->ClientBackfillStates.FindChecked(PlayerState).AcknowledgedVersion, 5)
+
+	// @gdemers up to date. nothing is sent, unless forced to fence the client synchronization.
+	Chunk.Reset();
+	UTEST_FALSE("Up To Date.", NetManager->GetNextBackfillChunk(PlayerState, false, Chunk, Version, bIsFinalChunk))
+	UTEST_TRUE("Forced Chunk.", NetManager->GetNextBackfillChunk(PlayerState, true, Chunk, Version, bIsFinalChunk))
+	UTEST_TRUE("Forced Chunk Is Empty.", Chunk.IsEmpty())
+	UTEST_TRUE("Forced Chunk Is Final.", bIsFinalChunk)
+
+	// @gdemers the first acknowledgement clears the forced chunk in flight. its duplicate, once nothing is in flight, is ignored.
+	UTEST_EQUAL("Forced Chunk In Flight.", NetManager->ClientBackfillStates.FindChecked(PlayerState).InFlightVersion, 5)
+	NetManager->AcknowledgeBackfill(PlayerState, 5);
+	UTEST_EQUAL("Forced Chunk Acknowledged.", NetManager->ClientBackfillStates.FindChecked(PlayerState).InFlightVersion, INDEX_NONE)
+	NetManager->AcknowledgeBackfill(PlayerState, 5);
+	UTEST_EQUAL("Nothing In Flight.", NetManager->ClientBackfillStates.FindChecked(PlayerState).InFlightVersion, INDEX_NONE)
+
+	TestWorld.EndPlayInTestWorld();
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMGameSessionPayloadTest is an Automated Test running validation on the serialized profiles, and presets, cached by the session.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMGameSessionPayloadTest, "AutomatedTest.CustomGroup.AVVMGameSessionPayloadTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMGameSessionPayloadTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	auto* GameSession = World->SpawnActor<AAVVMGameSession>();
+	UTEST_NOT_NULL("AAVVMGameSession.", GameSession)
+
+	// @gdemers a single connection, resolved to its profile, and preset.
+	constexpr int32 PlayerConnectionId = 1;
+
+	FAVVMPlayerProfile PlayerProfile;
+	PlayerProfile.UniqueId = 2;
+	PlayerProfile.InventoryIds = {3, 4};
+
+	FAVVMPlayerPreset PlayerPreset;
+	PlayerPreset.UniqueId = 5;
+
+	FAVVMBackendSessionPayload& SessionPayload = GameSession->SessionPayload;
+	SessionPayload.ProfileIds.Add(PlayerConnectionId, PlayerProfile.UniqueId);
+	SessionPayload.PresetIds.Add(PlayerProfile.UniqueId, PlayerPreset.UniqueId);
+	SessionPayload.ResolvedProfiles.Add(PlayerProfile.UniqueId, PlayerProfile);
+	SessionPayload.ResolvedPresets.Add(PlayerPreset.UniqueId, PlayerPreset);
+
+	const FString Payload = GameSession->ModifyPlayerProfileInventory(PlayerProfile.UniqueId, PlayerProfile.InventoryIds);
+	UTEST_FALSE("Serialized Profile.", Payload.IsEmpty())
+	UTEST_TRUE("Serialized Profile Cached.", SessionPayload.SerializedProfiles.Contains(PlayerProfile.UniqueId))
+	GameSession->SerializePlayerPreset(PlayerPreset.UniqueId);
+	UTEST_TRUE("Serialized Preset Cached.", SessionPayload.SerializedPresets.Contains(PlayerPreset.UniqueId))
+
+	// @gdemers tag the cached entry. it is only returned as is when the profile wasn't serialized again.
+	const FString CachedPayload = TEXT("AVVMGameSessionPayloadTest.Cached");
+	SessionPayload.SerializedProfiles[PlayerProfile.UniqueId] = CachedPayload;
+
+	UTEST_EQUAL("Same Items Aren't Serialized.", GameSession->ModifyPlayerProfileInventory(PlayerProfile.UniqueId, PlayerProfile.InventoryIds), CachedPayload)
+
+	const TArray<int32> NewItems = {3, 4, 6};
+	const FString NewPayload = GameSession->ModifyPlayerProfileInventory(PlayerProfile.UniqueId, NewItems);
+	UTEST_NOT_EQUAL("New Items Are Serialized.", NewPayload, CachedPayload)
+	UTEST_NOT_EQUAL("New Items Payload.", NewPayload, Payload)
+	UTEST_EQUAL("Resolved Profile Modified.", SessionPayload.ResolvedProfiles.FindChecked(PlayerProfile.UniqueId).InventoryIds, NewItems)
+	UTEST_EQUAL("Serialized Profile Cached {Post-modification}.", SessionPayload.SerializedProfiles.FindChecked(PlayerProfile.UniqueId), NewPayload)
+
+	// @gdemers a connection leaving drop both the typed, and serialized, representations.
+	GameSession->CleanupOldPlayerConnection(PlayerConnectionId);
+	UTEST_FALSE("Profile Id Removed.", SessionPayload.ProfileIds.Contains(PlayerConnectionId))
+	UTEST_FALSE("Preset Id Removed.", SessionPayload.PresetIds.Contains(PlayerProfile.UniqueId))
+	UTEST_FALSE("Resolved Profile Removed.", SessionPayload.ResolvedProfiles.Contains(PlayerProfile.UniqueId))
+	UTEST_FALSE("Resolved Preset Removed.", SessionPayload.ResolvedPresets.Contains(PlayerPreset.UniqueId))
+	UTEST_FALSE("Serialized Profile Removed.", SessionPayload.SerializedProfiles.Contains(PlayerProfile.UniqueId))
+	UTEST_FALSE("Serialized Preset Removed.", SessionPayload.SerializedPresets.Contains(PlayerPreset.UniqueId))
+
+	TestWorld.EndPlayInTestWorld();
+#endif
 	return true;
 }
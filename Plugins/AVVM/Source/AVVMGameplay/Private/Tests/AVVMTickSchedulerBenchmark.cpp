@@ -0,0 +1,399 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "Misc/AutomationTest.h"
+
+#include "AVVMAutomatedTestTickingActor.h"
+#include "AVVMGameplayModule.h"
+#include "AVVMTickScheduler.h"
+#include "AVVMTickSchedulerRule.h"
+#include "Algo/Accumulate.h"
+#include "Engine/World.h"
+#include "HAL/PlatformTime.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_AUTOMATION_TESTS
+#include "Tests/AutomationCommon.h"
+#endif
+
+#if WITH_AUTOMATION_TESTS
+namespace NSAVVMTickSchedulerBenchmark
+{
+	static constexpr int32 NumWarmupFrames = 30;
+	static constexpr int32 NumMeasuredFrames = 240;
+	static constexpr float FrameDeltaTime = (1.f / 60.f);
+	static constexpr int32 EntityCounts[] = {256, 2048, 8192};
+
+	enum class EBenchmarkMode : uint8
+	{
+		// @gdemers entities are spawned, but never ticked. baseline world tick cost to subtract from other rows.
+		Empty,
+		Native,
+		Scheduler
+	};
+
+	struct FBenchmarkSetting
+	{
+		const TCHAR* Name = nullptr;
+		EBenchmarkMode Mode = EBenchmarkMode::Native;
+		float TickRate = 0.f;
+		float GlobalJobAllotment = 0.f;
+		float MaxStaleness = 0.f;
+		bool bAllowParallelTick = false;
+	};
+
+	static const FBenchmarkSetting Settings[] =
+	{
+		{TEXT("Empty"), EBenchmarkMode::Empty},
+		{TEXT("Native"), EBenchmarkMode::Native},
+		// @gdemers budget large enough that nothing is deferred, or demoted. measure the dispatch cost alone.
+		{TEXT("Scheduler_Unbounded"), EBenchmarkMode::Scheduler, 1.f, 1.f, 0.1f, false},
+		{TEXT("Scheduler_Unbounded_Parallel"), EBenchmarkMode::Scheduler, 1.f, 1.f, 0.1f, true},
+		{TEXT("Scheduler_Budget2ms"), EBenchmarkMode::Scheduler, 0.002f, 0.0005f, 0.1f, true},
+		{TEXT("Scheduler_Budget500us"), EBenchmarkMode::Scheduler, 0.0005f, 0.0001f, 0.25f, true},
+	};
+
+	// @gdemers synthetic entities are spawned interleaved, so native registration order doesn't group them by class.
+	static const TArray<UClass*>& GetEntityClasses()
+	{
+		static const TArray<UClass*> EntityClasses =
+		{
+			AAVVMAutomatedTestTickingActor_A::StaticClass(),
+			AAVVMAutomatedTestTickingActor_B::StaticClass(),
+			AAVVMAutomatedTestTickingActor_C::StaticClass(),
+			AAVVMAutomatedTestTickingActor_Parallel::StaticClass(),
+			UAVVMAutomatedTestTickingComponent_A::StaticClass(),
+			UAVVMAutomatedTestTickingComponent_B::StaticClass()
+		};
+
+		return EntityClasses;
+	}
+
+	struct FBenchmarkResult
+	{
+		FString Name = FString();
+		int32 NumEntities = 0;
+		int32 NumClasses = 0;
+		double MeanMs = 0.0;
+		double P50Ms = 0.0;
+		double P95Ms = 0.0;
+		double P99Ms = 0.0;
+		double MaxMs = 0.0;
+		double TicksPerFrame = 0.0;
+		double TicksPerSecond = 0.0;
+		double NanosecondsPerTick = 0.0;
+		/*Ratio of consecutive ticks changing class. Instruction cache-miss proxy*/
+		double ClassSwitchesPerTick = 0.0;
+		/*Mean distance, in bytes, between two consecutive ticked entities. Data cache-miss proxy*/
+		double MeanAddressStride = 0.0;
+		double DeferredPerFrame = 0.0;
+
+		static FString GetCsvHeader()
+		{
+			return TEXT("Name,NumEntities,NumClasses,MeanMs,P50Ms,P95Ms,P99Ms,MaxMs,TicksPerFrame,TicksPerSecond,NanosecondsPerTick,ClassSwitchesPerTick,MeanAddressStride,DeferredPerFrame");
+		}
+
+		FString ToCsvRow() const
+		{
+			return FString::Printf(TEXT("%s,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.1f,%.1f,%.2f,%.4f,%.1f,%.1f"),
+			                       *Name,
+			                       NumEntities,
+			                       NumClasses,
+			                       MeanMs,
+			                       P50Ms,
+			                       P95Ms,
+			                       P99Ms,
+			                       MaxMs,
+			                       TicksPerFrame,
+			                       TicksPerSecond,
+			                       NanosecondsPerTick,
+			                       ClassSwitchesPerTick,
+			                       MeanAddressStride,
+			                       DeferredPerFrame);
+		}
+	};
+
+	// @gdemers nearest-rank percentile. expect sorted samples.
+	double GetPercentile(const TArray<double>& SortedSamples, const double Percentile)
+	{
+		if (SortedSamples.IsEmpty())
+		{
+			return 0.0;
+		}
+
+		const int32 Rank = FMath::CeilToInt32(Percentile * SortedSamples.Num()) - 1;
+		return SortedSamples[FMath::Clamp(Rank, 0, SortedSamples.Num() - 1)];
+	}
+}
+
+/**
+ *	Class description:
+ *
+ *	FAVVMTickSchedulerBenchmarkContext own a headless game world populated with synthetic entities, and drive it for a fixed number
+ *	of frames using either native tick functions, or a UAVVMTickScheduler configured from a benchmark setting. The scheduler isn't
+ *	created through the world subsystem collection (i.e - no AAVVMWorldSetting, or project rule in a test world), it's ticked manually
+ *	right after the world.
+ */
+class FAVVMTickSchedulerBenchmarkContext
+{
+public:
+	FAVVMTickSchedulerBenchmarkContext(const NSAVVMTickSchedulerBenchmark::FBenchmarkSetting& NewSetting, const int32 NewNumEntities)
+		: Setting(NewSetting),
+		  NumEntities(NewNumEntities)
+	{
+	}
+
+	~FAVVMTickSchedulerBenchmarkContext()
+	{
+		Cleanup();
+	}
+
+	bool Setup()
+	{
+		TestWorld = MakeShared<FTestWorldWrapper>();
+		TestWorld->CreateTestWorld(EWorldType::Game);
+		TestWorld->BeginPlayInTestWorld();
+
+		UWorld* World = TestWorld->GetTestWorld();
+		if (!IsValid(World))
+		{
+			return false;
+		}
+
+		if (Setting.Mode == NSAVVMTickSchedulerBenchmark::EBenchmarkMode::Scheduler)
+		{
+			Rule = TStrongObjectPtr(NewObject<UAVVMTickSchedulerRule>(GetTransientPackage()));
+			Rule->GlobalResetTimeJobQueuePriority = 1.f;
+			Rule->GlobalJobAllotment = Setting.GlobalJobAllotment;
+			Rule->TickRate = Setting.TickRate;
+			Rule->MaxStaleness = Setting.MaxStaleness;
+			Rule->bAllowParallelTick = Setting.bAllowParallelTick;
+
+			Scheduler = TStrongObjectPtr(NewObject<UAVVMTickScheduler>(World));
+			Scheduler->TickSchedulerRule = Rule.Get();
+			Scheduler->InitRule();
+		}
+
+		SpawnEntities(World);
+		return (Entities.Num() == NumEntities);
+	}
+
+	NSAVVMTickSchedulerBenchmark::FBenchmarkResult Run()
+	{
+		using namespace NSAVVMTickSchedulerBenchmark;
+
+		for (int32 i = 0; i < NumWarmupFrames; ++i)
+		{
+			ExecuteFrame();
+		}
+
+		FAVVMAutomatedTestTickRecorder Recorder;
+		FAVVMAutomatedTestTickRecorder::Active = &Recorder;
+
+		TArray<double> FrameTimes;
+		FrameTimes.Reserve(NumMeasuredFrames);
+
+		int64 NumDeferred = 0;
+		for (int32 i = 0; i < NumMeasuredFrames; ++i)
+		{
+			FrameTimes.Add(ExecuteFrame());
+			NumDeferred += GetNumDeferred();
+		}
+
+		FAVVMAutomatedTestTickRecorder::Active = nullptr;
+
+		const double TotalSeconds = Algo::Accumulate(FrameTimes, 0.0);
+		FrameTimes.Sort();
+
+		FBenchmarkResult OutResult;
+		OutResult.Name = Setting.Name;
+		OutResult.NumEntities = NumEntities;
+		OutResult.NumClasses = GetEntityClasses().Num();
+		OutResult.MeanMs = (TotalSeconds * 1000.0 / NumMeasuredFrames);
+		OutResult.P50Ms = (GetPercentile(FrameTimes, 0.50) * 1000.0);
+		OutResult.P95Ms = (GetPercentile(FrameTimes, 0.95) * 1000.0);
+		OutResult.P99Ms = (GetPercentile(FrameTimes, 0.99) * 1000.0);
+		OutResult.MaxMs = (FrameTimes.Last() * 1000.0);
+		OutResult.TicksPerFrame = (static_cast<double>(Recorder.NumTicks) / NumMeasuredFrames);
+		OutResult.TicksPerSecond = (TotalSeconds > 0.0) ? (Recorder.NumTicks / TotalSeconds) : 0.0;
+		OutResult.NanosecondsPerTick = (Recorder.NumTicks > 0) ? (TotalSeconds * 1e9 / Recorder.NumTicks) : 0.0;
+		OutResult.ClassSwitchesPerTick = (Recorder.NumTicks > 1) ? (static_cast<double>(Recorder.NumClassSwitches) / (Recorder.NumTicks - 1)) : 0.0;
+		OutResult.MeanAddressStride = (Recorder.NumTicks > 1) ? (static_cast<double>(Recorder.AccumulatedStride) / (Recorder.NumTicks - 1)) : 0.0;
+		OutResult.DeferredPerFrame = (static_cast<double>(NumDeferred) / NumMeasuredFrames);
+		return OutResult;
+	}
+
+	void Cleanup()
+	{
+		FAVVMAutomatedTestTickRecorder::Active = nullptr;
+
+		Scheduler.Reset();
+		Rule.Reset();
+		Entities.Reset();
+
+		if (TestWorld.IsValid())
+		{
+			TestWorld->EndPlayInTestWorld();
+		}
+
+		TestWorld.Reset();
+	}
+
+private:
+	void SpawnEntities(UWorld* World)
+	{
+		const TArray<UClass*>& EntityClasses = NSAVVMTickSchedulerBenchmark::GetEntityClasses();
+		Entities.Reserve(NumEntities);
+
+		for (int32 i = 0; i < NumEntities; ++i)
+		{
+			UClass* EntityClass = EntityClasses[i % EntityClasses.Num()];
+
+			UObject* Entity = nullptr;
+			if (EntityClass->IsChildOf<AActor>())
+			{
+				auto* Actor = World->SpawnActor<AActor>(EntityClass);
+				if (IsValid(Actor) && (Setting.Mode == NSAVVMTickSchedulerBenchmark::EBenchmarkMode::Native))
+				{
+					Actor->SetActorTickEnabled(true);
+				}
+
+				Entity = Actor;
+			}
+			else
+			{
+				// @gdemers one host per component. hosts never tick.
+				auto* Host = World->SpawnActor<AActor>();
+				auto* Component = IsValid(Host) ? NewObject<UActorComponent>(Host, EntityClass) : nullptr;
+				if (IsValid(Component))
+				{
+					Component->RegisterComponent();
+					if (Setting.Mode == NSAVVMTickSchedulerBenchmark::EBenchmarkMode::Native)
+					{
+						Component->SetComponentTickEnabled(true);
+					}
+				}
+
+				Entity = Component;
+			}
+
+			if (!IsValid(Entity))
+			{
+				continue;
+			}
+
+			if (Scheduler.IsValid())
+			{
+				Scheduler->Register(TScriptInterface<IAVVMDoesSupportManualTicking>(Entity));
+			}
+
+			Entities.Add(Entity);
+		}
+	}
+
+	double ExecuteFrame() const
+	{
+		const double FrameBegin = FPlatformTime::Seconds();
+
+		TestWorld->TickTestWorld(NSAVVMTickSchedulerBenchmark::FrameDeltaTime);
+		if (Scheduler.IsValid())
+		{
+			Scheduler->Tick(NSAVVMTickSchedulerBenchmark::FrameDeltaTime);
+		}
+
+		return (FPlatformTime::Seconds() - FrameBegin);
+	}
+
+	int32 GetNumDeferred() const
+	{
+		if (!Scheduler.IsValid())
+		{
+			return 0;
+		}
+
+		int32 OutNumDeferred = 0;
+		for (const FAVVMTickSchedulerCounters& LevelCounters : Scheduler->LevelCounters)
+		{
+			OutNumDeferred += LevelCounters.NumDeferred;
+		}
+
+		return OutNumDeferred;
+	}
+
+	const NSAVVMTickSchedulerBenchmark::FBenchmarkSetting& Setting;
+	const int32 NumEntities = 0;
+
+	TSharedPtr<FTestWorldWrapper> TestWorld = nullptr;
+	TStrongObjectPtr<UAVVMTickSchedulerRule> Rule = nullptr;
+	TStrongObjectPtr<UAVVMTickScheduler> Scheduler = nullptr;
+	TArray<TWeakObjectPtr<UObject>> Entities;
+};
+#endif
+
+/**
+ *	Class description:
+ *
+ *	AVVMTickSchedulerBenchmark is an Automated Test comparing native tick functions against the UAVVMTickScheduler, under multiple
+ *	rule settings, and entity counts. Results are written as csv to the automation directory (i.e - Saved/Automation/), and logged.
+ *	Run headless with : -ExecCmds="Automation RunTests AutomatedTest.CustomGroup.AVVMTickSchedulerBenchmark;Quit" -nullrhi -unattended
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMTickSchedulerBenchmark, "AutomatedTest.CustomGroup.AVVMTickSchedulerBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool AVVMTickSchedulerBenchmark::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	using namespace NSAVVMTickSchedulerBenchmark;
+
+	// @gdemers rule getters return console overrides when enabled. results wouldn't match the setting names.
+	if (FAVVMGameplayModule::GetCVarEnableOverrideTickSchedulerRule()->GetBool())
+	{
+		AddWarning(TEXT("c.SetTickSchedulerRule is enabled. Scheduler settings are overridden by console variables."));
+	}
+
+	TArray<FString> CsvRows;
+	CsvRows.Add(FBenchmarkResult::GetCsvHeader());
+
+	for (const int32 NumEntities : EntityCounts)
+	{
+		for (const FBenchmarkSetting& Setting : Settings)
+		{
+			FAVVMTickSchedulerBenchmarkContext Context(Setting, NumEntities);
+			UTEST_TRUE(FString::Printf(TEXT("Setup %s {%d entities}."), Setting.Name, NumEntities), Context.Setup())
+
+			const FBenchmarkResult Result = Context.Run();
+			Context.Cleanup();
+
+			// @gdemers without budget pressure, every entity should tick exactly once per frame regardless of the tick path.
+			const bool bIsUnbounded = (Setting.Mode == EBenchmarkMode::Native) || (Setting.TickRate >= 1.f);
+			if (bIsUnbounded)
+			{
+				TestEqual(FString::Printf(TEXT("%s ticks per frame {%d entities}."), Setting.Name, NumEntities), Result.TicksPerFrame, static_cast<double>(NumEntities));
+			}
+
+			const FString CsvRow = Result.ToCsvRow();
+			AddInfo(CsvRow);
+			CsvRows.Add(CsvRow);
+		}
+	}
+
+	const FString CsvPath = FPaths::Combine(FPaths::AutomationDir(), TEXT("AVVMTickSchedulerBenchmark.csv"));
+	TestTrue(FString::Printf(TEXT("Write %s."), *CsvPath), FFileHelper::SaveStringArrayToFile(CsvRows, *CsvPath));
+#endif
+	return true;
+}
@@ -0,0 +1,146 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "Engine/World.h"
+#include "Subsystems/WorldSubsystem.h"
+
+#include "AVVMActorPoolSubsystem.generated.h"
+
+struct FStreamableHandle;
+class UAVVMActorPoolRule;
+
+/**
+ *	Class description:
+ *
+ *	FAVVMActorPoolStats is a context struct that expose counters of a single Actor class pool.
+ */
+USTRUCT(BlueprintType)
+struct AVVMGAMEPLAY_API FAVVMActorPoolStats
+{
+	GENERATED_BODY()
+
+	// @gdemers instances acquired, and not yet released.
+	UPROPERTY(Transient, BlueprintReadOnly)
+	int32 NumActive = 0;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	int32 NumPooled = 0;
+
+	// @gdemers max NumActive reached. use it to tune the rule pre-warm count.
+	UPROPERTY(Transient, BlueprintReadOnly)
+	int32 HighWaterMark = 0;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	int32 NumSpawned = 0;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	int32 NumReused = 0;
+};
+
+/**
+ *	Class description:
+ *
+ *	UAVVMActorPoolSubsystem is a per-class Actor pool. Classes referenced by the UAVVMActorPoolRule are pre-warmed over a few frames,
+ *	and recycled on release instead of being destroyed. Released Actors are hidden, with collision and tick disabled. Actor types
+ *	requiring more than that should implement IAVVMPoolableActor.
+ *
+ *	Classes that aren't referenced by the rule, or a pool already full, fallback on SpawnActor/Destroy. Callers can always go through
+ *	this subsystem.
+ *
+ *	Note : Pooling replicated Actors require clients to tolerate an Actor being hidden, and shown again, instead of being destroyed.
+ */
+UCLASS()
+class AVVMGAMEPLAY_API UAVVMActorPoolSubsystem : public UTickableWorldSubsystem
+{
+	GENERATED_BODY()
+
+public:
+	virtual bool ShouldCreateSubsystem(UObject* Outer) const override;
+	virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+	virtual void Deinitialize() override;
+	virtual void Tick(float DeltaTime) override;
+	virtual TStatId GetStatId() const override;
+
+	static AActor* Static_AcquireActor(UWorld* World,
+	                                   const UClass* ActorClass,
+	                                   const FTransform& Transform,
+	                                   const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters());
+
+	template <typename TActor>
+	static TActor* Static_AcquireActor(UWorld* World,
+	                                   const UClass* ActorClass,
+	                                   const FTransform& Transform,
+	                                   const FActorSpawnParameters& SpawnParameters = FActorSpawnParameters());
+
+	UFUNCTION(BlueprintCallable)
+	static void Static_ReleaseActor(const UWorld* World, AActor* Actor);
+
+	UFUNCTION(BlueprintCallable)
+	static FAVVMActorPoolStats Static_GetPoolStats(const UWorld* World, const UClass* ActorClass);
+
+protected:
+	static UAVVMActorPoolSubsystem* Get(const UWorld* World);
+	AActor* AcquireActor(const UClass* ActorClass, const FTransform& Transform, const FActorSpawnParameters& SpawnParameters);
+	void ReleaseActor(AActor* Actor);
+	AActor* SpawnActor(const UClass* ActorClass, const FTransform& Transform, const FActorSpawnParameters& SpawnParameters) const;
+	void ActivateActor(AActor* Actor, const FTransform& Transform, const FActorSpawnParameters& SpawnParameters) const;
+	void DeactivateActor(AActor* Actor) const;
+	void GetSetProjectActorPoolRule();
+	void InitRule();
+	void WarmUp();
+
+	struct FAVVMActorPool
+	{
+		TArray<TWeakObjectPtr<AActor>> PooledActors;
+		FAVVMActorPoolStats Stats;
+		int32 MaxPooledCount = 0;
+		int32 PendingWarmUpCount = 0;
+	};
+
+	TMap<TObjectKey<UClass>, FAVVMActorPool> Pools;
+	TArray<TWeakObjectPtr<const UClass>> PendingWarmUpClasses;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	TWeakObjectPtr<const UAVVMActorPoolRule> ActorPoolRule = nullptr;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	int32 MaxWarmUpSpawnsPerFrame = 0;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	FTimerHandle RuleRetryHandle = FTimerHandle();
+
+	TSharedPtr<FStreamableHandle> StreamableHandle = nullptr;
+
+#if WITH_AUTOMATION_TESTS
+	friend class AVVMActorPoolTest;
+#endif
+};
+
+template <typename TActor>
+TActor* UAVVMActorPoolSubsystem::Static_AcquireActor(UWorld* World,
+                                                     const UClass* ActorClass,
+                                                     const FTransform& Transform,
+                                                     const FActorSpawnParameters& SpawnParameters)
+{
+	return Cast<TActor>(Static_AcquireActor(World, ActorClass, Transform, SpawnParameters));
+}
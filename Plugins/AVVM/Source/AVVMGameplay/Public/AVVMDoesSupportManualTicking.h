@@ -40,6 +40,16 @@ class AVVMGAMEPLAY_API UAVVMDoesSupportManualTicking : public UInterface
 class AVVMGAMEPLAY_API IAVVMDoesSupportManualTicking
 {
 	GENERATED_BODY()
-	
-	// TODO @gdemers Define what are the requirements for this interface.
+
+public:
+	// @gdemers opt-in parallel lane. queried once per class, when the scheduler first register an entity of this type.
+	// when true, Actor->Tick/Component->TickComponent is no longer called by the scheduler. ParallelTick, followed by CommitTick are called instead.
+	virtual bool DoesSupportParallelTick() const;
+
+	// @gdemers executed on a worker thread, concurrently with other entities. Implementation should only read/write
+	// state owned by this entity. No UObject creation/destruction, no world queries that aren't thread-safe, no delegate broadcast.
+	virtual void ParallelTick(const float DeltaTime);
+
+	// @gdemers executed on the game thread once all parallel ticks have joined. Apply results computed during ParallelTick here.
+	virtual void CommitTick(const float DeltaTime);
 };
@@ -22,12 +22,11 @@
 #include "CoreMinimal.h"
 
 #include "GameplayTagContainer.h"
+#include "Backend/AVVMOnlinePlayer.h"
 #include "GameFramework/GameSession.h"
 
 #include "AVVMGameSession.generated.h"
 
-struct FAVVMPlayerPreset;
-struct FAVVMPlayerProfile;
 class APlayerState;
 
 /**
@@ -35,6 +34,9 @@ class APlayerState;
  *	
  *	FAVVMBackendSessionPayload is a context struct that aggregate all information about players that participate in
  *	the running GameSession.
+ *
+ *	Profiles, and Presets, are kept in their typed representation. Their JSON representation is only produced when a payload
+ *	is submitted, and cached until the entry is modified again.
  */
 USTRUCT(BlueprintType)
 struct AVVMGAMEPLAY_API FAVVMBackendSessionPayload
@@ -54,11 +56,19 @@ struct AVVMGAMEPLAY_API FAVVMBackendSessionPayload
 	UPROPERTY(Transient, BlueprintReadWrite)
 	TMap<int32/*{FAVVMPlayerProfile::UniqueId}*/, int32/*{FAVVMPlayerPreset::UniqueId}*/> PresetIds;
 
-	UPROPERTY(Transient, BlueprintReadWrite)
-	TMap<int32/*{FAVVMPlayerProfile::UniqueId}*/, FString/*FAVVMPlayerProfile*/> ResolvedProfiles;
+	// @gdemers read only. modifications go through AAVVMGameSession, so the matching serialized entry is dropped along.
+	UPROPERTY(Transient, BlueprintReadOnly)
+	TMap<int32/*{FAVVMPlayerProfile::UniqueId}*/, FAVVMPlayerProfile> ResolvedProfiles;
 
-	UPROPERTY(Transient, BlueprintReadWrite)
-	TMap<int32/*{FAVVMPlayerPreset::UniqueId}*/, FString/*FAVVMPlayerPreset*/> ResolvedPresets;
+	UPROPERTY(Transient, BlueprintReadOnly)
+	TMap<int32/*{FAVVMPlayerPreset::UniqueId}*/, FAVVMPlayerPreset> ResolvedPresets;
+
+	// @gdemers JSON representation of clean entries. an entry missing from the collection is dirty, and serialized on demand.
+	UPROPERTY(Transient)
+	TMap<int32/*{FAVVMPlayerProfile::UniqueId}*/, FString/*FAVVMPlayerProfile*/> SerializedProfiles;
+
+	UPROPERTY(Transient)
+	TMap<int32/*{FAVVMPlayerPreset::UniqueId}*/, FString/*FAVVMPlayerPreset*/> SerializedPresets;
 };
 
 /**
@@ -144,6 +154,10 @@ protected:
 	FGameplayTag GetActorPresetSlot(const int32 ProfileId, const int32 PrivateItemId) const;
 	void MakePlayerProfileId(const APlayerState* PlayerState, const FAVVMPlayerProfile& NewPlayerProfile);
 	void MakePlayerPresetId(const APlayerState* PlayerState, const FAVVMPlayerPreset& NewPlayerPreset);
+	const FAVVMPlayerProfile* FindPlayerProfile(const int32 ProfileId) const;
+	const FAVVMPlayerPreset* FindPlayerPreset(const int32 PresetId) const;
+	const FString& SerializePlayerProfile(const int32 ProfileId);
+	const FString& SerializePlayerPreset(const int32 PresetId);
 
 	UPROPERTY(Transient, BlueprintReadOnly)
 	FAVVMBackendSessionPayload SessionPayload = FAVVMBackendSessionPayload();
@@ -153,4 +167,8 @@ private:
 	void RemovePlayer(const FString& UniqueNetId);
 	virtual int32 ResolveNewPlayerConnection(const FString& UniqueNetId);
 	virtual void CleanupOldPlayerConnection(const int32 PlayerConnectionId);
+
+#if WITH_AUTOMATION_TESTS
+	friend class AVVMGameSessionPayloadTest;
+#endif
 };
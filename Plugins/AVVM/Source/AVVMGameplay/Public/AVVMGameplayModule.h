@@ -67,6 +67,7 @@ public:
 	static AVVMGAMEPLAY_API IConsoleVariable* GetCVarOverrideTickSchedulerJobAllotment();
 	static AVVMGAMEPLAY_API IConsoleVariable* GetCVarOverrideTickSchedulerTickRate();
 	static AVVMGAMEPLAY_API IConsoleVariable* GetCVarOverrideTickSchedulerResetTimeJobQueuePriority();
+	static AVVMGAMEPLAY_API IConsoleVariable* GetCVarOverrideTickSchedulerMaxStaleness();
 
 private:
 #if !UE_BUILD_SHIPPING
@@ -74,5 +75,6 @@ private:
 	FDelegateHandle HandleB;
 	FDelegateHandle HandleC;
 	FDelegateHandle HandleD;
+	FDelegateHandle HandleE;
 #endif
 };
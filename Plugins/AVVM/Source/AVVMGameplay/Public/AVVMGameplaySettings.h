@@ -65,6 +65,18 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Inventory|Settings")
 	static const FDataRegistryId& GetStubDataProviderActorIdentifierId();
 
+	UFUNCTION(BlueprintCallable, Category="AVVMGameplay|Settings")
+	static int32 GetMaxPoseHistoryBytesPerCharacter();
+
+	UFUNCTION(BlueprintCallable, Category="AVVMGameplay|Settings")
+	static int32 GetMaxHitboxBodiesPerCharacter();
+
+	UFUNCTION(BlueprintCallable, Category="AVVMGameplay|Settings")
+	static int32 GetMaxNetFinalizedPerBackfillChunk();
+
+	UFUNCTION(BlueprintCallable, Category="AVVMGameplay|Settings")
+	static float GetNetRefreshBudgetMilliseconds();
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers")
 	bool bDoesCharacterResourceProviderUseStaticData = false;
@@ -91,4 +103,26 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers")
 	FDataRegistryType GameModeAdditiveRegistryType = FDataRegistryType();
+
+	// @gdemers memory budget of the per-bone hitbox history, recorded on the server for characters that opt-in. the number of
+	// snapshots kept (i.e - how far we can rewind) is derived from it.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|LagCompensation", meta=(ClampMin="1024"))
+	int32 MaxPoseHistoryBytesPerCharacter = 49152;
+
+	// @gdemers bodies of the physics asset past this limit aren't recorded.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|LagCompensation", meta=(ClampMin="1", ClampMax="255"))
+	int32 MaxHitboxBodiesPerCharacter = 24;
+
+	// @gdemers net finalized systems sent to a late joining client per reliable RPC. the next chunk is only sent once the client
+	// acknowledged the previous one, preventing the reliable buffer from saturating on full servers.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|Net", meta=(ClampMin="1"))
+	int32 MaxNetFinalizedPerBackfillChunk = 32;
+
+	// @gdemers client time spent refreshing net finalized systems per frame. at least one system is refreshed each frame.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|Net", meta=(ClampMin="0.1", Units="ms"))
+	float NetRefreshBudgetMilliseconds = 2.f;
+
+#if WITH_AUTOMATION_TESTS
+	friend class FAVVMScopedNetSettings;
+#endif
 };
@@ -125,8 +125,19 @@ protected:
 	UFUNCTION(Server, Reliable)
 	void Server_OnAutonomousPlayerBackfilling();
 	
+	// @gdemers backfill the delta of net finalized systems not yet acknowledged by this client, one chunk at a time.
+	void SendNetFinalizedChunk(const bool bForceSend);
+
 	UFUNCTION(Client, Reliable)
-	void Client_OnNetFinalized(const TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& NetFinalized);
+	void Client_OnNetFinalized(const TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& NetFinalized,
+	                           const int32 Version,
+	                           const bool bIsFinalChunk);
+
+	UFUNCTION(Server, Reliable)
+	void Server_OnNetFinalizedAcknowledged(const int32 Version);
+
+	// @gdemers refresh pending systems by priority, under a per-frame time budget. the remaining ones are deferred to the next frame.
+	void ExecutePendingNetRefreshes();
 	
 	void HandleSimulatedPlayerBackfilling();
 	
@@ -143,6 +154,26 @@ protected:
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly)
 	TObjectPtr<UAVVMAbilitySystemComponent> AbilitySystemComponent = nullptr;
 
+	struct FAVVMPendingNetRefresh
+	{
+		TWeakObjectPtr<UObject> NetSystem = nullptr;
+		int32 Priority = 0;
+		// @gdemers arrival order. keep refreshes of equal priority in registration order.
+		uint32 Sequence = 0;
+		bool bIsNetRelevantForLocalClientOnly = false;
+	};
+
+	// @gdemers max-heap on priority.
+	TArray<FAVVMPendingNetRefresh> PendingNetRefreshes;
+	uint32 NextNetRefreshSequence = 0;
+	bool bIsNetRefreshScheduled = false;
+	bool bIsNetSynchronizationCompletePending = false;
+	bool bHasNetSynchronizationCompleted = false;
+
+#if WITH_AUTOMATION_TESTS
+	friend class AVVMNetBackfillTest;
+#endif
+
 private:
 #if !UE_BUILD_SHIPPING
 	void SetClientSidedProfilePayload(const FString& Payload);
@@ -0,0 +1,51 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "UObject/Interface.h"
+
+#include "AVVMPoolableActor.generated.h"
+
+/**
+ *	Class description:
+ *
+ *	IAVVMPoolableActor is an interface class that identify an Actor type recycled by UAVVMActorPoolSubsystem. A pooled Actor
+ *	doesn't run BeginPlay/EndPlay again when reused, so any registration done there has to be mirrored by these hooks.
+ */
+UINTERFACE(BlueprintType)
+class AVVMGAMEPLAY_API UAVVMPoolableActor : public UInterface
+{
+	GENERATED_BODY()
+};
+
+class AVVMGAMEPLAY_API IAVVMPoolableActor
+{
+	GENERATED_BODY()
+
+public:
+	// @gdemers executed when a pooled Actor is reused, after its transform and owner are restored.
+	virtual void OnAcquiredFromPool();
+
+	// @gdemers executed when the Actor is returned to the pool, after it has been hidden. release external references, and restore
+	// state so nothing leaks to the next user.
+	virtual void OnReleasedToPool();
+};
@@ -27,13 +27,23 @@
 
 #include "AVVMPositionSamplerSubsystem.generated.h"
 
+class AAVVMCharacter;
 class AGameStateBase;
+class UPhysicsAsset;
+class USkeletalMeshComponent;
+struct FAVVMTraceContextArgs;
+struct FAVVMTraceResult;
 
 /**
  *	Class description:
  *	
  *	UAVVMPositionSamplerSubsystem is a tickable subsystem that capture actor position samples on the authoritative side (running prediction).
  *	Note : Currently, it focuses solely on playable character (and/or AI).
+ *
+ *	Characters register on BeginPlay, and are assigned a dense slot. Sample history of all slots is stored as a structure-of-arrays ring buffer,
+ *	with monotonic timestamps, so a rewind query is a binary search over contiguous memory.
+ *
+ *	Characters may also opt-in a per-bone hitbox history, recorded from the physics asset of their mesh, for exact hit validation.
  */
 UCLASS()
 class AVVMGAMEPLAY_API UAVVMPositionSamplerSubsystem : public UTickableWorldSubsystem
@@ -48,32 +58,157 @@ public:
 	virtual TStatId GetStatId() const override;
 
 	static FBoxCenterAndExtent Static_GetSampleExtent(const UWorld* World, const AActor* Target, const double Timestamp);
+	static void Static_UnregisterCharacter(AAVVMCharacter* Character);
+	static void Static_RegisterCharacter(AAVVMCharacter* Character);
+
+	// @gdemers OutResults is index-aligned with Traces. all registered characters are candidates.
+	static void Static_TraceBatch(const UWorld* World,
+	                              const TArray<FAVVMTraceContextArgs>& Traces,
+	                              TArray<FAVVMTraceResult>& OutResults);
+
+	// @gdemers opt-in. the mesh has to be animated on the server (i.e - VisibilityBasedAnimTickOption), otherwise we record the reference pose.
+	static void Static_UnregisterPoseHistory(const AAVVMCharacter* Character);
+	static void Static_RegisterPoseHistory(AAVVMCharacter* Character);
+
+	// @gdemers returns false, and OutHasPoseHistory false, if the character doesn't record a pose history.
+	static bool Static_DoesTraceIntersectPose(const UWorld* World,
+	                                          const FAVVMTraceContextArgs& Params,
+	                                          bool& bOutHasPoseHistory,
+	                                          FName& OutBoneName);
 
 protected:
 	static UAVVMPositionSamplerSubsystem* Get(const UWorld* World);
-	FBoxCenterAndExtent GetSampleExtent(const AActor* Target, const double Timestamp);
+	FBoxCenterAndExtent GetSampleExtent(const AActor* Target, const double Timestamp) const;
+	void UnregisterCharacter(const AActor* Character);
+	void RegisterCharacter(AAVVMCharacter* Character);
+	void TraceBatch(const TArray<FAVVMTraceContextArgs>& Traces, TArray<FAVVMTraceResult>& OutResults) const;
+	void UnregisterPoseHistory(const int32 SlotIndex);
+	void RegisterPoseHistory(AAVVMCharacter* Character);
 	
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TWeakObjectPtr<const AGameStateBase> GameStateBase = nullptr;
 
-	struct FAVVMPositionSample
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMPositionHistory is the sample history of all registered characters. Each slot own a fixed range of SampleSize samples in each
+	 *	array (i.e - slot i own [i * SampleSize, (i + 1) * SampleSize)), written as a ring buffer.
+	 */
+	struct FAVVMPositionHistory
 	{
-		FBoxCenterAndExtent TransformExtent = FBoxCenterAndExtent();
-		double SampleTimestamp = 0;
+		int32 AddSlot();
+		void RemoveSlot(const int32 SlotIndex);
+		void Sample(const int32 SlotIndex, const double Timestamp, const FVector& Center, const FVector& Extent);
+		FBoxCenterAndExtent GetClosestSample(const int32 SlotIndex, const double Timestamp) const;
+		bool TryGetClosestSample(const int32 SlotIndex, const double Timestamp, FVector& OutCenter, FVector& OutExtent) const;
+
+		static constexpr int32 SampleSize = 100;
+
+	private:
+		// @gdemers LogicalIndex is in range [0, NumSamples), from oldest to newest.
+		int32 GetSampleIndex(const int32 SlotIndex, const int32 LogicalIndex) const;
+
+		TArray<double> Timestamps;
+		TArray<FVector> Centers;
+		TArray<FVector> Extents;
+
+		// @gdemers per slot. HeadIndices is the next sample written, relative to the slot range.
+		TArray<int32> HeadIndices;
+		TArray<int32> NumSamples;
+		TArray<int32> FreeSlotIndices;
 	};
 
-	struct FAVVMPositionSampler
+	FAVVMPositionHistory PositionHistory;
+
+	struct FAVVMQuantizedBoneTransform
 	{
-		FAVVMPositionSampler();
-		FBoxCenterAndExtent GetClosestSample(const double Timestamp) const;
-		void Sample(const FAVVMPositionSample& NewSample);
+		// @gdemers smallest three, 2 bits for the dropped component index, and 20 bits per remaining component.
+		uint64 Rotation = 0;
+		// @gdemers component space, 1/32 cm precision, in range [-1024, 1024] cm.
+		int16 Location[3] = {0, 0, 0};
+	};
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMPoseHistory is the per-bone hitbox history of a single character, recorded as quantized component space bone transforms,
+	 *	in a ring buffer sized from a memory budget. Snapshots reference the physics asset they were recorded with, so physics asset swaps
+	 *	(i.e - UDynamicHitboxComponent) are rewound as well. Histories are pooled, and keep their allocation once released.
+	 */
+	struct FAVVMPoseHistory
+	{
+		void Init(const USkeletalMeshComponent* NewMeshComponent, const int32 NewMaxBodies, const int32 NewCapacity);
+		void Release();
+		void Sample(const double Timestamp);
+		bool DoesTraceIntersect(const FAVVMTraceContextArgs& Params, FName& OutBoneName) const;
 
 	private:
-		TArray<FAVVMPositionSample> Samples;
-		int32 CurrSampleIndex = 0;
+		struct FAVVMPoseBodies
+		{
+			TWeakObjectPtr<const UPhysicsAsset> PhysicsAsset = nullptr;
+			// @gdemers index-aligned. body setup of the physics asset, and bone of the mesh, of each recorded body.
+			TArray<int32> BodySetupIndices;
+			TArray<int32> BoneIndices;
+		};
+
+		// @gdemers snapshots bracketing a rewind time. Alpha is the weight of the upper snapshot.
+		struct FAVVMPoseRewind
+		{
+			int32 LowerSnapshotIndex = INDEX_NONE;
+			int32 UpperSnapshotIndex = INDEX_NONE;
+			double Alpha = 1.0;
+			bool bCanInterpolate = false;
+		};
+
+		int32 FindOrAddBodies(const UPhysicsAsset* PhysicsAsset);
+		int32 GetSnapshotIndex(const int32 LogicalIndex) const;
+		bool TryRewind(const double Timestamp, FAVVMPoseRewind& OutRewind) const;
+		FTransform GetBoneTransform(const int32 SnapshotIndex, const int32 BodyIndex) const;
+		FTransform GetComponentTransform(const int32 SnapshotIndex) const;
+		FTransform GetRewoundBoneTransform(const FAVVMPoseRewind& Rewind, const int32 BodyIndex) const;
+		FTransform GetRewoundComponentTransform(const FAVVMPoseRewind& Rewind) const;
+		void SetBoneTransform(const int32 SnapshotIndex, const int32 BodyIndex, const FTransform& BoneTransform);
+		void SetComponentTransform(const int32 SnapshotIndex, const FTransform& ComponentTransform);
+
+		static constexpr int32 MaxPoseBodies = 8;
+
+		TWeakObjectPtr<const USkeletalMeshComponent> MeshComponent = nullptr;
+		TArray<FAVVMPoseBodies> PoseBodies;
+
+		// @gdemers per snapshot.
+		TArray<double> Timestamps;
+		TArray<FVector> ComponentLocations;
+		TArray<uint64> ComponentRotations;
+		TArray<uint8> PoseBodiesIndices;
+
+		// @gdemers per snapshot, per body. snapshot i own [i * MaxBodies, (i + 1) * MaxBodies).
+		TArray<FAVVMQuantizedBoneTransform> BoneTransforms;
+
+		int32 MaxBodies = 0;
+		int32 Capacity = 0;
+		int32 HeadIndex = 0;
+		int32 NumSnapshots = 0;
+
+#if WITH_AUTOMATION_TESTS
+		friend class AVVMPoseHistoryTest;
+#endif
 	};
 
-	TMap<TWeakObjectPtr<const AActor>, FAVVMPositionSampler> AuthoritativePositionSamplers;
+	TArray<FAVVMPoseHistory> PoseHistories;
+	TArray<int32> FreePoseHistoryIndices;
+
+	// @gdemers index-aligned with PositionHistory slots. INDEX_NONE for characters that don't record a pose history.
+	TArray<int32> SlotPoseHistoryIndices;
+
+#if WITH_AUTOMATION_TESTS
+	friend class AVVMPositionHistoryTest;
+	friend class AVVMPoseHistoryTest;
+	friend class AVVMTraceBatchTest;
+#endif
+
+	// @gdemers index-aligned with PositionHistory slots. free slots hold nullptr.
+	TArray<TWeakObjectPtr<AAVVMCharacter>> SlotCharacters;
+	TMap<TWeakObjectPtr<const AActor>, int32> ActorToSlotIndex;
 };
 
 /**
@@ -102,6 +237,25 @@ struct AVVMGAMEPLAY_API FAVVMTraceContextArgs
 	FVector TraceEnd = FVector::ZeroVector;
 };
 
+/**
+ *	Class description:
+ *	
+ *	FAVVMTraceResult is the result of a single trace, validated as part of a batch.
+ */
+USTRUCT(BlueprintType)
+struct AVVMGAMEPLAY_API FAVVMTraceResult
+{
+	GENERATED_BODY()
+
+	// @gdemers closest character intersected along the trace, at the trace HitTime.
+	UPROPERTY(Transient, BlueprintReadWrite)
+	TWeakObjectPtr<const AActor> ResolvedActor = nullptr;
+
+	// @gdemers true if the HitActor claimed by the trace is intersected, at the trace HitTime.
+	UPROPERTY(Transient, BlueprintReadWrite)
+	bool bIsValidated = false;
+};
+
 /**
  *	Class description:
  *	
@@ -115,4 +269,18 @@ class AVVMGAMEPLAY_API UAVVMTraceUtils : public UBlueprintFunctionLibrary
 public:
 	UFUNCTION(BlueprintCallable)
 	static bool DoesTraceIntersectPositionSample(const UWorld* World, const FAVVMTraceContextArgs& Params);
+
+	// @gdemers capsule reconstructed from the sample box, tested against a single trace. reference for the batch api.
+	static bool DoesTraceIntersectSample(const FBoxCenterAndExtent& BoxExtentAtTime, const FAVVMTraceContextArgs& Params);
+
+	// @gdemers validate against the per-bone hitbox history of the HitActor, and fallback on its capsule if it doesn't record one.
+	UFUNCTION(BlueprintCallable)
+	static bool DoesTraceIntersectPoseSample(const UWorld* World, const FAVVMTraceContextArgs& Params, FName& OutBoneName);
+
+	// @gdemers batch api. validate all traces of a burst (i.e - shotgun pellets) against the rewound capsules of all characters,
+	// in a single call. traces sharing a HitTime share the rewind.
+	UFUNCTION(BlueprintCallable)
+	static void DoTracesIntersectPositionSamples(const UWorld* World,
+	                                             const TArray<FAVVMTraceContextArgs>& Params,
+	                                             TArray<FAVVMTraceResult>& OutResults);
 };
@@ -28,6 +28,55 @@
 class IAVVMDoesSupportManualTicking;
 class UAVVMTickSchedulerRule;
 
+/**
+ *	Class description:
+ *
+ *	FAVVMTickSchedulerCounters is a set of counters recorded by the UAVVMTickScheduler, either per priority level, or per class.
+ */
+struct AVVMGAMEPLAY_API FAVVMTickSchedulerCounters
+{
+	int32 NumTicked = 0;
+	int32 NumDeferred = 0;
+	int32 NumDemotions = 0;
+	int32 NumPromotions = 0;
+};
+
+/**
+ *	Class description:
+ *
+ *	FAVVMTickSchedulerClassStats is a snapshot of a single runner (i.e - all entities of a given UClass). Ticked, and deferred counters
+ *	cover the last frame. Demotions, and promotions are accumulated since the runner creation.
+ */
+struct AVVMGAMEPLAY_API FAVVMTickSchedulerClassStats
+{
+	FString ClassName = FString();
+	FAVVMTickSchedulerCounters Counters = FAVVMTickSchedulerCounters();
+	int32 NumEntities = 0;
+	int32 PriorityLevel = 0;
+	double NanosecondsPerEntity = 0.0;
+	bool bDoesSupportParallelTick = false;
+};
+
+/**
+ *	Class description:
+ *
+ *	FAVVMTickSchedulerStats is a snapshot of the UAVVMTickScheduler state, built on demand for debug tools.
+ */
+struct AVVMGAMEPLAY_API FAVVMTickSchedulerStats
+{
+	TArray<FAVVMTickSchedulerCounters> Levels;
+	TArray<FAVVMTickSchedulerClassStats> Classes;
+	FAVVMTickSchedulerCounters ParallelLane = FAVVMTickSchedulerCounters();
+	double SerialLaneSeconds = 0.0;
+	double ParallelLaneSeconds = 0.0;
+	/*Serial lane execution time over TickRate. Above 1 when stale entities forced us past budget*/
+	double FrameBudgetConsumed = 0.0;
+	float GlobalJobAllotment = 0.f;
+	float TickRate = 0.f;
+	float MaxStaleness = 0.f;
+	bool bShowDebugOverlay = false;
+};
+
 /**
  *	Class description:
  *	
@@ -54,6 +103,8 @@ public:
 	static void Static_UnRegister(const UWorld* World,
 	                              const TScriptInterface<IAVVMDoesSupportManualTicking>& ManualTickActor);
 	
+	FAVVMTickSchedulerStats GetStats() const;
+
 #if !UE_BUILD_SHIPPING
 	void OnTickSchedulerRuleCVarChanged();
 #endif
@@ -62,22 +113,68 @@ protected:
 	static UAVVMTickScheduler* Get(const UWorld* World);
 	void Register(const TScriptInterface<IAVVMDoesSupportManualTicking>& ManualTicker);
 	void UnRegister(const TScriptInterface<IAVVMDoesSupportManualTicking>& ManualTicker);
+	void RegisterEntity(UObject* Entity);
 	void GetSetProjectTickSchedulerRule();
 	void InitRule();
 
-	// @gdemers single job, ticking all actors of a given UClass. Tick aggregation
-	// of a given class ensure we load our virtual AActor::Tick call within register
-	// and reduce cache misses created by random access of derived classes.
-	struct FAVVMRunner_Actor
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMTickHandle is a generational handle referencing a single entity within the scheduler slot map.
+	 *	Handles remain stable while the underlying dense storage is swap-removed, or moved across priority levels.
+	 *	A stale handle (i.e - generation mismatch) is safely ignored.
+	 */
+	struct FAVVMTickHandle
 	{
-		TArray<TWeakObjectPtr<AActor>> Entities;
+		bool IsValid() const { return (SlotIndex != INDEX_NONE); }
+
+		int32 SlotIndex = INDEX_NONE;
+		uint32 Generation = 0;
 	};
-	
-	struct FAVVMRunner_ActorComponent
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAVVMTickSlot is a sparse entry of the slot map, redirecting a FAVVMTickHandle to the runner, and the dense index
+	 *	of the entity it references.
+	 */
+	struct FAVVMTickSlot
+	{
+		int32 RunnerIndex = INDEX_NONE;
+		int32 DenseIndex = INDEX_NONE;
+		uint32 Generation = 0;
+		bool bIsActorComponent = false;
+	};
+
+	// @gdemers single job, ticking all entities of a given UClass. Tick aggregation
+	// of a given class ensure we load our virtual AActor::Tick call within register
+	// and reduce cache misses created by random access of derived classes.
+	template <typename TEntity>
+	struct TAVVMRunner
 	{
-		TArray<TWeakObjectPtr<UActorComponent>> Entities;
+		TWeakObjectPtr<const UClass> Class = nullptr;
+		/*Dense storage. Entities, SlotIndices, and LastTickTimes are kept parallel, and swap-removed together*/
+		TArray<TWeakObjectPtr<TEntity>> Entities;
+		TArray<int32> SlotIndices;
+		/*World time at which each entity last ticked*/
+		TArray<double> LastTickTimes;
+		/*Exponentially weighted cost, in seconds, of ticking a single entity of this class*/
+		double AverageCostPerEntity = 0.0;
+		/*Dense index of the next entity to tick. Replace rotating the entities when a job is preempted*/
+		int32 Cursor = 0;
+		int32 PriorityLevel = 0;
+		/*Index of this runner within the job queue of its priority level*/
+		int32 JobIndex = INDEX_NONE;
+		/*Runner execute on the parallel lane, and isn't subject to priority changes*/
+		bool bDoesSupportParallelTick = false;
+		/*Cached class name, used by trace scopes, and debug tools*/
+		FString DebugName = FString();
+		FAVVMTickSchedulerCounters Counters = FAVVMTickSchedulerCounters();
 	};
 
+	using FAVVMRunner_Actor = TAVVMRunner<AActor>;
+	using FAVVMRunner_ActorComponent = TAVVMRunner<UActorComponent>;
+
 	struct FAVVMJobQueue
 	{
 		FAVVMJobQueue()
@@ -88,39 +185,120 @@ protected:
 			Jobs_Actor.Reserve(NumJobs_Actor);
 		}
 
-		int64 Add(const UClass* Class, UActorComponent* ActorComponent);
-		int64 Add(const UClass* Class, AActor* Actor);
-		int64 Append(const UClass* Class, const TArray<TWeakObjectPtr<UActorComponent>>& ActorComponents);
-		int64 Append(const UClass* Class, const TArray<TWeakObjectPtr<AActor>>& Actors);
+		TArray<int32>& GetJobs(const bool bIsActorComponent)
+		{
+			return bIsActorComponent ? Jobs_ActorComponent : Jobs_Actor;
+		}
 
-		TMap<TWeakObjectPtr<const UClass>, FAVVMRunner_ActorComponent> Jobs_ActorComponent;
-		/*Jobs are unique per AActor derived type. Priority is handled by indices*/
-		TMap<TWeakObjectPtr<const UClass>, FAVVMRunner_Actor> Jobs_Actor;
+		/*Runner indices executing at this priority level*/
+		TArray<int32> Jobs_ActorComponent;
+		TArray<int32> Jobs_Actor;
 	};
 
 	struct FAVVMMLFQ
 	{
+		static constexpr int32 NumFeedbackLevels = 4;
+
 		FAVVMMLFQ()
 		{
-			static constexpr int32 NumFeedbackLevels = 4;
-			PriorityQueue.Reserve(NumFeedbackLevels);
+			PriorityQueue.SetNum(NumFeedbackLevels);
 		}
 
-		int64 Push(const UClass* Class, UActorComponent* ActorComponent);
-		int64 Push(const UClass* Class, AActor* Actor);
-		void Pop(const int64 Handle, UActorComponent* ActorComponent) const;
-		void Pop(const int64 Handle, AActor* Actor) const;
+		FAVVMTickHandle Push(const UClass* Class, UActorComponent* ActorComponent, const double WorldTime);
+		FAVVMTickHandle Push(const UClass* Class, AActor* Actor, const double WorldTime);
+		void Pop(const FAVVMTickHandle& Handle);
+		void SetPriorityLevel(const int32 RunnerIndex, const int32 PriorityLevel, const bool bIsActorComponent);
+		void ResetPriority();
+		int32 GetNumSerialEntities() const;
 
 		/*Priority level is handled by indices*/
 		TArray<FAVVMJobQueue> PriorityQueue;
+		/*Jobs fanned out over worker threads*/
+		FAVVMJobQueue ParallelJobQueue;
+		/*Runners are unique per UClass, and never removed so runner indices remain stable*/
+		TArray<FAVVMRunner_ActorComponent> Runners_ActorComponent;
+		TArray<FAVVMRunner_Actor> Runners_Actor;
+		TMap<TWeakObjectPtr<const UClass>, int32> RunnerIndices_ActorComponent;
+		TMap<TWeakObjectPtr<const UClass>, int32> RunnerIndices_Actor;
+		TArray<FAVVMTickSlot> Slots;
+		TArray<int32> FreeSlotIndices;
+
+	private:
+		template <typename TEntity>
+		FAVVMTickHandle Push(TArray<TAVVMRunner<TEntity>>& Runners,
+		                     TMap<TWeakObjectPtr<const UClass>, int32>& RunnerIndices,
+		                     const UClass* Class,
+		                     TEntity* Entity,
+		                     const double WorldTime,
+		                     const bool bIsActorComponent);
+
+		template <typename TEntity>
+		void Pop(TArray<TAVVMRunner<TEntity>>& Runners, const FAVVMTickSlot& Slot);
+
+		template <typename TEntity>
+		void SetPriorityLevel(TArray<TAVVMRunner<TEntity>>& Runners,
+		                      const int32 RunnerIndex,
+		                      const int32 PriorityLevel,
+		                      const bool bIsActorComponent);
+
+		int32 AllocateSlot();
 	};
-	
+
+	// @gdemers execute entities of a runner, starting at its cursor, until the budget is exhausted. past that point, only
+	// entities that reached the max staleness are ticked.
+	template <typename TEntity>
+	void ExecuteRunner(TAVVMRunner<TEntity>& Runner, const double WorldTime, const double Budget);
+
+	// @gdemers queue a priority change based on the projected cost of the runner.
+	template <typename TEntity>
+	void EvaluatePriorityLevel(TAVVMRunner<TEntity>& Runner, const int32 RunnerIndex, const bool bIsActorComponent);
+
+	template <typename TEntity>
+	static void GatherRunnerStats(const TArray<TAVVMRunner<TEntity>>& Runners, FAVVMTickSchedulerStats& OutStats);
+
+	void PublishStats();
+
+	// @gdemers gather entities of all runners on the parallel lane into a single batch.
+	template <typename TEntity>
+	void GatherParallelRunner(TAVVMRunner<TEntity>& Runner, const double WorldTime);
+
+	void ExecuteParallelLane(const double WorldTime);
+	void FlushPendingOperations();
+
+	struct FAVVMParallelTickJob
+	{
+		UObject* Entity = nullptr;
+		IAVVMDoesSupportManualTicking* Ticker = nullptr;
+		float DeltaTime = 0.f;
+	};
+
+	struct FAVVMPriorityChange
+	{
+		int32 RunnerIndex = INDEX_NONE;
+		int32 PriorityLevel = 0;
+		bool bIsActorComponent = false;
+	};
+
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TWeakObjectPtr<const UAVVMTickSchedulerRule> TickSchedulerRule = nullptr;
 
-	TMap<TWeakObjectPtr<const UClass>, int64> TickerHandles;
+	TMap<TWeakObjectPtr<const UObject>, FAVVMTickHandle> TickerHandles;
 	FAVVMMLFQ MultiLevelFeedbackQueue = FAVVMMLFQ();
 
+	// @gdemers scratch buffers reused across frames. registration, and removal requested while ticking are deferred
+	// so dense storage isn't mutated under our iteration.
+	TArray<TWeakObjectPtr<UObject>> PendingRegistrations;
+	TArray<FAVVMTickHandle> PendingRemovals;
+	TArray<FAVVMPriorityChange> PendingPriorityChanges;
+	TArray<FAVVMParallelTickJob> ParallelTickJobs;
+
+	// @gdemers counters of the last frame. published to stats, and csv profiler.
+	TArray<FAVVMTickSchedulerCounters> LevelCounters;
+	FAVVMTickSchedulerCounters ParallelLaneCounters;
+	double SerialLaneSeconds = 0.0;
+	double ParallelLaneSeconds = 0.0;
+	bool bIsTicking = false;
+
 	UPROPERTY(Transient, BlueprintReadOnly)
 	float GlobalResetTimeJobQueuePriority = 0.f;
 
@@ -132,4 +310,22 @@ protected:
 
 	UPROPERTY(Transient, BlueprintReadOnly)
 	float ResetJobQueuePriorityDeltaTime = 0.f;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	float MaxStaleness = 0.f;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	float CostSmoothingFactor = 0.f;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	bool bShowDebugOverlay = false;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	bool bAllowParallelTick = false;
+
+#if WITH_AUTOMATION_TESTS
+	friend class FAVVMTickSchedulerBenchmarkContext;
+	friend class AVVMTickSchedulerDefaultRuleTest;
+	friend class AVVMTickSchedulerTest;
+#endif
 };
@@ -40,6 +40,10 @@ public:
 	float GetGlobalResetTimeJobQueuePriority() const;
 	float GetGlobalJobAllotment() const;
 	float GetTickRate() const;
+	bool GetAllowParallelTick() const;
+	float GetMaxStaleness() const;
+	float GetCostSmoothingFactor() const;
+	bool GetShowDebugOverlay() const;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers")
@@ -48,6 +52,22 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers")
 	float GlobalJobAllotment = 0.f;
 
-	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers")
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ToolTip="Serial lane budget, in seconds, per frame. 0, or less, leave the serial lane unbounded, and nothing is deferred."))
 	float TickRate = 0.f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ToolTip="Fan out types supporting parallel tick over worker threads. When false, the parallel lane runs on the game thread."))
+	bool bAllowParallelTick = true;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ClampMin="0", ToolTip="Max time, in seconds, an entity can go without ticking. Stale entities tick even when the frame budget is exhausted."))
+	float MaxStaleness = 0.1f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ClampMin="0", ClampMax="1", ToolTip="Weight of the latest sample in the per-class moving average cost. Higher values react faster to cost changes."))
+	float CostSmoothingFactor = 0.1f;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ToolTip="Display per-level, and per-class scheduler counters in the AVVMImGui debug window."))
+	bool bShowDebugOverlay = false;
+
+#if WITH_AUTOMATION_TESTS
+	friend class FAVVMTickSchedulerBenchmarkContext;
+#endif
 };
@@ -39,6 +39,9 @@ struct AVVMGAMEPLAY_API FAVVMHearbeatPayload : public FAVVMNotificationPayload
 	FAVVMHearbeatPayload() = default;
 	explicit FAVVMHearbeatPayload(const float NewValue);
 
+	// @gdemers a deferred heartbeat is only relevant for its most recent value.
+	virtual bool CanCoalesce() const override { return true; }
+
 	UPROPERTY(Transient, BlueprintReadWrite)
 	float Value = 0.f;
 };
@@ -58,9 +58,25 @@ public:
 
 	UFUNCTION(BlueprintNativeEvent)
 	void ClientRefresh(const AAVVMPlayerState* PlayerState) const;
-	void ClientRefresh_Implementation(const AAVVMPlayerState* PlayerState) const PURE_VIRTUAL(ClientRefresh_Implementation, return;);
+	virtual void ClientRefresh_Implementation(const AAVVMPlayerState* PlayerState) const PURE_VIRTUAL(ClientRefresh_Implementation, return;);
+
+	// @gdemers refresh a system for all player states at once. override when the system can amortize work between players, default
+	// to ClientRefresh for each of them.
+	UFUNCTION(BlueprintNativeEvent)
+	void ClientRefreshBatch(const TArray<AAVVMPlayerState*>& PlayerStates) const;
+	virtual void ClientRefreshBatch_Implementation(const TArray<AAVVMPlayerState*>& PlayerStates) const;
+
+	// @gdemers systems with a higher priority are refreshed first on the client. (i.e - teams before cosmetics)
+	UFUNCTION(BlueprintNativeEvent)
+	int32 GetNetSynchronizationPriority() const;
+	virtual int32 GetNetSynchronizationPriority_Implementation() const { return 0; }
+
+	// @gdemers systems that aren't relevant to a client are never backfilled to it.
+	UFUNCTION(BlueprintNativeEvent)
+	bool IsNetRelevantForClient(const AAVVMPlayerState* PlayerState) const;
+	virtual bool IsNetRelevantForClient_Implementation(const AAVVMPlayerState* PlayerState) const { return true; }
 	
 	UFUNCTION(BlueprintNativeEvent)
 	bool IsNetRelevantForLocalClientOnly() const;
-	bool IsNetRelevantForLocalClientOnly_Implementation() const PURE_VIRTUAL(IsNetRelevantForLocalClientOnly_Implementation, return false;);
+	virtual bool IsNetRelevantForLocalClientOnly_Implementation() const PURE_VIRTUAL(IsNetRelevantForLocalClientOnly_Implementation, return false;);
 };
@@ -25,6 +25,7 @@
 
 #include "AVVMNetSynchronizationManager.generated.h"
 
+class AAVVMPlayerState;
 class IAVVMDoesImplNetSynchronization;
 
 /**
@@ -36,6 +37,10 @@ class IAVVMDoesImplNetSynchronization;
  *	Net synchronization is hard to accomplish. Initialization of visuals based on server-client state
  *	often suffer from property replication affected by race conditions, or packet loss. By handling registration of finalized state for replicated
  *	system, we can ensure clients initialization through RPC request.
+ *	
+ *	The registry is versioned. Systems are only ever appended, so the version of a system is its registration order, and the
+ *	version acknowledged by a client is the number of systems it has refreshed. Late joining clients are backfilled with the delta,
+ *	in bounded chunks, one chunk in flight at a time. Clients refresh the systems received by priority, under a per-frame time budget.
  */
 UCLASS()
 class AVVMGAMEPLAY_API UAVVMNetSynchronizationManager : public UWorldSubsystem
@@ -49,10 +54,41 @@ public:
 	static TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>> Static_GetAllNetFinalized(const UWorld* World);
 	static void Static_Register(const UWorld* World, const UActorComponent* ReplicatedComponent);
 
+	// @gdemers fill the next chunk of systems not yet acknowledged by the client. return false if a chunk is already in flight, or
+	// if there is nothing left to send, unless bForceSend is set (i.e - the client still expect a final chunk to complete its synchronization).
+	static bool Static_GetNextBackfillChunk(const UWorld* World,
+	                                        const AAVVMPlayerState* PlayerState,
+	                                        const bool bForceSend,
+	                                        TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& OutChunk,
+	                                        int32& OutVersion,
+	                                        bool& bOutIsFinalChunk);
+
+	static void Static_AcknowledgeBackfill(const UWorld* World, const AAVVMPlayerState* PlayerState, const int32 Version);
+	static void Static_UnregisterClient(const UWorld* World, const AAVVMPlayerState* PlayerState);
+
 protected:
 	static UAVVMNetSynchronizationManager* Get(const UWorld* World);
 	const TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& GetAllNetFinalized() const;
 	void Register(const UActorComponent* ReplicatedComponent);
+	bool GetNextBackfillChunk(const AAVVMPlayerState* PlayerState,
+	                          const bool bForceSend,
+	                          TArray<TScriptInterface<IAVVMDoesImplNetSynchronization>>& OutChunk,
+	                          int32& OutVersion,
+	                          bool& bOutIsFinalChunk);
+	void AcknowledgeBackfill(const AAVVMPlayerState* PlayerState, const int32 Version);
+
+	struct FAVVMClientBackfillState
+	{
+		int32 AcknowledgedVersion = 0;
+		// @gdemers version of the chunk in flight, or INDEX_NONE. only this version may be acknowledged.
+		int32 InFlightVersion = INDEX_NONE;
+	};
+
+	TMap<TObjectKey<AAVVMPlayerState>, FAVVMClientBackfillState> ClientBackfillStates;
+
+#if WITH_AUTOMATION_TESTS
+	friend class AVVMNetBackfillTest;
+#endif
 
 	// @gdemers a collection of systems that are fully initialized on the server. ready to RPC
 	// to local PC.
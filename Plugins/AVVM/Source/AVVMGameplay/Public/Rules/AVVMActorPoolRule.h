@@ -0,0 +1,75 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "AVVMWorldSetting.h"
+
+#if WITH_EDITOR
+#include "Misc/DataValidation.h"
+#endif
+
+#include "AVVMActorPoolRule.generated.h"
+
+/**
+ *	Class description:
+ *
+ *	FAVVMActorPoolClassConfig define how many instances of an Actor class are spawned ahead of time, and how many
+ *	can be kept once released.
+ */
+USTRUCT(BlueprintType)
+struct AVVMGAMEPLAY_API FAVVMActorPoolClassConfig
+{
+	GENERATED_BODY()
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ClampMin="0"))
+	int32 PreWarmCount = 0;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ClampMin="0"))
+	int32 MaxPooledCount = 32;
+};
+
+/**
+ *	Class description:
+ *
+ *	UAVVMActorPoolRule is a World Setting rule that define which Actor classes are pooled by the UAVVMActorPoolSubsystem.
+ *	Classes that aren't referenced are spawned, and destroyed, as usual.
+ */
+UCLASS()
+class AVVMGAMEPLAY_API UAVVMActorPoolRule : public UAVVMWorldRule
+{
+	GENERATED_BODY()
+
+public:
+#if WITH_EDITOR
+	virtual EDataValidationResult IsDataValid(class FDataValidationContext& Context) const override;
+#endif
+
+	const TMap<TSoftClassPtr<AActor>, FAVVMActorPoolClassConfig>& GetPooledClasses() const;
+	int32 GetMaxWarmUpSpawnsPerFrame() const;
+
+protected:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers")
+	TMap<TSoftClassPtr<AActor>, FAVVMActorPoolClassConfig> PooledClasses;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ClampMin="1", ToolTip="Pre-warm spawns are spread over frames to avoid hitching on load."))
+	int32 MaxWarmUpSpawnsPerFrame = 4;
+};
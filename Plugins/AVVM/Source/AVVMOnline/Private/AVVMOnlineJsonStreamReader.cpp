@@ -0,0 +1,653 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "AVVMOnlineJsonStreamReader.h"
+
+#include "Containers/StringConv.h"
+
+namespace NSAVVMOnlineJsonToken
+{
+	static bool IsWhitespace(const uint8 Value)
+	{
+		return (Value == ' ') || (Value == '\t') || (Value == '\n') || (Value == '\r');
+	}
+
+	static bool IsDigit(const uint8 Value)
+	{
+		return (Value >= '0') && (Value <= '9');
+	}
+
+	static int32 HexValue(const uint8 Value)
+	{
+		if (IsDigit(Value))
+		{
+			return (Value - '0');
+		}
+
+		if (Value >= 'a' && Value <= 'f')
+		{
+			return (Value - 'a' + 10);
+		}
+
+		if (Value >= 'A' && Value <= 'F')
+		{
+			return (Value - 'A' + 10);
+		}
+
+		return INDEX_NONE;
+	}
+
+	static void AppendUTF8(TArray<uint8>& OutValue, const uint32 CodePoint)
+	{
+		if (CodePoint < 0x80)
+		{
+			OutValue.Add(static_cast<uint8>(CodePoint));
+		}
+		else if (CodePoint < 0x800)
+		{
+			OutValue.Add(static_cast<uint8>(0xC0 | (CodePoint >> 6)));
+			OutValue.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+		}
+		else if (CodePoint < 0x10000)
+		{
+			OutValue.Add(static_cast<uint8>(0xE0 | (CodePoint >> 12)));
+			OutValue.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			OutValue.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+		}
+		else
+		{
+			OutValue.Add(static_cast<uint8>(0xF0 | (CodePoint >> 18)));
+			OutValue.Add(static_cast<uint8>(0x80 | ((CodePoint >> 12) & 0x3F)));
+			OutValue.Add(static_cast<uint8>(0x80 | ((CodePoint >> 6) & 0x3F)));
+			OutValue.Add(static_cast<uint8>(0x80 | (CodePoint & 0x3F)));
+		}
+	}
+}
+
+FAVVMOnlineJsonStreamReader::FAVVMOnlineJsonStreamReader(TArrayView<const uint8> NewData)
+	: Data(NewData)
+{
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadObjectStart()
+{
+	SkipWhitespace();
+	return Consume('{') && PushContainer();
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadArrayStart()
+{
+	SkipWhitespace();
+	return Consume('[') && PushContainer();
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadNextKey(TArrayView<const uint8>& OutKey)
+{
+	if (bHasError || Depth == 0)
+	{
+		bHasError = true;
+		return false;
+	}
+
+	SkipWhitespace();
+	if (Peek('}'))
+	{
+		PopContainer('}');
+		return false;
+	}
+
+	const uint64 EntryBit = (1ull << (Depth - 1));
+	if ((FirstEntryMask & EntryBit) == 0)
+	{
+		SkipWhitespace();
+		if (!Consume(','))
+		{
+			return false;
+		}
+
+		SkipWhitespace();
+	}
+
+	FirstEntryMask &= ~EntryBit;
+
+	int32 Start = 0;
+	int32 End = 0;
+	bool bHasEscapes = false;
+	if (!ScanString(Start, End, bHasEscapes))
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+	if (!Consume(':'))
+	{
+		return false;
+	}
+
+	OutKey = Data.Slice(Start, End - Start);
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadNextElement()
+{
+	if (bHasError || Depth == 0)
+	{
+		bHasError = true;
+		return false;
+	}
+
+	SkipWhitespace();
+	if (Peek(']'))
+	{
+		PopContainer(']');
+		return false;
+	}
+
+	const uint64 EntryBit = (1ull << (Depth - 1));
+	if ((FirstEntryMask & EntryBit) == 0 && !Consume(','))
+	{
+		return false;
+	}
+
+	FirstEntryMask &= ~EntryBit;
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadInt32(int32& OutValue)
+{
+	if (bHasError)
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+
+	int32 Start = 0;
+	int32 End = 0;
+	bool bIsInteger = false;
+	if (!ScanNumber(Start, End, bIsInteger))
+	{
+		return false;
+	}
+
+	if (bIsInteger)
+	{
+		const bool bIsNegative = (Data[Start] == '-');
+
+		int64 Magnitude = 0;
+		for (int32 i = (bIsNegative ? Start + 1 : Start); i < End; ++i)
+		{
+			Magnitude = (Magnitude * 10) + (Data[i] - '0');
+			if (Magnitude > (static_cast<int64>(MAX_int32) + 1))
+			{
+				bHasError = true;
+				return false;
+			}
+		}
+
+		const int64 Value = (bIsNegative ? -Magnitude : Magnitude);
+		if (Value > MAX_int32)
+		{
+			bHasError = true;
+			return false;
+		}
+
+		OutValue = static_cast<int32>(Value);
+		return true;
+	}
+
+	// @gdemers fraction, or exponent, are rare in backend payloads. fall back to a double conversion.
+	ANSICHAR Buffer[64];
+	const int32 Length = (End - Start);
+	if (Length >= static_cast<int32>(UE_ARRAY_COUNT(Buffer)))
+	{
+		bHasError = true;
+		return false;
+	}
+
+	FMemory::Memcpy(Buffer, Data.GetData() + Start, Length);
+	Buffer[Length] = '\0';
+
+	const double Value = FMath::RoundHalfFromZero(FCStringAnsi::Atod(Buffer));
+	if (!(Value >= MIN_int32 && Value <= MAX_int32))
+	{
+		bHasError = true;
+		return false;
+	}
+
+	OutValue = static_cast<int32>(Value);
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadString(FString& OutValue)
+{
+	if (bHasError)
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+
+	int32 Start = 0;
+	int32 End = 0;
+	bool bHasEscapes = false;
+	if (!ScanString(Start, End, bHasEscapes))
+	{
+		return false;
+	}
+
+	// @gdemers converted straight from the payload view when there is nothing to unescape.
+	const uint8* Bytes = (Data.GetData() + Start);
+	int32 Length = (End - Start);
+
+	if (bHasEscapes)
+	{
+		if (!Unescape(Start, End, EscapeBuffer))
+		{
+			return false;
+		}
+
+		Bytes = EscapeBuffer.GetData();
+		Length = EscapeBuffer.Num();
+	}
+
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(Bytes), Length);
+	OutValue = FString(Converted.Length(), Converted.Get());
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadInt32Array(TArray<int32>& OutValues)
+{
+	OutValues.Reset();
+
+	if (!ReadArrayStart())
+	{
+		return false;
+	}
+
+	while (ReadNextElement())
+	{
+		int32 Value = 0;
+		if (!ReadInt32(Value))
+		{
+			break;
+		}
+
+		OutValues.Add(Value);
+	}
+
+	return !bHasError;
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadStringBytes(TArray<uint8>& OutValue)
+{
+	if (bHasError)
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+
+	int32 Start = 0;
+	int32 End = 0;
+	bool bHasEscapes = false;
+	if (!ScanString(Start, End, bHasEscapes))
+	{
+		return false;
+	}
+
+	if (bHasEscapes)
+	{
+		return Unescape(Start, End, OutValue);
+	}
+
+	OutValue.Reset();
+	OutValue.Append(Data.GetData() + Start, End - Start);
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::SkipValue()
+{
+	if (bHasError)
+	{
+		return false;
+	}
+
+	SkipWhitespace();
+	if (Offset >= Data.Num())
+	{
+		bHasError = true;
+		return false;
+	}
+
+	switch (Data[Offset])
+	{
+	case '{':
+		{
+			ReadObjectStart();
+
+			TArrayView<const uint8> Key;
+			while (ReadNextKey(Key))
+			{
+				SkipValue();
+			}
+
+			return !bHasError;
+		}
+	case '[':
+		{
+			ReadArrayStart();
+
+			while (ReadNextElement())
+			{
+				SkipValue();
+			}
+
+			return !bHasError;
+		}
+	case '"':
+		{
+			int32 Start = 0;
+			int32 End = 0;
+			bool bHasEscapes = false;
+			return ScanString(Start, End, bHasEscapes);
+		}
+	case 't':
+		return ScanLiteral("true");
+	case 'f':
+		return ScanLiteral("false");
+	case 'n':
+		return ScanLiteral("null");
+	default:
+		{
+			int32 Start = 0;
+			int32 End = 0;
+			bool bIsInteger = false;
+			return ScanNumber(Start, End, bIsInteger);
+		}
+	}
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadEnd()
+{
+	SkipWhitespace();
+	return !bHasError && (Depth == 0) && (Offset == Data.Num());
+}
+
+void FAVVMOnlineJsonStreamReader::SkipWhitespace()
+{
+	while (Offset < Data.Num() && NSAVVMOnlineJsonToken::IsWhitespace(Data[Offset]))
+	{
+		++Offset;
+	}
+}
+
+bool FAVVMOnlineJsonStreamReader::Consume(const uint8 Token)
+{
+	if (!bHasError && Peek(Token))
+	{
+		++Offset;
+		return true;
+	}
+
+	bHasError = true;
+	return false;
+}
+
+bool FAVVMOnlineJsonStreamReader::Peek(const uint8 Token) const
+{
+	return (Offset < Data.Num()) && (Data[Offset] == Token);
+}
+
+bool FAVVMOnlineJsonStreamReader::PushContainer()
+{
+	if (Depth >= MaxDepth)
+	{
+		bHasError = true;
+		return false;
+	}
+
+	FirstEntryMask |= (1ull << Depth);
+	++Depth;
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::PopContainer(const uint8 Token)
+{
+	if (!Consume(Token))
+	{
+		return false;
+	}
+
+	--Depth;
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::ScanString(int32& OutStart, int32& OutEnd, bool& bOutHasEscapes)
+{
+	if (!Consume('"'))
+	{
+		return false;
+	}
+
+	OutStart = Offset;
+	bOutHasEscapes = false;
+
+	while (Offset < Data.Num())
+	{
+		const uint8 Value = Data[Offset];
+		if (Value == '"')
+		{
+			OutEnd = Offset;
+			++Offset;
+			return true;
+		}
+
+		// @gdemers control characters must be escaped.
+		if (Value < 0x20)
+		{
+			break;
+		}
+
+		if (Value == '\\')
+		{
+			// @gdemers skip the escaped byte so an escaped quote doesn't terminate the string. validated by Unescape.
+			bOutHasEscapes = true;
+			++Offset;
+		}
+
+		++Offset;
+	}
+
+	bHasError = true;
+	return false;
+}
+
+bool FAVVMOnlineJsonStreamReader::ScanNumber(int32& OutStart, int32& OutEnd, bool& bOutIsInteger)
+{
+	OutStart = Offset;
+	bOutIsInteger = true;
+
+	const auto ScanDigits = [this]()
+	{
+		const int32 DigitsStart = Offset;
+		while (Offset < Data.Num() && NSAVVMOnlineJsonToken::IsDigit(Data[Offset]))
+		{
+			++Offset;
+		}
+
+		return (Offset > DigitsStart);
+	};
+
+	if (Peek('-'))
+	{
+		++Offset;
+	}
+
+	bool bIsValid = ScanDigits();
+
+	if (bIsValid && Peek('.'))
+	{
+		++Offset;
+		bOutIsInteger = false;
+		bIsValid = ScanDigits();
+	}
+
+	if (bIsValid && (Peek('e') || Peek('E')))
+	{
+		++Offset;
+		bOutIsInteger = false;
+
+		if (Peek('+') || Peek('-'))
+		{
+			++Offset;
+		}
+
+		bIsValid = ScanDigits();
+	}
+
+	if (!bIsValid)
+	{
+		bHasError = true;
+		return false;
+	}
+
+	OutEnd = Offset;
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::ScanLiteral(const ANSICHAR* Literal)
+{
+	const int32 Length = FCStringAnsi::Strlen(Literal);
+	if ((Offset + Length) > Data.Num() || FMemory::Memcmp(Data.GetData() + Offset, Literal, Length) != 0)
+	{
+		bHasError = true;
+		return false;
+	}
+
+	Offset += Length;
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::ReadHex4(const int32 Start, const int32 End, uint32& OutValue) const
+{
+	if ((Start + 4) > End)
+	{
+		return false;
+	}
+
+	OutValue = 0;
+	for (int32 i = Start; i < (Start + 4); ++i)
+	{
+		const int32 Digit = NSAVVMOnlineJsonToken::HexValue(Data[i]);
+		if (Digit == INDEX_NONE)
+		{
+			return false;
+		}
+
+		OutValue = (OutValue << 4) | static_cast<uint32>(Digit);
+	}
+
+	return true;
+}
+
+bool FAVVMOnlineJsonStreamReader::Unescape(const int32 Start, const int32 End, TArray<uint8>& OutValue)
+{
+	OutValue.Reset(End - Start);
+
+	for (int32 i = Start; i < End; ++i)
+	{
+		const uint8 Value = Data[i];
+		if (Value != '\\')
+		{
+			OutValue.Add(Value);
+			continue;
+		}
+
+		// @gdemers ScanString guarantee an escape is never the last byte of the string.
+		const uint8 Escaped = Data[++i];
+		switch (Escaped)
+		{
+		case '"':
+		case '\\':
+		case '/':
+			OutValue.Add(Escaped);
+			break;
+		case 'b':
+			OutValue.Add('\b');
+			break;
+		case 'f':
+			OutValue.Add('\f');
+			break;
+		case 'n':
+			OutValue.Add('\n');
+			break;
+		case 'r':
+			OutValue.Add('\r');
+			break;
+		case 't':
+			OutValue.Add('\t');
+			break;
+		case 'u':
+			{
+				uint32 CodePoint = 0;
+				if (!ReadHex4(i + 1, End, CodePoint))
+				{
+					bHasError = true;
+					return false;
+				}
+
+				i += 4;
+
+				// @gdemers characters outside the BMP are escaped as a surrogate pair. lone surrogates are rejected.
+				if (CodePoint >= 0xD800 && CodePoint <= 0xDBFF)
+				{
+					uint32 LowSurrogate = 0;
+					const bool bHasLowSurrogate = ((i + 2) < End)
+						&& (Data[i + 1] == '\\')
+						&& (Data[i + 2] == 'u')
+						&& ReadHex4(i + 3, End, LowSurrogate)
+						&& (LowSurrogate >= 0xDC00 && LowSurrogate <= 0xDFFF);
+
+					if (!bHasLowSurrogate)
+					{
+						bHasError = true;
+						return false;
+					}
+
+					i += 6;
+					CodePoint = 0x10000 + ((CodePoint - 0xD800) << 10) + (LowSurrogate - 0xDC00);
+				}
+				else if (CodePoint >= 0xDC00 && CodePoint <= 0xDFFF)
+				{
+					bHasError = true;
+					return false;
+				}
+
+				NSAVVMOnlineJsonToken::AppendUTF8(OutValue, CodePoint);
+				break;
+			}
+		default:
+			bHasError = true;
+			return false;
+		}
+	}
+
+	return true;
+}
@@ -0,0 +1,618 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "AVVMOnlinePlayerBinaryCodec.h"
+
+#include "GameplayTagContainer.h"
+#include "Backend/AVVMOnlinePlayer.h"
+#include "Containers/StringConv.h"
+
+namespace NSAVVMOnlineBinary
+{
+	static void WriteHeader(FAVVMOnlineBinaryWriter& Writer, const EAVVMOnlineBinaryType Type)
+	{
+		Writer.WriteByte(FAVVMOnlinePlayerBinaryCodec::Magic);
+		Writer.WriteByte(static_cast<uint8>(Type));
+		Writer.WriteByte(FAVVMOnlinePlayerBinaryCodec::CurrentVersion);
+	}
+
+	static bool ReadHeader(FAVVMOnlineBinaryReader& Reader, const EAVVMOnlineBinaryType Type, uint8& OutVersion)
+	{
+		const uint8 Magic = Reader.ReadByte();
+		const uint8 EncodedType = Reader.ReadByte();
+		OutVersion = Reader.ReadByte();
+
+		return !Reader.HasError()
+			&& (Magic == FAVVMOnlinePlayerBinaryCodec::Magic)
+			&& (EncodedType == static_cast<uint8>(Type))
+			&& (OutVersion > 0 && OutVersion <= FAVVMOnlinePlayerBinaryCodec::CurrentVersion);
+	}
+
+	// @gdemers field layout per type. Version is the decoded payload version, to be used once fields are appended.
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerLoginContext& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.Username);
+		Writer.WriteString(Value.Password);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerLoginContext& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.Username = Reader.ReadString();
+		OutValue.Password = Reader.ReadString();
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerAccount& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteVarInt32(Value.LoginId);
+		Writer.WriteString(Value.Gamertag);
+		Writer.WriteVarInt32(Value.WalletId);
+		Writer.WriteInt32Array(Value.ProfileIds);
+		Writer.WriteInt32Array(Value.PresetIds);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerAccount& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.LoginId = Reader.ReadVarInt32();
+		OutValue.Gamertag = Reader.ReadString();
+		OutValue.WalletId = Reader.ReadVarInt32();
+		Reader.ReadInt32Array(OutValue.ProfileIds);
+		Reader.ReadInt32Array(OutValue.PresetIds);
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerWallet& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteVarUInt32(Value.IrlMoneys.Num());
+		for (const FString& IrlMoney : Value.IrlMoneys)
+		{
+			Writer.WriteString(IrlMoney);
+		}
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerWallet& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+
+		const int32 Count = Reader.ReadCount();
+		OutValue.IrlMoneys.Reset(Count);
+		for (int32 i = 0; i < Count && !Reader.HasError(); ++i)
+		{
+			OutValue.IrlMoneys.Add(Reader.ReadString());
+		}
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMCurrency& Value)
+	{
+		Writer.WriteString(Value.CurrencyId);
+		Writer.WriteVarInt32(Value.TotalAmount);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMCurrency& OutValue)
+	{
+		OutValue.CurrencyId = Reader.ReadString();
+		OutValue.TotalAmount = Reader.ReadVarInt32();
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerProfile& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.ProfileId);
+		Writer.WriteInt32Array(Value.InventoryIds);
+		Writer.WriteInt32Array(Value.SkinIds);
+		Writer.WriteInt32Array(Value.CharmsIds);
+		Writer.WriteInt32Array(Value.SkillIds);
+		Writer.WriteInt32Array(Value.ChallengeIds);
+		Writer.WriteVarInt32(Value.EquippedPresetId);
+		Writer.WriteInt32Array(Value.ComplexDependencyLookup);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerProfile& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.ProfileId = Reader.ReadString();
+		Reader.ReadInt32Array(OutValue.InventoryIds);
+		Reader.ReadInt32Array(OutValue.SkinIds);
+		Reader.ReadInt32Array(OutValue.CharmsIds);
+		Reader.ReadInt32Array(OutValue.SkillIds);
+		Reader.ReadInt32Array(OutValue.ChallengeIds);
+		OutValue.EquippedPresetId = Reader.ReadVarInt32();
+		Reader.ReadInt32Array(OutValue.ComplexDependencyLookup);
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerPreset& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.PresetId);
+		Writer.WriteVarUInt32(Value.EquippedItems.Num());
+		for (const TPair<FGameplayTag, int32>& EquippedItem : Value.EquippedItems)
+		{
+			Writer.WriteString(EquippedItem.Key.ToString());
+			Writer.WriteVarInt32(EquippedItem.Value);
+		}
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerPreset& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.PresetId = Reader.ReadString();
+
+		const int32 Count = Reader.ReadCount();
+		OutValue.EquippedItems.Reset();
+		OutValue.EquippedItems.Reserve(Count);
+		for (int32 i = 0; i < Count && !Reader.HasError(); ++i)
+		{
+			const FString SlotName = Reader.ReadString();
+			const int32 ItemId = Reader.ReadVarInt32();
+
+			// @gdemers unknown slot. the payload is rejected, rather than keying the item on an empty tag.
+			const FGameplayTag SlotTag = FGameplayTag::RequestGameplayTag(FName(*SlotName), false);
+			if (!SlotTag.IsValid())
+			{
+				Reader.SetError();
+				break;
+			}
+
+			OutValue.EquippedItems.Add(SlotTag, ItemId);
+		}
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerResource& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.ResourceId);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerResource& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.ResourceId = Reader.ReadString();
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerChallenge& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.ChallengeId);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerChallenge& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.ChallengeId = Reader.ReadString();
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMParty& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.PartyId);
+		Writer.WriteVarInt32(Value.RegionId);
+		Writer.WriteVarInt32(Value.DistrictId);
+		Writer.WriteVarInt32(Value.HostConfigurationId);
+		Writer.WriteInt32Array(Value.PlayerConnectionIds);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMParty& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.PartyId = Reader.ReadString();
+		OutValue.RegionId = Reader.ReadVarInt32();
+		OutValue.DistrictId = Reader.ReadVarInt32();
+		OutValue.HostConfigurationId = Reader.ReadVarInt32();
+		Reader.ReadInt32Array(OutValue.PlayerConnectionIds);
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMPlayerConnection& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.UniqueNetId);
+		Writer.WriteByte(static_cast<uint8>(Value.PlayerStatus));
+		Writer.WriteVarInt32(Value.ProfileId);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMPlayerConnection& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.UniqueNetId = Reader.ReadString();
+
+		const uint8 PlayerStatus = Reader.ReadByte();
+		if (PlayerStatus > static_cast<uint8>(EAVVMPlayerStatus::PendingAction))
+		{
+			Reader.SetError();
+		}
+
+		OutValue.PlayerStatus = static_cast<EAVVMPlayerStatus>(PlayerStatus);
+		OutValue.ProfileId = Reader.ReadVarInt32();
+	}
+
+	static void Write(FAVVMOnlineBinaryWriter& Writer, const FAVVMHostConfiguration& Value)
+	{
+		Writer.WriteVarInt32(Value.UniqueId);
+		Writer.WriteString(Value.GameMode);
+		Writer.WriteString(Value.GameModeAdditiveOptions);
+	}
+
+	static void Read(FAVVMOnlineBinaryReader& Reader, const uint8 Version, FAVVMHostConfiguration& OutValue)
+	{
+		OutValue.UniqueId = Reader.ReadVarInt32();
+		OutValue.GameMode = Reader.ReadString();
+		OutValue.GameModeAdditiveOptions = Reader.ReadString();
+	}
+
+	template<typename T>
+	static void Encode(const T& Value, const EAVVMOnlineBinaryType Type, TArray<uint8>& OutFormat)
+	{
+		OutFormat.Reset();
+
+		FAVVMOnlineBinaryWriter Writer(OutFormat);
+		WriteHeader(Writer, Type);
+		Write(Writer, Value);
+	}
+
+	template<typename T>
+	static void EncodeArray(const TArray<T>& Values, const EAVVMOnlineBinaryType Type, TArray<uint8>& OutFormat)
+	{
+		OutFormat.Reset();
+
+		FAVVMOnlineBinaryWriter Writer(OutFormat);
+		WriteHeader(Writer, Type);
+		Writer.WriteVarUInt32(Values.Num());
+		for (const T& Value : Values)
+		{
+			Write(Writer, Value);
+		}
+	}
+
+	// @gdemers output is only modified on success. a truncated, or trailing, payload is rejected.
+	template<typename T>
+	static bool Decode(TArrayView<const uint8> NewPayload, const EAVVMOnlineBinaryType Type, T& OutValue)
+	{
+		FAVVMOnlineBinaryReader Reader(NewPayload);
+
+		uint8 Version = 0;
+		if (!ReadHeader(Reader, Type, Version))
+		{
+			return false;
+		}
+
+		T NewValue;
+		Read(Reader, Version, NewValue);
+		if (Reader.HasError() || !Reader.IsAtEnd())
+		{
+			return false;
+		}
+
+		OutValue = MoveTemp(NewValue);
+		return true;
+	}
+
+	template<typename T>
+	static bool DecodeArray(TArrayView<const uint8> NewPayload, const EAVVMOnlineBinaryType Type, TArray<T>& OutValues)
+	{
+		FAVVMOnlineBinaryReader Reader(NewPayload);
+
+		uint8 Version = 0;
+		if (!ReadHeader(Reader, Type, Version))
+		{
+			return false;
+		}
+
+		const int32 Count = Reader.ReadCount();
+
+		TArray<T> NewValues;
+		NewValues.Reserve(Count);
+		for (int32 i = 0; i < Count && !Reader.HasError(); ++i)
+		{
+			Read(Reader, Version, NewValues.AddDefaulted_GetRef());
+		}
+
+		if (Reader.HasError() || !Reader.IsAtEnd())
+		{
+			return false;
+		}
+
+		OutValues = MoveTemp(NewValues);
+		return true;
+	}
+}
+
+FAVVMOnlineBinaryWriter::FAVVMOnlineBinaryWriter(TArray<uint8>& NewBuffer)
+	: Buffer(NewBuffer)
+{
+}
+
+void FAVVMOnlineBinaryWriter::WriteByte(const uint8 Value)
+{
+	Buffer.Add(Value);
+}
+
+void FAVVMOnlineBinaryWriter::WriteVarUInt32(uint32 Value)
+{
+	while (Value >= 0x80)
+	{
+		Buffer.Add(static_cast<uint8>(Value | 0x80));
+		Value >>= 7;
+	}
+
+	Buffer.Add(static_cast<uint8>(Value));
+}
+
+void FAVVMOnlineBinaryWriter::WriteVarInt32(const int32 Value)
+{
+	// @gdemers zigzag. maps small magnitudes, positive or negative, to small unsigned values.
+	const uint32 ZigZag = (static_cast<uint32>(Value) << 1) ^ static_cast<uint32>(Value >> 31);
+	WriteVarUInt32(ZigZag);
+}
+
+void FAVVMOnlineBinaryWriter::WriteString(const FString& Value)
+{
+	const FTCHARToUTF8 Converted(*Value, Value.Len());
+	WriteVarUInt32(Converted.Length());
+	Buffer.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+}
+
+void FAVVMOnlineBinaryWriter::WriteInt32Array(const TArray<int32>& Values)
+{
+	WriteVarUInt32(Values.Num());
+	for (const int32 Value : Values)
+	{
+		WriteVarInt32(Value);
+	}
+}
+
+FAVVMOnlineBinaryReader::FAVVMOnlineBinaryReader(TArrayView<const uint8> NewData)
+	: Data(NewData)
+{
+}
+
+uint8 FAVVMOnlineBinaryReader::ReadByte()
+{
+	if (bHasError || Offset >= Data.Num())
+	{
+		SetError();
+		return 0;
+	}
+
+	return Data[Offset++];
+}
+
+uint32 FAVVMOnlineBinaryReader::ReadVarUInt32()
+{
+	uint32 Result = 0;
+	for (int32 Shift = 0; Shift < 32; Shift += 7)
+	{
+		const uint8 Byte = ReadByte();
+		if (bHasError)
+		{
+			return 0;
+		}
+
+		// @gdemers fifth byte may only carry the 4 remaining bits.
+		if (Shift == 28 && (Byte & 0xF0) != 0)
+		{
+			SetError();
+			return 0;
+		}
+
+		Result |= (static_cast<uint32>(Byte & 0x7F) << Shift);
+		if ((Byte & 0x80) == 0)
+		{
+			return Result;
+		}
+	}
+
+	SetError();
+	return 0;
+}
+
+int32 FAVVMOnlineBinaryReader::ReadVarInt32()
+{
+	const uint32 ZigZag = ReadVarUInt32();
+	return static_cast<int32>(ZigZag >> 1) ^ -static_cast<int32>(ZigZag & 1);
+}
+
+FString FAVVMOnlineBinaryReader::ReadString()
+{
+	const int32 Length = ReadCount();
+	if (bHasError || Length == 0)
+	{
+		return FString();
+	}
+
+	// @gdemers converted straight from the payload view. no intermediate byte copy.
+	const FUTF8ToTCHAR Converted(reinterpret_cast<const UTF8CHAR*>(Data.GetData() + Offset), Length);
+	Offset += Length;
+
+	return FString(Converted.Length(), Converted.Get());
+}
+
+void FAVVMOnlineBinaryReader::ReadInt32Array(TArray<int32>& OutValues)
+{
+	const int32 Count = ReadCount();
+	OutValues.Reset(Count);
+	for (int32 i = 0; i < Count && !bHasError; ++i)
+	{
+		OutValues.Add(ReadVarInt32());
+	}
+}
+
+int32 FAVVMOnlineBinaryReader::ReadCount()
+{
+	// @gdemers every element is at least one byte.
+	const uint32 Count = ReadVarUInt32();
+	if (bHasError || Count > static_cast<uint32>(Data.Num() - Offset))
+	{
+		SetError();
+		return 0;
+	}
+
+	return static_cast<int32>(Count);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerLoginContext& OutPlayerLoginContext)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerLoginContext, OutPlayerLoginContext);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerLoginContext& NewPlayerLoginContext, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerLoginContext, EAVVMOnlineBinaryType::PlayerLoginContext, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerAccount& OutPlayerAccount)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerAccount, OutPlayerAccount);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerAccount& NewPlayerAccount, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerAccount, EAVVMOnlineBinaryType::PlayerAccount, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerWallet& OutPlayerWallet)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerWallet, OutPlayerWallet);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerWallet& NewPlayerWallet, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerWallet, EAVVMOnlineBinaryType::PlayerWallet, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMCurrency& OutCurrency)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::Currency, OutCurrency);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMCurrency& NewCurrency, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewCurrency, EAVVMOnlineBinaryType::Currency, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerProfile& OutPlayerProfile)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerProfile, OutPlayerProfile);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerProfile& NewPlayerProfile, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerProfile, EAVVMOnlineBinaryType::PlayerProfile, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerPreset& OutPlayerPreset)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerPreset, OutPlayerPreset);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerPreset& NewPlayerPreset, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerPreset, EAVVMOnlineBinaryType::PlayerPreset, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerResource>& OutPlayerResources)
+{
+	return NSAVVMOnlineBinary::DecodeArray(NewPayload, EAVVMOnlineBinaryType::PlayerResources, OutPlayerResources);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const TArray<FAVVMPlayerResource>& NewPlayerResources, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::EncodeArray(NewPlayerResources, EAVVMOnlineBinaryType::PlayerResources, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerResource& OutPlayerResource)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerResource, OutPlayerResource);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerResource& NewPlayerResource, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerResource, EAVVMOnlineBinaryType::PlayerResource, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerChallenge>& OutPlayerChallenges)
+{
+	return NSAVVMOnlineBinary::DecodeArray(NewPayload, EAVVMOnlineBinaryType::PlayerChallenges, OutPlayerChallenges);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const TArray<FAVVMPlayerChallenge>& NewPlayerChallenges, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::EncodeArray(NewPlayerChallenges, EAVVMOnlineBinaryType::PlayerChallenges, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerChallenge& OutPlayerChallenge)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerChallenge, OutPlayerChallenge);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerChallenge& NewPlayerChallenge, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerChallenge, EAVVMOnlineBinaryType::PlayerChallenge, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMParty>& OutParties)
+{
+	return NSAVVMOnlineBinary::DecodeArray(NewPayload, EAVVMOnlineBinaryType::Parties, OutParties);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const TArray<FAVVMParty>& NewParties, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::EncodeArray(NewParties, EAVVMOnlineBinaryType::Parties, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMParty& OutParty)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::Party, OutParty);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMParty& NewParty, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewParty, EAVVMOnlineBinaryType::Party, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerConnection>& OutPlayerConnections)
+{
+	return NSAVVMOnlineBinary::DecodeArray(NewPayload, EAVVMOnlineBinaryType::PlayerConnections, OutPlayerConnections);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const TArray<FAVVMPlayerConnection>& NewPlayerConnections, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::EncodeArray(NewPlayerConnections, EAVVMOnlineBinaryType::PlayerConnections, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerConnection& OutPlayerConnection)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::PlayerConnection, OutPlayerConnection);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMPlayerConnection& NewPlayerConnection, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewPlayerConnection, EAVVMOnlineBinaryType::PlayerConnection, OutFormat);
+}
+
+bool FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8> NewPayload, FAVVMHostConfiguration& OutHostConfiguration)
+{
+	return NSAVVMOnlineBinary::Decode(NewPayload, EAVVMOnlineBinaryType::HostConfiguration, OutHostConfiguration);
+}
+
+void FAVVMOnlinePlayerBinaryCodec::ToBinary(const FAVVMHostConfiguration& NewHostConfiguration, TArray<uint8>& OutFormat)
+{
+	NSAVVMOnlineBinary::Encode(NewHostConfiguration, EAVVMOnlineBinaryType::HostConfiguration, OutFormat);
+}
@@ -20,13 +20,356 @@
 #include "AVVMOnlinePlayerStringParser.h"
 
 #include "AVVMOnlineInterface.h"
+#include "AVVMOnlineJsonStreamReader.h"
 #include "Backend/AVVMOnlinePlayer.h"
 #include "Backend/AVVMOnlinePlayerProxy.h"
+#include "Containers/StringConv.h"
 #include "Dom/JsonObject.h"
 #include "Dom/JsonValue.h"
 #include "Serialization/JsonReader.h"
 #include "Serialization/JsonSerializer.h"
 
+namespace NSAVVMOnlineJsonStream
+{
+	using FReader = FAVVMOnlineJsonStreamReader;
+
+	// @gdemers field names match the ToString overloads. unknown fields are skipped.
+	static bool Read(FReader& Reader, FAVVMPlayerProfile& OutValue)
+	{
+		if (!Reader.ReadObjectStart())
+		{
+			return false;
+		}
+
+		TArrayView<const uint8> Key;
+		while (Reader.ReadNextKey(Key))
+		{
+			if (FReader::MatchesKey(Key, "UniqueId"))
+			{
+				Reader.ReadInt32(OutValue.UniqueId);
+			}
+			else if (FReader::MatchesKey(Key, "ProfileId"))
+			{
+				Reader.ReadString(OutValue.ProfileId);
+			}
+			else if (FReader::MatchesKey(Key, "InventoryIds"))
+			{
+				Reader.ReadInt32Array(OutValue.InventoryIds);
+			}
+			else if (FReader::MatchesKey(Key, "SkinIds"))
+			{
+				Reader.ReadInt32Array(OutValue.SkinIds);
+			}
+			else if (FReader::MatchesKey(Key, "CharmsIds"))
+			{
+				Reader.ReadInt32Array(OutValue.CharmsIds);
+			}
+			else if (FReader::MatchesKey(Key, "SkillIds"))
+			{
+				Reader.ReadInt32Array(OutValue.SkillIds);
+			}
+			else if (FReader::MatchesKey(Key, "ChallengeIds"))
+			{
+				Reader.ReadInt32Array(OutValue.ChallengeIds);
+			}
+			else if (FReader::MatchesKey(Key, "EquippedPresetId"))
+			{
+				Reader.ReadInt32(OutValue.EquippedPresetId);
+			}
+			else if (FReader::MatchesKey(Key, "ComplexDependencyLookup"))
+			{
+				Reader.ReadInt32Array(OutValue.ComplexDependencyLookup);
+			}
+			else
+			{
+				Reader.SkipValue();
+			}
+		}
+
+		return !Reader.HasError();
+	}
+
+	static bool Read(FReader& Reader, FAVVMPlayerPreset& OutValue)
+	{
+		if (!Reader.ReadObjectStart())
+		{
+			return false;
+		}
+
+		TArrayView<const uint8> Key;
+		while (Reader.ReadNextKey(Key))
+		{
+			if (FReader::MatchesKey(Key, "UniqueId"))
+			{
+				Reader.ReadInt32(OutValue.UniqueId);
+			}
+			else if (FReader::MatchesKey(Key, "PresetId"))
+			{
+				Reader.ReadString(OutValue.PresetId);
+			}
+			else if (FReader::MatchesKey(Key, "EquippedItems"))
+			{
+				if (!Reader.ReadArrayStart())
+				{
+					break;
+				}
+
+				while (Reader.ReadNextElement())
+				{
+					if (!Reader.ReadObjectStart())
+					{
+						break;
+					}
+
+					FString GameplayTag;
+					int32 ItemId = 0;
+
+					TArrayView<const uint8> EntryKey;
+					while (Reader.ReadNextKey(EntryKey))
+					{
+						if (FReader::MatchesKey(EntryKey, "SlotTag"))
+						{
+							Reader.ReadString(GameplayTag);
+						}
+						else if (FReader::MatchesKey(EntryKey, "ItemId"))
+						{
+							Reader.ReadInt32(ItemId);
+						}
+						else
+						{
+							Reader.SkipValue();
+						}
+					}
+
+					if (Reader.HasError())
+					{
+						break;
+					}
+
+					// @gdemers unknown slot. the payload is rejected, rather than keying the item on an empty tag.
+					const FGameplayTag SlotTag = FGameplayTag::RequestGameplayTag(FName(GameplayTag), false);
+					if (!SlotTag.IsValid())
+					{
+						Reader.SetError();
+						break;
+					}
+
+					OutValue.EquippedItems.FindOrAdd(SlotTag, ItemId);
+				}
+			}
+			else
+			{
+				Reader.SkipValue();
+			}
+		}
+
+		return !Reader.HasError();
+	}
+
+	static bool Read(FReader& Reader, FAVVMPlayerResource& OutValue)
+	{
+		if (!Reader.ReadObjectStart())
+		{
+			return false;
+		}
+
+		TArrayView<const uint8> Key;
+		while (Reader.ReadNextKey(Key))
+		{
+			if (FReader::MatchesKey(Key, "UniqueId"))
+			{
+				Reader.ReadInt32(OutValue.UniqueId);
+			}
+			else if (FReader::MatchesKey(Key, "ResourceId"))
+			{
+				Reader.ReadString(OutValue.ResourceId);
+			}
+			else
+			{
+				Reader.SkipValue();
+			}
+		}
+
+		return !Reader.HasError();
+	}
+
+	static bool Read(FReader& Reader, FAVVMPlayerChallenge& OutValue)
+	{
+		if (!Reader.ReadObjectStart())
+		{
+			return false;
+		}
+
+		TArrayView<const uint8> Key;
+		while (Reader.ReadNextKey(Key))
+		{
+			if (FReader::MatchesKey(Key, "UniqueId"))
+			{
+				Reader.ReadInt32(OutValue.UniqueId);
+			}
+			else if (FReader::MatchesKey(Key, "ChallengeId"))
+			{
+				Reader.ReadString(OutValue.ChallengeId);
+			}
+			else
+			{
+				Reader.SkipValue();
+			}
+		}
+
+		return !Reader.HasError();
+	}
+
+	static bool Read(FReader& Reader, FAVVMParty& OutValue)
+	{
+		if (!Reader.ReadObjectStart())
+		{
+			return false;
+		}
+
+		TArrayView<const uint8> Key;
+		while (Reader.ReadNextKey(Key))
+		{
+			if (FReader::MatchesKey(Key, "UniqueId"))
+			{
+				Reader.ReadInt32(OutValue.UniqueId);
+			}
+			else if (FReader::MatchesKey(Key, "PartyId"))
+			{
+				Reader.ReadString(OutValue.PartyId);
+			}
+			else if (FReader::MatchesKey(Key, "RegionId"))
+			{
+				Reader.ReadInt32(OutValue.RegionId);
+			}
+			else if (FReader::MatchesKey(Key, "DistrictId"))
+			{
+				Reader.ReadInt32(OutValue.DistrictId);
+			}
+			else if (FReader::MatchesKey(Key, "HostConfigurationId"))
+			{
+				Reader.ReadInt32(OutValue.HostConfigurationId);
+			}
+			else if (FReader::MatchesKey(Key, "PlayerConnectionIds"))
+			{
+				Reader.ReadInt32Array(OutValue.PlayerConnectionIds);
+			}
+			else
+			{
+				Reader.SkipValue();
+			}
+		}
+
+		return !Reader.HasError();
+	}
+
+	static bool Read(FReader& Reader, FAVVMPlayerConnection& OutValue)
+	{
+		if (!Reader.ReadObjectStart())
+		{
+			return false;
+		}
+
+		TArrayView<const uint8> Key;
+		while (Reader.ReadNextKey(Key))
+		{
+			if (FReader::MatchesKey(Key, "UniqueId"))
+			{
+				Reader.ReadInt32(OutValue.UniqueId);
+			}
+			else if (FReader::MatchesKey(Key, "UniqueNetId"))
+			{
+				Reader.ReadString(OutValue.UniqueNetId);
+			}
+			else if (FReader::MatchesKey(Key, "PlayerStatus"))
+			{
+				int32 PlayerStatus = 0;
+				Reader.ReadInt32(PlayerStatus);
+				OutValue.PlayerStatus = StaticCast<EAVVMPlayerStatus>(PlayerStatus);
+			}
+			else if (FReader::MatchesKey(Key, "ProfileId"))
+			{
+				Reader.ReadInt32(OutValue.ProfileId);
+			}
+			else
+			{
+				Reader.SkipValue();
+			}
+		}
+
+		return !Reader.HasError();
+	}
+
+	template<typename T>
+	static bool Decode(TArrayView<const uint8> NewPayload, T& OutValue)
+	{
+		FReader Reader(NewPayload);
+
+		T NewValue;
+		if (!Read(Reader, NewValue) || !Reader.ReadEnd())
+		{
+			return false;
+		}
+
+		OutValue = MoveTemp(NewValue);
+		return true;
+	}
+
+	// @gdemers collections are an object holding an array of strings, each string being a nested JSON document. see ToString.
+	template<typename T, int32 N>
+	static bool DecodeArray(TArrayView<const uint8> NewPayload, const ANSICHAR (&FieldName)[N], TArray<T>& OutValues)
+	{
+		FReader Reader(NewPayload);
+		if (!Reader.ReadObjectStart())
+		{
+			return false;
+		}
+
+		TArray<T> NewValues;
+		// @gdemers unescaped element document. reused across elements.
+		TArray<uint8> ElementPayload;
+
+		TArrayView<const uint8> Key;
+		while (Reader.ReadNextKey(Key))
+		{
+			if (!FReader::MatchesKey(Key, FieldName))
+			{
+				Reader.SkipValue();
+				continue;
+			}
+
+			NewValues.Reset();
+
+			if (!Reader.ReadArrayStart())
+			{
+				break;
+			}
+
+			while (Reader.ReadNextElement())
+			{
+				if (!Reader.ReadStringBytes(ElementPayload))
+				{
+					break;
+				}
+
+				if (!Decode(ElementPayload, NewValues.AddDefaulted_GetRef()))
+				{
+					Reader.SetError();
+					break;
+				}
+			}
+		}
+
+		if (!Reader.ReadEnd())
+		{
+			return false;
+		}
+
+		OutValues = MoveTemp(NewValues);
+		return true;
+	}
+}
+
 void UAVVMOnlinePlayerStringParser::FromString(const FString& NewPayload,
                                                FAVVMPlayerLoginContext& OutPlayerLoginContext) const
 {
@@ -355,7 +698,15 @@ void UAVVMOnlinePlayerStringParser::FromString(const FString& NewPayload,
 		{
 			const FString GameplayTag = (*OutKVPJsonObject)->GetStringField(TEXT("SlotTag"));
 			const int32 ItemId = (*OutKVPJsonObject)->GetIntegerField(TEXT("ItemId"));
-			NewPlayerPreset.EquippedItems.FindOrAdd(FGameplayTag::RequestGameplayTag(FName(GameplayTag)), ItemId);
+
+			// @gdemers unknown slot. the payload is rejected, rather than keying the item on an empty tag. same as FromUTF8.
+			const FGameplayTag SlotTag = FGameplayTag::RequestGameplayTag(FName(GameplayTag), false);
+			if (!SlotTag.IsValid())
+			{
+				return;
+			}
+
+			NewPlayerPreset.EquippedItems.FindOrAdd(SlotTag, ItemId);
 		}
 	}
 
@@ -394,23 +745,9 @@ void UAVVMOnlinePlayerStringParser::ToString(const FAVVMPlayerPreset& NewPlayerP
 void UAVVMOnlinePlayerStringParser::FromString(const FAVVMStringPayload& NewPayload,
                                                TArray<FAVVMPlayerResource>& OutPlayerResources) const
 {
-	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-
-	auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload.Payload);
-	if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
-	{
-		return;
-	}
-
-	OutPlayerResources.Reset();
-
-	const TArray<TSharedPtr<FJsonValue>> JsonValues = JsonData->GetArrayField(TEXT("PlayerResources"));
-	for (const auto& JsonValue : JsonValues)
-	{
-		FAVVMPlayerResource OutResource;
-		FromString(JsonValue->AsString(), OutResource);
-		OutPlayerResources.Add(OutResource);
-	}
+	// @gdemers single conversion of the whole payload, elements are then decoded in place from the UTF-8 bytes.
+	const FTCHARToUTF8 Converted(*NewPayload.Payload, NewPayload.Payload.Len());
+	FromUTF8(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length()), OutPlayerResources);
 }
 
 void UAVVMOnlinePlayerStringParser::ToString(const TArray<FAVVMPlayerResource>& NewPlayerResources,
@@ -478,23 +815,9 @@ void UAVVMOnlinePlayerStringParser::ToString(const FAVVMPlayerResource& NewPlaye
 void UAVVMOnlinePlayerStringParser::FromString(const FAVVMStringPayload& NewPayload,
                                                TArray<FAVVMPlayerChallenge>& OutPlayerChallenges) const
 {
-	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-
-	auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload.Payload);
-	if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
-	{
-		return;
-	}
-
-	OutPlayerChallenges.Reset();
-
-	const TArray<TSharedPtr<FJsonValue>> JsonValues = JsonData->GetArrayField(TEXT("PlayerChallenges"));
-	for (const auto& JsonValue : JsonValues)
-	{
-		FAVVMPlayerChallenge OutPlayerChallenge;
-		FromString(JsonValue->AsString(), OutPlayerChallenge);
-		OutPlayerChallenges.Add(OutPlayerChallenge);
-	}
+	// @gdemers single conversion of the whole payload, elements are then decoded in place from the UTF-8 bytes.
+	const FTCHARToUTF8 Converted(*NewPayload.Payload, NewPayload.Payload.Len());
+	FromUTF8(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length()), OutPlayerChallenges);
 }
 
 void UAVVMOnlinePlayerStringParser::ToString(const TArray<FAVVMPlayerChallenge>& NewPlayerChallenges,
@@ -562,23 +885,9 @@ void UAVVMOnlinePlayerStringParser::ToString(const FAVVMPlayerChallenge& NewPlay
 void UAVVMOnlinePlayerStringParser::FromString(const FAVVMStringPayload& NewPayload,
                                                TArray<FAVVMParty>& OutParties) const
 {
-	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-
-	auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload.Payload);
-	if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
-	{
-		return;
-	}
-
-	OutParties.Reset();
-
-	const TArray<TSharedPtr<FJsonValue>> JsonValues = JsonData->GetArrayField(TEXT("Parties"));
-	for (const auto& JsonValue : JsonValues)
-	{
-		FAVVMParty OutParty;
-		FromString(JsonValue->AsString(), OutParty);
-		OutParties.Add(OutParty);
-	}
+	// @gdemers single conversion of the whole payload, elements are then decoded in place from the UTF-8 bytes.
+	const FTCHARToUTF8 Converted(*NewPayload.Payload, NewPayload.Payload.Len());
+	FromUTF8(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length()), OutParties);
 }
 
 void UAVVMOnlinePlayerStringParser::ToString(const TArray<FAVVMParty>& NewParties,
@@ -665,23 +974,9 @@ void UAVVMOnlinePlayerStringParser::ToString(const FAVVMParty& NewParty,
 void UAVVMOnlinePlayerStringParser::FromString(const FAVVMStringPayload& NewPayload,
                                                TArray<FAVVMPlayerConnection>& OutPlayerConnections) const
 {
-	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-
-	auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload.Payload);
-	if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
-	{
-		return;
-	}
-
-	OutPlayerConnections.Reset();
-
-	const TArray<TSharedPtr<FJsonValue>> JsonValues = JsonData->GetArrayField(TEXT("PlayerConnections"));
-	for (const auto& JsonValue : JsonValues)
-	{
-		FAVVMPlayerConnection OutPlayerConnection;
-		FromString(JsonValue->AsString(), OutPlayerConnection);
-		OutPlayerConnections.Add(OutPlayerConnection);
-	}
+	// @gdemers single conversion of the whole payload, elements are then decoded in place from the UTF-8 bytes.
+	const FTCHARToUTF8 Converted(*NewPayload.Payload, NewPayload.Payload.Len());
+	FromUTF8(TArrayView<const uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length()), OutPlayerConnections);
 }
 
 void UAVVMOnlinePlayerStringParser::ToString(const TArray<FAVVMPlayerConnection>& NewPlayerConnections,
@@ -1267,3 +1562,63 @@ void UAVVMOnlinePlayerStringParser::ToString(const FAVVMHostConfigurationProxy&
 
 	OutFormat = JsonOutput;
 }
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             FAVVMPlayerProfile& OutPlayerProfile) const
+{
+	return NSAVVMOnlineJsonStream::Decode(NewPayload, OutPlayerProfile);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             FAVVMPlayerPreset& OutPlayerPreset) const
+{
+	return NSAVVMOnlineJsonStream::Decode(NewPayload, OutPlayerPreset);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             TArray<FAVVMPlayerResource>& OutPlayerResources) const
+{
+	return NSAVVMOnlineJsonStream::DecodeArray(NewPayload, "PlayerResources", OutPlayerResources);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             FAVVMPlayerResource& OutPlayerResource) const
+{
+	return NSAVVMOnlineJsonStream::Decode(NewPayload, OutPlayerResource);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             TArray<FAVVMPlayerChallenge>& OutPlayerChallenges) const
+{
+	return NSAVVMOnlineJsonStream::DecodeArray(NewPayload, "PlayerChallenges", OutPlayerChallenges);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             FAVVMPlayerChallenge& OutPlayerChallenge) const
+{
+	return NSAVVMOnlineJsonStream::Decode(NewPayload, OutPlayerChallenge);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             TArray<FAVVMParty>& OutParties) const
+{
+	return NSAVVMOnlineJsonStream::DecodeArray(NewPayload, "Parties", OutParties);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             FAVVMParty& OutParty) const
+{
+	return NSAVVMOnlineJsonStream::Decode(NewPayload, OutParty);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             TArray<FAVVMPlayerConnection>& OutPlayerConnections) const
+{
+	return NSAVVMOnlineJsonStream::DecodeArray(NewPayload, "PlayerConnections", OutPlayerConnections);
+}
+
+bool UAVVMOnlinePlayerStringParser::FromUTF8(TArrayView<const uint8> NewPayload,
+                                             FAVVMPlayerConnection& OutPlayerConnection) const
+{
+	return NSAVVMOnlineJsonStream::Decode(NewPayload, OutPlayerConnection);
+}
@@ -0,0 +1,744 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "Misc/AutomationTest.h"
+
+#include "AVVMOnlineInterface.h"
+#include "AVVMOnlineModule.h"
+#include "AVVMOnlinePlayerBinaryCodec.h"
+#include "AVVMOnlinePlayerStringParser.h"
+#include "NativeGameplayTags.h"
+#include "Backend/AVVMOnlinePlayer.h"
+#include "Containers/StringConv.h"
+#include "HAL/MemoryBase.h"
+#include "HAL/PlatformTime.h"
+#include "Math/RandomStream.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+
+#if WITH_AUTOMATION_TESTS
+#include "Tests/AutomationCommon.h"
+#endif
+
+#if WITH_AUTOMATION_TESTS
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_AVVMONLINE_BENCHMARK_HEAD, "AVVMOnline.AutomatedTest.Benchmark.Head");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_AVVMONLINE_BENCHMARK_TORSO, "AVVMOnline.AutomatedTest.Benchmark.Torso");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_AVVMONLINE_BENCHMARK_PRIMARY, "AVVMOnline.AutomatedTest.Benchmark.Primary");
+UE_DEFINE_GAMEPLAY_TAG_STATIC(TAG_AVVMONLINE_BENCHMARK_SECONDARY, "AVVMOnline.AutomatedTest.Benchmark.Secondary");
+
+/**
+ *	Class description:
+ *
+ *	FAVVMOnlineAllocationCounter is a malloc proxy counting allocations, and reallocations, issued by threads that opted in through
+ *	FAVVMOnlineScopedAllocationCounter. Other threads go through it untouched. Installed over GMalloc once, on first use, and never
+ *	uninstalled or destroyed : blocks allocated through it may be freed at any point until exit, and counting is gated by a
+ *	thread local flag rather than by swapping GMalloc back and forth.
+ *	Swapping GMalloc on a live process is only safe when no other thread is caching it. PerfFilter tests only, run with -nullrhi on an
+ *	otherwise idle process (i.e - no PIE session, no asset streaming in flight).
+ *	Every FMalloc virtual is forwarded to the wrapped allocator, the way FMallocPoisonProxy does, so thread caches, stats, and fork
+ *	hooks keep working once installed.
+ */
+class FAVVMOnlineAllocationCounter final : public FMalloc
+{
+public:
+	static FAVVMOnlineAllocationCounter& Get()
+	{
+		// @gdemers leaked on purpose. FMalloc is allocated through the system allocator, and GMalloc must outlive static destruction.
+		static FAVVMOnlineAllocationCounter* Counter = []()
+		{
+			auto* NewCounter = new FAVVMOnlineAllocationCounter();
+			NewCounter->Inner = GMalloc;
+
+			FPlatformMisc::MemoryBarrier();
+			GMalloc = NewCounter;
+			return NewCounter;
+		}();
+
+		return *Counter;
+	}
+
+	static void BeginCounting()
+	{
+		NumAllocations = 0;
+		bIsCounting = true;
+	}
+
+	static int64 EndCounting()
+	{
+		bIsCounting = false;
+		return NumAllocations;
+	}
+
+	// @gdemers a proxy installed over us, or an allocator replacing GMalloc outright, may not route FMemory to us. probe once, and
+	// only trust the counter when a single allocation is counted as such.
+	static bool IsTrustworthy()
+	{
+		static const bool bIsTrustworthy = []()
+		{
+			Get();
+			BeginCounting();
+			FMemory::Free(FMemory::Malloc(16));
+			return (EndCounting() == 1);
+		}();
+
+		return bIsTrustworthy;
+	}
+
+	virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+	{
+		RecordAllocation();
+		return Inner->Malloc(Count, Alignment);
+	}
+
+	virtual void* TryMalloc(SIZE_T Count, uint32 Alignment) override
+	{
+		RecordAllocation();
+		return Inner->TryMalloc(Count, Alignment);
+	}
+
+	virtual void* MallocZeroed(SIZE_T Count, uint32 Alignment) override
+	{
+		RecordAllocation();
+		return Inner->MallocZeroed(Count, Alignment);
+	}
+
+	virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		RecordAllocation();
+		return Inner->Realloc(Original, Count, Alignment);
+	}
+
+	virtual void* TryRealloc(void* Original, SIZE_T Count, uint32 Alignment) override
+	{
+		RecordAllocation();
+		return Inner->TryRealloc(Original, Count, Alignment);
+	}
+
+	virtual void Free(void* Original) override { Inner->Free(Original); }
+	virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+	virtual SIZE_T QuantizeSize(SIZE_T Count, uint32 Alignment) override { return Inner->QuantizeSize(Count, Alignment); }
+	virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+	virtual void Trim(bool bTrimThreadCaches) override { Inner->Trim(bTrimThreadCaches); }
+	virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+	virtual const TCHAR* GetDescriptiveName() override { return TEXT("AVVMOnlineAllocationCounter"); }
+
+	virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+	virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+	virtual void MarkTLSCachesAsUsedOnCurrentThread() override { Inner->MarkTLSCachesAsUsedOnCurrentThread(); }
+	virtual void MarkTLSCachesAsUnusedOnCurrentThread() override { Inner->MarkTLSCachesAsUnusedOnCurrentThread(); }
+
+	virtual void InitializeStatsMetadata() override { Inner->InitializeStatsMetadata(); }
+	virtual void UpdateStats() override { Inner->UpdateStats(); }
+	virtual void GetAllocatorStats(FGenericMemoryStats& OutStats) override { Inner->GetAllocatorStats(OutStats); }
+	virtual void DumpAllocatorStats(FOutputDevice& Ar) override { Inner->DumpAllocatorStats(Ar); }
+	virtual uint64 GetTotalFreeCachedMemorySize() const override { return Inner->GetTotalFreeCachedMemorySize(); }
+
+	virtual void OnMallocInitialized() override { Inner->OnMallocInitialized(); }
+	virtual void OnPreFork() override { Inner->OnPreFork(); }
+	virtual void OnPostFork() override { Inner->OnPostFork(); }
+
+private:
+	static void RecordAllocation()
+	{
+		if (bIsCounting)
+		{
+			++NumAllocations;
+		}
+	}
+
+	FMalloc* Inner = nullptr;
+
+	static inline thread_local bool bIsCounting = false;
+	static inline thread_local int64 NumAllocations = 0;
+};
+
+/**
+ *	Class description:
+ *
+ *	FAVVMOnlineScopedAllocationCounter count allocations made by the calling thread for the lifetime of the scope. Platforms compiling
+ *	FMemory against a fixed allocator class bypass GMalloc, and report INDEX_NONE, as do processes where the counter fails its probe.
+ */
+class FAVVMOnlineScopedAllocationCounter
+{
+public:
+	FAVVMOnlineScopedAllocationCounter()
+	{
+#if !PLATFORM_USES_FIXED_GMalloc_CLASS
+		bIsCounting = FAVVMOnlineAllocationCounter::IsTrustworthy();
+		if (bIsCounting)
+		{
+			FAVVMOnlineAllocationCounter::BeginCounting();
+		}
+#endif
+	}
+
+	~FAVVMOnlineScopedAllocationCounter()
+	{
+		Stop();
+	}
+
+	static bool IsSupported()
+	{
+#if !PLATFORM_USES_FIXED_GMalloc_CLASS
+		return FAVVMOnlineAllocationCounter::IsTrustworthy();
+#else
+		return false;
+#endif
+	}
+
+	int64 GetNumAllocations()
+	{
+		Stop();
+		return NumAllocations;
+	}
+
+private:
+	void Stop()
+	{
+#if !PLATFORM_USES_FIXED_GMalloc_CLASS
+		if (bIsCounting)
+		{
+			NumAllocations = FAVVMOnlineAllocationCounter::EndCounting();
+			bIsCounting = false;
+		}
+#endif
+	}
+
+	int64 NumAllocations = INDEX_NONE;
+	bool bIsCounting = false;
+};
+
+namespace NSAVVMOnlineSerializationBenchmark
+{
+	static constexpr int32 NumWarmupIterations = 3;
+	static constexpr int32 NumMutations = 512;
+	static constexpr int32 MaxTruncationsPerPayload = 256;
+	static constexpr int32 RandomSeed = 0xA77A;
+
+	struct FBenchmarkSize
+	{
+		const TCHAR* Name = nullptr;
+		int32 NumIds = 0;
+		int32 NumEntries = 0;
+		int32 NumIterations = 0;
+	};
+
+	static const FBenchmarkSize Sizes[] =
+	{
+		// @gdemers typical login payload.
+		{TEXT("Realistic"), 256, 16, 1000},
+		// @gdemers long-lived account, and a full server browser pull.
+		{TEXT("Extreme"), 10000, 2000, 10},
+	};
+
+	enum class ECodec : uint8
+	{
+		// @gdemers FString entry points. DOM for single structs, streaming for FAVVMStringPayload collections.
+		Json,
+		// @gdemers FromUTF8 entry points, over the UTF-8 bytes as received from a backend. same encoder as Json.
+		JsonStream,
+		Binary
+	};
+
+	static constexpr ECodec Codecs[] = {ECodec::Json, ECodec::JsonStream, ECodec::Binary};
+
+	static const TCHAR* GetCodecName(const ECodec Codec)
+	{
+		switch (Codec)
+		{
+		case ECodec::Json:
+			return TEXT("Json");
+		case ECodec::JsonStream:
+			return TEXT("JsonStream");
+		case ECodec::Binary:
+			return TEXT("Binary");
+		default:
+			return TEXT("None");
+		}
+	}
+
+	struct FBenchmarkResult
+	{
+		FString Name = FString();
+		FString Size = FString();
+		FString Codec = FString();
+		/*Wire size. UTF-8 for Json*/
+		int32 NumBytes = 0;
+		double EncodeMeanUs = 0.0;
+		double DecodeMeanUs = 0.0;
+		double DecodeMBps = 0.0;
+		int64 EncodeAllocations = 0;
+		int64 DecodeAllocations = 0;
+
+		static FString GetCsvHeader()
+		{
+			return TEXT("Name,Size,Codec,NumBytes,EncodeMeanUs,DecodeMeanUs,DecodeMBps,EncodeAllocations,DecodeAllocations,RoundTripAllocations");
+		}
+
+		FString ToCsvRow() const
+		{
+			return FString::Printf(TEXT("%s,%s,%s,%d,%.2f,%.2f,%.1f,%lld,%lld,%lld"),
+			                       *Name,
+			                       *Size,
+			                       *Codec,
+			                       NumBytes,
+			                       EncodeMeanUs,
+			                       DecodeMeanUs,
+			                       DecodeMBps,
+			                       EncodeAllocations,
+			                       DecodeAllocations,
+			                       (EncodeAllocations + DecodeAllocations));
+		}
+	};
+
+	struct FEncodedPayload
+	{
+		FString String = FString();
+		TArray<uint8> Bytes;
+	};
+
+	static int32 RandId(FRandomStream& Stream)
+	{
+		// @gdemers full int32 range, worst case for decimal, and varint, widths.
+		return static_cast<int32>(Stream.GetUnsignedInt());
+	}
+
+	static void MakeIds(FRandomStream& Stream, const int32 Num, TArray<int32>& OutIds)
+	{
+		OutIds.Reset(Num);
+		for (int32 i = 0; i < Num; ++i)
+		{
+			OutIds.Add(RandId(Stream));
+		}
+	}
+
+	static FAVVMPlayerProfile MakeProfile(FRandomStream& Stream, const FBenchmarkSize& Size)
+	{
+		FAVVMPlayerProfile OutProfile;
+		OutProfile.UniqueId = RandId(Stream);
+		OutProfile.ProfileId = FString::Printf(TEXT("Profile_%d"), OutProfile.UniqueId);
+		OutProfile.EquippedPresetId = RandId(Stream);
+		MakeIds(Stream, Size.NumIds, OutProfile.InventoryIds);
+		MakeIds(Stream, Size.NumIds / 8, OutProfile.SkinIds);
+		MakeIds(Stream, Size.NumIds / 8, OutProfile.CharmsIds);
+		MakeIds(Stream, Size.NumIds / 8, OutProfile.SkillIds);
+		MakeIds(Stream, Size.NumIds / 8, OutProfile.ChallengeIds);
+		MakeIds(Stream, Size.NumIds, OutProfile.ComplexDependencyLookup);
+		return OutProfile;
+	}
+
+	static FAVVMPlayerPreset MakePreset(FRandomStream& Stream)
+	{
+		// @gdemers bounded by equipment slots, not by account age. same shape at every size.
+		FAVVMPlayerPreset OutPreset;
+		OutPreset.UniqueId = RandId(Stream);
+		OutPreset.PresetId = FString::Printf(TEXT("Preset_%d"), OutPreset.UniqueId);
+		OutPreset.EquippedItems = TMap<FGameplayTag, int32>{
+				{TAG_AVVMONLINE_BENCHMARK_HEAD, RandId(Stream)},
+				{TAG_AVVMONLINE_BENCHMARK_TORSO, RandId(Stream)},
+				{TAG_AVVMONLINE_BENCHMARK_PRIMARY, RandId(Stream)},
+				{TAG_AVVMONLINE_BENCHMARK_SECONDARY, RandId(Stream)}
+		};
+
+		return OutPreset;
+	}
+
+	static TArray<FAVVMParty> MakeParties(FRandomStream& Stream, const FBenchmarkSize& Size)
+	{
+		TArray<FAVVMParty> OutParties;
+		OutParties.Reserve(Size.NumEntries);
+
+		for (int32 i = 0; i < Size.NumEntries; ++i)
+		{
+			FAVVMParty& Party = OutParties.AddDefaulted_GetRef();
+			Party.UniqueId = RandId(Stream);
+			Party.PartyId = FString::Printf(TEXT("Party_%d"), Party.UniqueId);
+			Party.RegionId = Stream.RandHelper(16);
+			Party.DistrictId = Stream.RandHelper(64);
+			Party.HostConfigurationId = RandId(Stream);
+			MakeIds(Stream, 1 + Stream.RandHelper(4), Party.PlayerConnectionIds);
+		}
+
+		return OutParties;
+	}
+
+	static TArray<FAVVMPlayerChallenge> MakeChallenges(FRandomStream& Stream, const FBenchmarkSize& Size)
+	{
+		TArray<FAVVMPlayerChallenge> OutChallenges;
+		OutChallenges.Reserve(Size.NumEntries);
+
+		for (int32 i = 0; i < Size.NumEntries; ++i)
+		{
+			FAVVMPlayerChallenge& Challenge = OutChallenges.AddDefaulted_GetRef();
+			Challenge.UniqueId = RandId(Stream);
+			Challenge.ChallengeId = FString::Printf(TEXT("Challenge_%d"), Challenge.UniqueId);
+		}
+
+		return OutChallenges;
+	}
+
+	template<typename T>
+	static void JsonDecode(const UAVVMOnlinePlayerStringParser& Parser, const FString& NewPayload, T& OutValue)
+	{
+		Parser.FromString(NewPayload, OutValue);
+	}
+
+	template<typename T>
+	static void JsonDecode(const UAVVMOnlinePlayerStringParser& Parser, const FString& NewPayload, TArray<T>& OutValues)
+	{
+		Parser.FromString(FAVVMStringPayload{NewPayload}, OutValues);
+	}
+
+	template<typename T>
+	static void Encode(const ECodec Codec, const UAVVMOnlinePlayerStringParser& Parser, const T& Value, FEncodedPayload& OutPayload)
+	{
+		switch (Codec)
+		{
+		case ECodec::Json:
+			Parser.ToString(Value, OutPayload.String);
+			break;
+		case ECodec::JsonStream:
+			{
+				Parser.ToString(Value, OutPayload.String);
+
+				const FTCHARToUTF8 Converted(*OutPayload.String, OutPayload.String.Len());
+				OutPayload.Bytes.Reset();
+				OutPayload.Bytes.Append(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+				break;
+			}
+		case ECodec::Binary:
+			FAVVMOnlinePlayerBinaryCodec::ToBinary(Value, OutPayload.Bytes);
+			break;
+		default:
+			break;
+		}
+	}
+
+	// @gdemers the DOM decoder can't report failure. return true, and let the caller compare outputs.
+	template<typename T>
+	static bool Decode(const ECodec Codec, const UAVVMOnlinePlayerStringParser& Parser, const FEncodedPayload& NewPayload, T& OutValue)
+	{
+		switch (Codec)
+		{
+		case ECodec::Json:
+			JsonDecode(Parser, NewPayload.String, OutValue);
+			return true;
+		case ECodec::JsonStream:
+			return Parser.FromUTF8(NewPayload.Bytes, OutValue);
+		case ECodec::Binary:
+			return FAVVMOnlinePlayerBinaryCodec::FromBinary(NewPayload.Bytes, OutValue);
+		default:
+			return false;
+		}
+	}
+
+	static int32 GetNumBytes(const ECodec Codec, const FEncodedPayload& NewPayload)
+	{
+		if (Codec == ECodec::Json)
+		{
+			return FTCHARToUTF8(*NewPayload.String, NewPayload.String.Len()).Length();
+		}
+
+		return NewPayload.Bytes.Num();
+	}
+
+	template<typename T>
+	static FBenchmarkResult Run(const TCHAR* Name,
+	                            const FBenchmarkSize& Size,
+	                            const ECodec Codec,
+	                            const UAVVMOnlinePlayerStringParser& Parser,
+	                            const T& Value,
+	                            bool& bOutIsRoundTripValid)
+	{
+		FEncodedPayload Payload;
+		for (int32 i = 0; i < NumWarmupIterations; ++i)
+		{
+			T Decoded;
+			Encode(Codec, Parser, Value, Payload);
+			Decode(Codec, Parser, Payload, Decoded);
+		}
+
+		{
+			T Decoded;
+			bOutIsRoundTripValid = Decode(Codec, Parser, Payload, Decoded) && (Decoded == Value);
+		}
+
+		// @gdemers encode reuse the output buffers, as a backend connection would. decode always fill a new struct.
+		const double EncodeBegin = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Size.NumIterations; ++i)
+		{
+			Encode(Codec, Parser, Value, Payload);
+		}
+
+		const double EncodeSeconds = (FPlatformTime::Seconds() - EncodeBegin);
+
+		const double DecodeBegin = FPlatformTime::Seconds();
+		for (int32 i = 0; i < Size.NumIterations; ++i)
+		{
+			T Decoded;
+			Decode(Codec, Parser, Payload, Decoded);
+		}
+
+		const double DecodeSeconds = (FPlatformTime::Seconds() - DecodeBegin);
+
+		FBenchmarkResult OutResult;
+		OutResult.Name = Name;
+		OutResult.Size = Size.Name;
+		OutResult.Codec = GetCodecName(Codec);
+		OutResult.NumBytes = GetNumBytes(Codec, Payload);
+		OutResult.EncodeMeanUs = (EncodeSeconds * 1e6 / Size.NumIterations);
+		OutResult.DecodeMeanUs = (DecodeSeconds * 1e6 / Size.NumIterations);
+		OutResult.DecodeMBps = (DecodeSeconds > 0.0) ? (static_cast<double>(OutResult.NumBytes) * Size.NumIterations / DecodeSeconds / (1024.0 * 1024.0)) : 0.0;
+
+		// @gdemers counted apart from the timed loops. cold buffers, so every allocation a fresh request pays is included.
+		{
+			FEncodedPayload Counted;
+			FAVVMOnlineScopedAllocationCounter Counter;
+			Encode(Codec, Parser, Value, Counted);
+			OutResult.EncodeAllocations = Counter.GetNumAllocations();
+		}
+
+		{
+			T Counted;
+			FAVVMOnlineScopedAllocationCounter Counter;
+			Decode(Codec, Parser, Payload, Counted);
+			OutResult.DecodeAllocations = Counter.GetNumAllocations();
+		}
+
+		return OutResult;
+	}
+
+	static void Mutate(FRandomStream& Stream, TArray<uint8>& OutBytes)
+	{
+		if (OutBytes.IsEmpty())
+		{
+			OutBytes.Add(static_cast<uint8>(Stream.RandHelper(256)));
+			return;
+		}
+
+		// @gdemers structural tokens, and varint continuation bits, reach deeper into decoders than random bytes do.
+		static constexpr uint8 Tokens[] = {'{', '}', '[', ']', '"', ',', ':', '\\', '-', '.', 'e', '0', 0x80, 0xFF};
+
+		const int32 Index = Stream.RandHelper(OutBytes.Num());
+		switch (Stream.RandHelper(5))
+		{
+		case 0:
+			OutBytes[Index] = static_cast<uint8>(Stream.RandHelper(256));
+			break;
+		case 1:
+			OutBytes[Index] ^= static_cast<uint8>(1 << Stream.RandHelper(8));
+			break;
+		case 2:
+			OutBytes[Index] = Tokens[Stream.RandHelper(UE_ARRAY_COUNT(Tokens))];
+			break;
+		case 3:
+			OutBytes.Insert(Tokens[Stream.RandHelper(UE_ARRAY_COUNT(Tokens))], Index);
+			break;
+		default:
+			OutBytes.RemoveAt(Index);
+			break;
+		}
+	}
+
+	struct FFuzzResult
+	{
+		int32 NumTruncations = 0;
+		int32 NumTruncationsAccepted = 0;
+		int32 NumMutationsAccepted = 0;
+		/*Failed decode that still modified their output*/
+		int32 NumOutputsModified = 0;
+	};
+
+	template<typename T>
+	static FFuzzResult Fuzz(const ECodec Codec,
+	                        const UAVVMOnlinePlayerStringParser& Parser,
+	                        const T& Value,
+	                        FRandomStream& Stream)
+	{
+		FEncodedPayload Source;
+		Encode(Codec, Parser, Value, Source);
+
+		FFuzzResult OutResult;
+
+		// @gdemers a JSON document is only complete once its closing token is read. trailing whitespace aside.
+		int32 NumRequiredBytes = Source.Bytes.Num();
+		while (Codec == ECodec::JsonStream && NumRequiredBytes > 0 && FChar::IsWhitespace(static_cast<TCHAR>(Source.Bytes[NumRequiredBytes - 1])))
+		{
+			--NumRequiredBytes;
+		}
+
+		const int32 Step = FMath::Max(1, Source.Bytes.Num() / MaxTruncationsPerPayload);
+		for (int32 Length = 0; Length < NumRequiredBytes; Length += Step)
+		{
+			FEncodedPayload Truncated;
+			Truncated.Bytes = TArray<uint8>(Source.Bytes.GetData(), Length);
+
+			T Decoded = Value;
+			++OutResult.NumTruncations;
+
+			if (Decode(Codec, Parser, Truncated, Decoded))
+			{
+				++OutResult.NumTruncationsAccepted;
+			}
+			else if (!(Decoded == Value))
+			{
+				++OutResult.NumOutputsModified;
+			}
+		}
+
+		for (int32 i = 0; i < NumMutations; ++i)
+		{
+			FEncodedPayload Mutated;
+			Mutated.Bytes = Source.Bytes;
+
+			const int32 NumEdits = (1 + Stream.RandHelper(4));
+			for (int32 j = 0; j < NumEdits; ++j)
+			{
+				Mutate(Stream, Mutated.Bytes);
+			}
+
+			T Decoded = Value;
+			if (Decode(Codec, Parser, Mutated, Decoded))
+			{
+				// @gdemers edits within a string, or a number, can produce another valid document.
+				++OutResult.NumMutationsAccepted;
+			}
+			else if (!(Decoded == Value))
+			{
+				++OutResult.NumOutputsModified;
+			}
+		}
+
+		return OutResult;
+	}
+}
+#endif
+
+/**
+ *	Class description:
+ *
+ *	AVVMOnlineSerializationBenchmark is an Automated Test comparing the JSON, streaming JSON, and binary codecs, over synthetic backend
+ *	payloads of realistic, and extreme, sizes. Reports wire size, encode and decode time, and allocations per round-trip. Results are
+ *	written as csv to the automation directory (i.e - Saved/Automation/), and logged. Timings are reported only, size and allocation
+ *	counts are deterministic and gated. Allocations are counted through a proxy installed over GMalloc, see FAVVMOnlineAllocationCounter.
+ *	Run headless with : -ExecCmds="Automation RunTests AutomatedTest.CustomGroup.AVVMOnlineSerializationBenchmark;Quit" -nullrhi -unattended
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMOnlineSerializationBenchmark, "AutomatedTest.CustomGroup.AVVMOnlineSerializationBenchmark", EAutomationTestFlags::EditorContext | EAutomationTestFlags::PerfFilter)
+bool AVVMOnlineSerializationBenchmark::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	using namespace NSAVVMOnlineSerializationBenchmark;
+
+	const UAVVMOnlinePlayerStringParser* Parser = FAVVMOnlineModule::GetJsonParser_Player();
+	UTEST_NOT_NULL("UAVVMOnlineStringParser", Parser);
+
+	if (!FAVVMOnlineScopedAllocationCounter::IsSupported())
+	{
+		AddWarning(TEXT("FMemory isn't routed through the allocation counter on this platform, or process. Allocations are reported as -1, and not gated."));
+	}
+
+	TArray<FString> CsvRows;
+	CsvRows.Add(FBenchmarkResult::GetCsvHeader());
+
+	const auto RunCodecs = [&](const TCHAR* Name, const FBenchmarkSize& Size, const auto& Value)
+	{
+		TMap<ECodec, FBenchmarkResult> Results;
+		for (const ECodec Codec : Codecs)
+		{
+			bool bIsRoundTripValid = false;
+			const FBenchmarkResult& Result = Results.Add(Codec, Run(Name, Size, Codec, *Parser, Value, bIsRoundTripValid));
+			TestTrue(FString::Printf(TEXT("%s %s round-trip {%s}."), Name, GetCodecName(Codec), Size.Name), bIsRoundTripValid);
+
+			const FString CsvRow = Result.ToCsvRow();
+			AddInfo(CsvRow);
+			CsvRows.Add(CsvRow);
+		}
+
+		// @gdemers regression gates. a codec change that loses on these is a format, or decoder, regression.
+		const FBenchmarkResult& Json = Results.FindChecked(ECodec::Json);
+		const FBenchmarkResult& JsonStream = Results.FindChecked(ECodec::JsonStream);
+		const FBenchmarkResult& Binary = Results.FindChecked(ECodec::Binary);
+
+		TestTrue(FString::Printf(TEXT("%s Binary smaller than Json {%s}."), Name, Size.Name), Binary.NumBytes < Json.NumBytes);
+
+		if (FAVVMOnlineScopedAllocationCounter::IsSupported())
+		{
+			TestTrue(FString::Printf(TEXT("%s JsonStream decode allocations within Json {%s}."), Name, Size.Name), JsonStream.DecodeAllocations <= Json.DecodeAllocations);
+			TestTrue(FString::Printf(TEXT("%s Binary decode allocations within JsonStream {%s}."), Name, Size.Name), Binary.DecodeAllocations <= JsonStream.DecodeAllocations);
+		}
+	};
+
+	for (const FBenchmarkSize& Size : Sizes)
+	{
+		FRandomStream Stream(RandomSeed);
+		RunCodecs(TEXT("FAVVMPlayerProfile"), Size, MakeProfile(Stream, Size));
+		RunCodecs(TEXT("FAVVMPlayerPreset"), Size, MakePreset(Stream));
+		RunCodecs(TEXT("TArray<FAVVMParty>"), Size, MakeParties(Stream, Size));
+		RunCodecs(TEXT("TArray<FAVVMPlayerChallenge>"), Size, MakeChallenges(Stream, Size));
+	}
+
+	const FString CsvPath = FPaths::Combine(FPaths::AutomationDir(), TEXT("AVVMOnlineSerializationBenchmark.csv"));
+	TestTrue(FString::Printf(TEXT("Write %s."), *CsvPath), FFileHelper::SaveStringArrayToFile(CsvRows, *CsvPath));
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMOnlineSerializationFuzz is an Automated Test feeding truncated, and mutated, payloads to the decoders that report failure (i.e -
+ *	streaming JSON, and binary). Truncated payloads must be rejected, and a rejected payload must leave the output untouched.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMOnlineSerializationFuzz, "AutomatedTest.CustomGroup.AVVMOnlineSerializationFuzz", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool AVVMOnlineSerializationFuzz::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	using namespace NSAVVMOnlineSerializationBenchmark;
+
+	const UAVVMOnlinePlayerStringParser* Parser = FAVVMOnlineModule::GetJsonParser_Player();
+	UTEST_NOT_NULL("UAVVMOnlineStringParser", Parser);
+
+	FRandomStream Stream(RandomSeed);
+
+	const auto FuzzCodecs = [&](const TCHAR* Name, const auto& Value)
+	{
+		for (const ECodec Codec : {ECodec::JsonStream, ECodec::Binary})
+		{
+			const FFuzzResult Result = Fuzz(Codec, *Parser, Value, Stream);
+
+			TestEqual(FString::Printf(TEXT("%s %s truncations accepted."), Name, GetCodecName(Codec)), Result.NumTruncationsAccepted, 0);
+			TestEqual(FString::Printf(TEXT("%s %s outputs modified on failure."), Name, GetCodecName(Codec)), Result.NumOutputsModified, 0);
+
+			AddInfo(FString::Printf(TEXT("%s %s : %d truncations, %d/%d mutations accepted."),
+			                        Name,
+			                        GetCodecName(Codec),
+			                        Result.NumTruncations,
+			                        Result.NumMutationsAccepted,
+			                        NumMutations));
+		}
+	};
+
+	const FBenchmarkSize& Size = Sizes[0];
+	FuzzCodecs(TEXT("FAVVMPlayerProfile"), MakeProfile(Stream, Size));
+	FuzzCodecs(TEXT("FAVVMPlayerPreset"), MakePreset(Stream));
+	FuzzCodecs(TEXT("TArray<FAVVMParty>"), MakeParties(Stream, Size));
+	FuzzCodecs(TEXT("TArray<FAVVMPlayerChallenge>"), MakeChallenges(Stream, Size));
+#endif
+	return true;
+}
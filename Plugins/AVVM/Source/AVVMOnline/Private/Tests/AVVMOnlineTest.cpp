@@ -22,6 +22,8 @@
 
 #include "AVVMOnlineModule.h"
 #include "AVVMOnlineInterface.h"
+#include "AVVMOnlineJsonStreamReader.h"
+#include "AVVMOnlinePlayerBinaryCodec.h"
 #include "AVVMOnlinePlayerStringParser.h"
 #include "NativeGameplayTags.h"
 #include "Backend/AVVMOnlinePlayer.h"
@@ -391,3 +393,298 @@ bool AVVMOnlineTest::RunTest(const FString& Parameters)
 #endif
 	return true;
 }
+
+/**
+ *	Class description:
+ *
+ *	AVVMOnlineBinaryCodecTest is an Automated Test running validation on the binary codec. Round-trips, and rejection of malformed payloads.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMOnlineBinaryCodecTest, "AutomatedTest.CustomGroup.AVVMOnlineBinaryCodecTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool AVVMOnlineBinaryCodecTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	{
+		TArray<uint8> OutPayload;
+
+		FAVVMPlayerProfile A;
+		A.UniqueId = FMath::Rand32();
+		A.ProfileId = TEXT("Secret\u00e9");
+		A.InventoryIds = {FMath::Rand32(), INDEX_NONE, 0, MAX_int32, MIN_int32};
+		A.SkinIds = {FMath::Rand32(), FMath::Rand32()};
+		A.CharmsIds = {};
+		A.SkillIds = {FMath::Rand32(), FMath::Rand32()};
+		A.ChallengeIds = {FMath::Rand32(), FMath::Rand32()};
+		A.ComplexDependencyLookup = {FMath::Rand32(), FMath::Rand32()};
+		A.EquippedPresetId = INDEX_NONE;
+		FAVVMOnlinePlayerBinaryCodec::ToBinary(A, OutPayload);
+
+		FAVVMPlayerProfile B;
+		UTEST_TRUE("FAVVMPlayerProfile decoded", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, B));
+		UTEST_EQUAL("FAVVMPlayerProfile", A, B);
+
+		// @gdemers truncated payloads, and trailing bytes, are rejected without modifying the output.
+		for (int32 Length = 0; Length < OutPayload.Num(); ++Length)
+		{
+			FAVVMPlayerProfile C = A;
+			UTEST_FALSE("FAVVMPlayerProfile truncated", FAVVMOnlinePlayerBinaryCodec::FromBinary(TArrayView<const uint8>(OutPayload.GetData(), Length), C));
+			UTEST_EQUAL("FAVVMPlayerProfile untouched", A, C);
+		}
+
+		OutPayload.Add(0);
+		UTEST_FALSE("FAVVMPlayerProfile trailing", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, B));
+
+		// @gdemers a payload can't be decoded as another type.
+		FAVVMPlayerPreset D;
+		UTEST_FALSE("FAVVMPlayerProfile as FAVVMPlayerPreset", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, D));
+	}
+
+	{
+		TArray<uint8> OutPayload;
+
+		FAVVMPlayerPreset A;
+		A.UniqueId = FMath::Rand32();
+		A.PresetId = TEXT("MyPreset");
+
+		A.EquippedItems = TMap<FGameplayTag, int32>{
+				{TAG_AVVMONLINE_TEST_A, FMath::Rand32()},
+				{TAG_AVVMONLINE_TEST_B, FMath::Rand32()}
+		};
+
+		FAVVMOnlinePlayerBinaryCodec::ToBinary(A, OutPayload);
+
+		FAVVMPlayerPreset B;
+		UTEST_TRUE("FAVVMPlayerPreset decoded", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, B));
+		UTEST_EQUAL("FAVVMPlayerPreset", A, B);
+
+		// @gdemers a slot tag that isn't registered is rejected. same length, so only the tag name differ.
+		const FString SlotName = TAG_AVVMONLINE_TEST_A.GetTag().ToString();
+		const FTCHARToUTF8 SlotNameUTF8(*SlotName, SlotName.Len());
+		bool bHasReplacedSlotName = false;
+		for (int32 i = 0; i + SlotNameUTF8.Length() <= OutPayload.Num(); ++i)
+		{
+			if (FMemory::Memcmp(OutPayload.GetData() + i, SlotNameUTF8.Get(), SlotNameUTF8.Length()) == 0)
+			{
+				OutPayload[i + SlotNameUTF8.Length() - 1] = static_cast<uint8>('Z');
+				bHasReplacedSlotName = true;
+				break;
+			}
+		}
+
+		FAVVMPlayerPreset C = A;
+		UTEST_TRUE("FAVVMPlayerPreset slot name found", bHasReplacedSlotName);
+		UTEST_FALSE("FAVVMPlayerPreset unknown slot", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, C));
+		UTEST_EQUAL("FAVVMPlayerPreset untouched", A, C);
+	}
+
+	{
+		FAVVMParty Party1;
+		Party1.UniqueId = FMath::Rand32();
+		Party1.PartyId = TEXT("SecretParty1");
+		Party1.RegionId = FMath::Rand32();
+		Party1.DistrictId = FMath::Rand32();
+		Party1.HostConfigurationId = FMath::Rand32();
+		Party1.PlayerConnectionIds = {FMath::Rand32(), FMath::Rand32()};
+
+		FAVVMParty Party2;
+		Party2.UniqueId = FMath::Rand32();
+		Party2.PartyId = TEXT("SecretParty2");
+		Party2.PlayerConnectionIds = {FMath::Rand32()};
+
+		TArray<uint8> OutPayload;
+
+		TArray<FAVVMParty> A = {Party1, Party2};
+		FAVVMOnlinePlayerBinaryCodec::ToBinary(A, OutPayload);
+
+		TArray<FAVVMParty> B;
+		UTEST_TRUE("TArray<FAVVMParty> decoded", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, B));
+		UTEST_EQUAL("TArray<FAVVMParty>", A, B);
+	}
+
+	{
+		FAVVMPlayerConnection PlayerConnection1;
+		PlayerConnection1.UniqueId = FMath::Rand32();
+		PlayerConnection1.UniqueNetId = TEXT("MyUniqueNetId1");
+		PlayerConnection1.PlayerStatus = EAVVMPlayerStatus::Ready;
+		PlayerConnection1.ProfileId = FMath::Rand32();
+
+		FAVVMPlayerConnection PlayerConnection2;
+		PlayerConnection2.UniqueId = FMath::Rand32();
+		PlayerConnection2.UniqueNetId = TEXT("MyUniqueNetId2");
+		PlayerConnection2.PlayerStatus = EAVVMPlayerStatus::PendingAction;
+		PlayerConnection2.ProfileId = FMath::Rand32();
+
+		TArray<uint8> OutPayload;
+
+		TArray<FAVVMPlayerConnection> A = {PlayerConnection1, PlayerConnection2};
+		FAVVMOnlinePlayerBinaryCodec::ToBinary(A, OutPayload);
+
+		TArray<FAVVMPlayerConnection> B;
+		UTEST_TRUE("TArray<FAVVMPlayerConnection> decoded", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, B));
+		UTEST_EQUAL("TArray<FAVVMPlayerConnection>", A, B);
+	}
+
+	{
+		// @gdemers header, INDEX_NONE, and an empty string, fit in a byte each.
+		FAVVMPlayerResource A;
+		A.UniqueId = INDEX_NONE;
+
+		TArray<uint8> OutPayload;
+		FAVVMOnlinePlayerBinaryCodec::ToBinary(A, OutPayload);
+		UTEST_EQUAL("FAVVMPlayerResource size", OutPayload.Num(), 5);
+
+		FAVVMPlayerResource B;
+		UTEST_TRUE("FAVVMPlayerResource decoded", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, B));
+		UTEST_EQUAL("FAVVMPlayerResource", A, B);
+
+		// @gdemers payloads from a newer schema version are rejected.
+		OutPayload[2] = (FAVVMOnlinePlayerBinaryCodec::CurrentVersion + 1);
+		UTEST_FALSE("FAVVMPlayerResource version", FAVVMOnlinePlayerBinaryCodec::FromBinary(OutPayload, B));
+	}
+
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	AVVMOnlineJsonStreamTest is an Automated Test running validation on the streaming JSON decoder. Parity with the DOM encoder, escapes,
+ *	and rejection of malformed payloads.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(AVVMOnlineJsonStreamTest, "AutomatedTest.CustomGroup.AVVMOnlineJsonStreamTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+
+bool AVVMOnlineJsonStreamTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	const UAVVMOnlinePlayerStringParser* Parser = FAVVMOnlineModule::GetJsonParser_Player();
+	UTEST_NOT_NULL("UAVVMOnlineStringParser", Parser);
+
+	const auto ToUTF8 = [](const FString& NewPayload)
+	{
+		const FTCHARToUTF8 Converted(*NewPayload, NewPayload.Len());
+		return TArray<uint8>(reinterpret_cast<const uint8*>(Converted.Get()), Converted.Length());
+	};
+
+	{
+		FAVVMPlayerProfile A;
+		A.UniqueId = FMath::Rand32();
+		A.ProfileId = TEXT("Secret\u00e9 \"Quoted\"\t\\");
+		A.InventoryIds = {FMath::Rand32(), INDEX_NONE, 0, MAX_int32, MIN_int32};
+		A.SkinIds = {FMath::Rand32(), FMath::Rand32()};
+		A.CharmsIds = {};
+		A.SkillIds = {FMath::Rand32(), FMath::Rand32()};
+		A.ChallengeIds = {FMath::Rand32(), FMath::Rand32()};
+		A.ComplexDependencyLookup = {FMath::Rand32(), FMath::Rand32()};
+		A.EquippedPresetId = INDEX_NONE;
+
+		FString OutPayload;
+		Parser->ToString(A, OutPayload);
+
+		const TArray<uint8> Bytes = ToUTF8(OutPayload);
+
+		FAVVMPlayerProfile B;
+		UTEST_TRUE("FAVVMPlayerProfile decoded", Parser->FromUTF8(Bytes, B));
+		UTEST_EQUAL("FAVVMPlayerProfile", A, B);
+
+		// @gdemers truncated payloads are rejected without modifying the output.
+		for (int32 Length = 0; Length < Bytes.Num(); ++Length)
+		{
+			FAVVMPlayerProfile C = A;
+			UTEST_FALSE("FAVVMPlayerProfile truncated", Parser->FromUTF8(TArrayView<const uint8>(Bytes.GetData(), Length), C));
+			UTEST_EQUAL("FAVVMPlayerProfile untouched", A, C);
+		}
+	}
+
+	{
+		FAVVMPlayerPreset A;
+		A.UniqueId = FMath::Rand32();
+		A.PresetId = TEXT("MyPreset");
+
+		A.EquippedItems = TMap<FGameplayTag, int32>{
+				{TAG_AVVMONLINE_TEST_A, FMath::Rand32()},
+				{TAG_AVVMONLINE_TEST_B, FMath::Rand32()}
+		};
+
+		FString OutPayload;
+		Parser->ToString(A, OutPayload);
+
+		FAVVMPlayerPreset B;
+		UTEST_TRUE("FAVVMPlayerPreset decoded", Parser->FromUTF8(ToUTF8(OutPayload), B));
+		UTEST_EQUAL("FAVVMPlayerPreset", A, B);
+
+		// @gdemers a slot tag that isn't registered is rejected.
+		const FString SlotName = TAG_AVVMONLINE_TEST_A.GetTag().ToString();
+		const FString UnknownSlotPayload = OutPayload.Replace(*SlotName, TEXT("AVVMOnline.AutomatedTest.Unknown"));
+
+		FAVVMPlayerPreset C = A;
+		UTEST_FALSE("FAVVMPlayerPreset unknown slot", Parser->FromUTF8(ToUTF8(UnknownSlotPayload), C));
+		UTEST_EQUAL("FAVVMPlayerPreset untouched", A, C);
+
+		// @gdemers the DOM parser agree with the streaming one.
+		Parser->FromString(UnknownSlotPayload, C);
+		UTEST_EQUAL("FAVVMPlayerPreset untouched {FromString}", A, C);
+	}
+
+	{
+		FAVVMParty Party1;
+		Party1.UniqueId = FMath::Rand32();
+		Party1.PartyId = TEXT("Secret \"Party\" \U0001F389");
+		Party1.RegionId = FMath::Rand32();
+		Party1.DistrictId = FMath::Rand32();
+		Party1.HostConfigurationId = FMath::Rand32();
+		Party1.PlayerConnectionIds = {FMath::Rand32(), FMath::Rand32()};
+
+		FAVVMParty Party2;
+		Party2.UniqueId = FMath::Rand32();
+		Party2.PartyId = TEXT("SecretParty2");
+		Party2.PlayerConnectionIds = {FMath::Rand32()};
+
+		FString OutPayload;
+
+		TArray<FAVVMParty> A = {Party1, Party2};
+		Parser->ToString(A, OutPayload);
+
+		TArray<FAVVMParty> B;
+		UTEST_TRUE("TArray<FAVVMParty> decoded", Parser->FromUTF8(ToUTF8(OutPayload), B));
+		UTEST_EQUAL("TArray<FAVVMParty>", A, B);
+
+		// @gdemers a collection missing its closing tokens is rejected as a whole.
+		TArray<FAVVMParty> C;
+		UTEST_FALSE("TArray<FAVVMParty> truncated", Parser->FromUTF8(ToUTF8(OutPayload.LeftChop(2)), C));
+		UTEST_EQUAL("TArray<FAVVMParty> untouched", C.Num(), 0);
+	}
+
+	{
+		// @gdemers unknown fields, of any shape, are skipped. numbers with a fraction are rounded.
+		const FString Payload = TEXT(" { \"Extra\" : [ {\"a\": [1, 2.5e1, null]}, true, false, \"\\u00e9\" ], \"UniqueId\" : 4.0 , \"ResourceId\":\"Gold\\/Coin\\u00e9\" } ");
+
+		FAVVMPlayerResource A;
+		UTEST_TRUE("FAVVMPlayerResource decoded", Parser->FromUTF8(ToUTF8(Payload), A));
+		UTEST_EQUAL("FAVVMPlayerResource UniqueId", A.UniqueId, 4);
+		UTEST_EQUAL("FAVVMPlayerResource ResourceId", A.ResourceId, FString(TEXT("Gold/Coin\u00e9")));
+
+		// @gdemers malformed documents.
+		const TArray<FString> Payloads = {
+			TEXT(""),
+			TEXT("{\"UniqueId\":1,}"),
+			TEXT("{\"UniqueId\":1 \"ResourceId\":\"A\"}"),
+			TEXT("{\"UniqueId\":2147483648}"),
+			TEXT("{\"UniqueId\":-}"),
+			TEXT("{\"ResourceId\":\"\\x\"}"),
+			TEXT("{\"ResourceId\":\"\\ud800\"}"),
+			TEXT("{\"UniqueId\":1}{"),
+			// @gdemers nesting past FAVVMOnlineJsonStreamReader::MaxDepth.
+			TEXT("{\"Extra\":") + FString::ChrN(FAVVMOnlineJsonStreamReader::MaxDepth, TEXT('[')) + FString::ChrN(FAVVMOnlineJsonStreamReader::MaxDepth, TEXT(']')) + TEXT("}")
+		};
+
+		for (const FString& Malformed : Payloads)
+		{
+			FAVVMPlayerResource B;
+			UTEST_FALSE(*FString::Printf(TEXT("FAVVMPlayerResource %s"), *Malformed), Parser->FromUTF8(ToUTF8(Malformed), B));
+		}
+	}
+
+#endif
+	return true;
+}
@@ -0,0 +1,93 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ *	Class description:
+ *
+ *	FAVVMOnlineJsonStreamReader is a pull tokenizer over a view of UTF-8 JSON bytes. Callers walk the document, and fill their
+ *	fields as tokens are read. No DOM is built, keys are compared in place, and strings are only converted when assigned to a field.
+ *	Malformed input latch an error, every following read fail. Callers only check HasError, or ReadEnd, once decoding is done.
+ *
+ *	Usage :
+ *		Reader.ReadObjectStart();
+ *		while (Reader.ReadNextKey(Key)) { if (MatchesKey(Key, "UniqueId")) Reader.ReadInt32(Value); else Reader.SkipValue(); }
+ */
+class AVVMONLINE_API FAVVMOnlineJsonStreamReader
+{
+public:
+	// @gdemers nesting limit. bound recursion in SkipValue on hostile payloads.
+	static constexpr int32 MaxDepth = 64;
+
+	explicit FAVVMOnlineJsonStreamReader(TArrayView<const uint8> NewData);
+
+	bool ReadObjectStart();
+	bool ReadArrayStart();
+
+	// @gdemers return false once the closing token is consumed, or on error. OutKey is a view in the payload, escapes are left as is.
+	bool ReadNextKey(TArrayView<const uint8>& OutKey);
+	bool ReadNextElement();
+
+	bool ReadInt32(int32& OutValue);
+	bool ReadString(FString& OutValue);
+	bool ReadInt32Array(TArray<int32>& OutValues);
+
+	// @gdemers unescaped UTF-8 bytes, used for JSON documents nested in a string value. OutValue can be reused between calls.
+	bool ReadStringBytes(TArray<uint8>& OutValue);
+
+	bool SkipValue();
+
+	// @gdemers true if the document was fully consumed, trailing whitespace aside, without error.
+	bool ReadEnd();
+
+	void SetError() { bHasError = true; }
+	bool HasError() const { return bHasError; }
+
+	// @gdemers case insensitive, to match FJsonObject field lookup.
+	template<int32 N>
+	static bool MatchesKey(TArrayView<const uint8> Key, const ANSICHAR (&Literal)[N])
+	{
+		return (Key.Num() == (N - 1))
+			&& (FCStringAnsi::Strnicmp(reinterpret_cast<const ANSICHAR*>(Key.GetData()), Literal, N - 1) == 0);
+	}
+
+private:
+	void SkipWhitespace();
+	bool Consume(const uint8 Token);
+	bool Peek(const uint8 Token) const;
+	bool PushContainer();
+	bool PopContainer(const uint8 Token);
+	bool ScanString(int32& OutStart, int32& OutEnd, bool& bOutHasEscapes);
+	bool ScanNumber(int32& OutStart, int32& OutEnd, bool& bOutIsInteger);
+	bool ScanLiteral(const ANSICHAR* Literal);
+	bool ReadHex4(const int32 Start, const int32 End, uint32& OutValue) const;
+	bool Unescape(const int32 Start, const int32 End, TArray<uint8>& OutValue);
+
+	TArrayView<const uint8> Data;
+	int32 Offset = 0;
+	int32 Depth = 0;
+	// @gdemers one bit per nesting level. set until the first entry of the container is read, so separators can be validated.
+	uint64 FirstEntryMask = 0;
+	// @gdemers scratch for escaped field values. reused across reads.
+	TArray<uint8> EscapeBuffer;
+	bool bHasError = false;
+};
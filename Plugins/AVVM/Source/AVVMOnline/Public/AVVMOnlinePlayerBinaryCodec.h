@@ -0,0 +1,174 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FAVVMCurrency;
+struct FAVVMHostConfiguration;
+struct FAVVMParty;
+struct FAVVMPlayerAccount;
+struct FAVVMPlayerChallenge;
+struct FAVVMPlayerConnection;
+struct FAVVMPlayerLoginContext;
+struct FAVVMPlayerPreset;
+struct FAVVMPlayerProfile;
+struct FAVVMPlayerResource;
+struct FAVVMPlayerWallet;
+
+/**
+ *	Class description:
+ *
+ *	EAVVMOnlineBinaryType identify the schema encoded in a binary payload. Values are persisted, never reorder them.
+ */
+enum class EAVVMOnlineBinaryType : uint8
+{
+	None = 0,
+	PlayerLoginContext,
+	PlayerAccount,
+	PlayerWallet,
+	Currency,
+	PlayerProfile,
+	PlayerPreset,
+	PlayerResource,
+	PlayerResources,
+	PlayerChallenge,
+	PlayerChallenges,
+	Party,
+	Parties,
+	PlayerConnection,
+	PlayerConnections,
+	HostConfiguration
+};
+
+/**
+ *	Class description:
+ *
+ *	FAVVMOnlineBinaryWriter is an append-only encoder. Unsigned integers are LEB128 varints, signed integers are zigzag encoded
+ *	first so INDEX_NONE, and other small values, fit a single byte. Strings are length-prefixed UTF-8.
+ */
+class AVVMONLINE_API FAVVMOnlineBinaryWriter
+{
+public:
+	explicit FAVVMOnlineBinaryWriter(TArray<uint8>& NewBuffer);
+
+	void WriteByte(const uint8 Value);
+	void WriteVarUInt32(uint32 Value);
+	void WriteVarInt32(const int32 Value);
+	void WriteString(const FString& Value);
+	void WriteInt32Array(const TArray<int32>& Values);
+
+private:
+	TArray<uint8>& Buffer;
+};
+
+/**
+ *	Class description:
+ *
+ *	FAVVMOnlineBinaryReader is a zero-copy decoder over a view of a binary payload. Reading past the end, or a malformed varint,
+ *	latch an error and every following read return a default value. Callers only check HasError once decoding is done.
+ */
+class AVVMONLINE_API FAVVMOnlineBinaryReader
+{
+public:
+	explicit FAVVMOnlineBinaryReader(TArrayView<const uint8> NewData);
+
+	uint8 ReadByte();
+	uint32 ReadVarUInt32();
+	int32 ReadVarInt32();
+	FString ReadString();
+	void ReadInt32Array(TArray<int32>& OutValues);
+
+	// @gdemers element count, bounded by the remaining bytes. a corrupted count can't trigger a large allocation.
+	int32 ReadCount();
+
+	void SetError() { bHasError = true; }
+	bool HasError() const { return bHasError; }
+	bool IsAtEnd() const { return (Offset == Data.Num()); }
+
+private:
+	TArrayView<const uint8> Data;
+	int32 Offset = 0;
+	bool bHasError = false;
+};
+
+/**
+ *	Class description:
+ *
+ *	FAVVMOnlinePlayerBinaryCodec is a compact, versioned, binary alternative to UAVVMOnlinePlayerStringParser for the backend POD types.
+ *	Each payload starts with a header {Magic, EAVVMOnlineBinaryType, Version}, followed by fields in declaration order. Id lists are
+ *	varint packed.
+ *
+ *	Versioning : fields are only ever appended. Bump CurrentVersion when doing so, and read new fields conditionally on the decoded
+ *	version. Payloads from a newer version than the running build are rejected.
+ *
+ *	JSON remains the debug, and interop, format. See UAVVMOnlinePlayerStringParser.
+ */
+class AVVMONLINE_API FAVVMOnlinePlayerBinaryCodec
+{
+public:
+	static constexpr uint8 Magic = 0xA7;
+	static constexpr uint8 CurrentVersion = 1;
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerLoginContext& OutPlayerLoginContext);
+	static void ToBinary(const FAVVMPlayerLoginContext& NewPlayerLoginContext, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerAccount& OutPlayerAccount);
+	static void ToBinary(const FAVVMPlayerAccount& NewPlayerAccount, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerWallet& OutPlayerWallet);
+	static void ToBinary(const FAVVMPlayerWallet& NewPlayerWallet, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMCurrency& OutCurrency);
+	static void ToBinary(const FAVVMCurrency& NewCurrency, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerProfile& OutPlayerProfile);
+	static void ToBinary(const FAVVMPlayerProfile& NewPlayerProfile, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerPreset& OutPlayerPreset);
+	static void ToBinary(const FAVVMPlayerPreset& NewPlayerPreset, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerResource>& OutPlayerResources);
+	static void ToBinary(const TArray<FAVVMPlayerResource>& NewPlayerResources, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerResource& OutPlayerResource);
+	static void ToBinary(const FAVVMPlayerResource& NewPlayerResource, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerChallenge>& OutPlayerChallenges);
+	static void ToBinary(const TArray<FAVVMPlayerChallenge>& NewPlayerChallenges, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerChallenge& OutPlayerChallenge);
+	static void ToBinary(const FAVVMPlayerChallenge& NewPlayerChallenge, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMParty>& OutParties);
+	static void ToBinary(const TArray<FAVVMParty>& NewParties, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMParty& OutParty);
+	static void ToBinary(const FAVVMParty& NewParty, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerConnection>& OutPlayerConnections);
+	static void ToBinary(const TArray<FAVVMPlayerConnection>& NewPlayerConnections, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMPlayerConnection& OutPlayerConnection);
+	static void ToBinary(const FAVVMPlayerConnection& NewPlayerConnection, TArray<uint8>& OutFormat);
+
+	static bool FromBinary(TArrayView<const uint8> NewPayload, FAVVMHostConfiguration& OutHostConfiguration);
+	static void ToBinary(const FAVVMHostConfiguration& NewHostConfiguration, TArray<uint8>& OutFormat);
+};
@@ -50,6 +50,8 @@ struct FAVVMStringPayload;
  *
  *	UAVVMOnlinePlayerStringParser is the UObject interfacing with Unreal JSon system to parse the FString payload that defines
  *	the data schema of the project backend.
+ *
+ *	FromUTF8 overloads are the streaming path, used by the FAVVMStringPayload collections which are pulled in bulk on login.
  */
 UCLASS(BlueprintType, Blueprintable)
 class AVVMONLINE_API UAVVMOnlinePlayerStringParser : public UObject
@@ -128,4 +130,17 @@ public:
 
 	void FromString(const FString& NewPayload, FAVVMHostConfigurationProxy& OutHostConfigurationProxy) const;
 	void ToString(const FAVVMHostConfigurationProxy& NewHostConfigurationProxy, FString& OutFormat) const;
+
+	// @gdemers streaming decode over UTF-8 bytes, see FAVVMOnlineJsonStreamReader. fields are filled as tokens are read, without
+	// building a DOM. return false, and leave the output untouched, on malformed payloads.
+	bool FromUTF8(TArrayView<const uint8> NewPayload, FAVVMPlayerProfile& OutPlayerProfile) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, FAVVMPlayerPreset& OutPlayerPreset) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerResource>& OutPlayerResources) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, FAVVMPlayerResource& OutPlayerResource) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerChallenge>& OutPlayerChallenges) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, FAVVMPlayerChallenge& OutPlayerChallenge) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, TArray<FAVVMParty>& OutParties) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, FAVVMParty& OutParty) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, TArray<FAVVMPlayerConnection>& OutPlayerConnections) const;
+	bool FromUTF8(TArrayView<const uint8> NewPayload, FAVVMPlayerConnection& OutPlayerConnection) const;
 };
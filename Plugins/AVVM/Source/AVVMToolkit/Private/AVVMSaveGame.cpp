@@ -22,6 +22,7 @@
 #include "AVVMFileHelper.h"
 #include "AVVMLogger.h"
 #include "AVVMToolkitModule.h"
+#include "AVVMToolkitSettings.h"
 #include "AVVMToolkitUtils.h"
 #include "Kismet/GameplayStatics.h"
 
@@ -43,9 +44,43 @@ void UAVVMSaveGame::Static_Serialize(const FName PayloadType,
 	}
 }
 
+void UAVVMSaveGame::Static_SerializeDeferred(const FName PayloadType,
+                                             const TFunction<FString()>& SerializePayload)
+{
+	auto* SaveGame = UAVVMFileHelper::Static_GetSetSaveGame();
+	if (ensureAlwaysMsgf(IsValid(SaveGame), TEXT("Invalid SaveGame")))
+	{
+		SaveGame->SerializeDeferred(PayloadType, SerializePayload);
+	}
+}
+
+uint32 UAVVMSaveGame::Static_GetPayloadRevision(const FName PayloadType)
+{
+	const auto* SaveGame = UAVVMFileHelper::Static_GetSetSaveGame();
+	return ensureAlwaysMsgf(IsValid(SaveGame), TEXT("Invalid SaveGame")) ? SaveGame->GetPayloadRevision(PayloadType) : 0;
+}
+
+void UAVVMSaveGame::Static_Save()
+{
+	auto* SaveGame = UAVVMFileHelper::Static_GetSetSaveGame();
+	if (ensureAlwaysMsgf(IsValid(SaveGame), TEXT("Invalid SaveGame")))
+	{
+		SaveGame->Save();
+	}
+}
+
+void UAVVMSaveGame::BeginDestroy()
+{
+	FTSTicker::GetCoreTicker().RemoveTicker(ScheduledSaveHandle);
+	ScheduledSaveHandle.Reset();
+
+	Super::BeginDestroy();
+}
+
 void UAVVMSaveGame::HandlePreSave()
 {
 	Super::HandlePreSave();
+	FlushDeferredPayloads();
 	PrevPayloadPerType = CurrPayloadPerType;
 
 	const double Now = UAVVMToolkitUtils::GetServerWorldTime(this);
@@ -58,6 +93,13 @@ void UAVVMSaveGame::HandlePostLoad()
 	Super::HandlePostLoad();
 	CurrPayloadPerType = PrevPayloadPerType;
 
+	// @gdemers every payload was replaced. caches built from the previous content are stale.
+	DeferredPayloadPerType.Reset();
+	for (const auto& Pair : CurrPayloadPerType)
+	{
+		++RevisionPerType.FindOrAdd(Pair.Key);
+	}
+
 	const double Now = UAVVMToolkitUtils::GetServerWorldTime(this);
 	SessionStartTime = Now;
 }
@@ -72,10 +114,13 @@ FStringView UAVVMSaveGame::GetSetFileContent(const FName PayloadType,
                                              const TFunction<FString()>& GenerateDefaultContent,
                                              const bool bShouldDelete)
 {
+	FlushDeferredPayload(PayloadType);
+
 	FString& FileContent = CurrPayloadPerType.FindOrAdd(PayloadType);
 	if (FileContent.IsEmpty() || bShouldDelete)
 	{
 		FileContent = GenerateDefaultContent();
+		++RevisionPerType.FindOrAdd(PayloadType);
 		MarkFileDirty();
 	}
 
@@ -106,12 +151,101 @@ void UAVVMSaveGame::Serialize_v2(const FName PayloadType,
 		return;
 	}
 
+	// @gdemers an explicit payload override any pending deferred serialization.
+	DeferredPayloadPerType.Remove(PayloadType);
+	++RevisionPerType.FindOrAdd(PayloadType);
+
 	FString& OutResult = CurrPayloadPerType[PayloadType];
 	OutResult = NewPayload;
 	MarkFileDirty();
 }
 
+void UAVVMSaveGame::SerializeDeferred(const FName PayloadType,
+                                      const TFunction<FString()>& SerializePayload)
+{
+	const bool bDoesContains = CurrPayloadPerType.Contains(PayloadType);
+	if (!ensureAlwaysMsgf(bDoesContains, TEXT("Invalid Payload Type")))
+	{
+		return;
+	}
+
+	DeferredPayloadPerType.Add(PayloadType, SerializePayload);
+	MarkFileDirty();
+}
+
+uint32 UAVVMSaveGame::GetPayloadRevision(const FName PayloadType) const
+{
+	return RevisionPerType.FindRef(PayloadType);
+}
+
+void UAVVMSaveGame::FlushDeferredPayload(const FName PayloadType)
+{
+	TFunction<FString()> SerializePayload;
+	if (DeferredPayloadPerType.RemoveAndCopyValue(PayloadType, SerializePayload))
+	{
+		CurrPayloadPerType.FindOrAdd(PayloadType) = SerializePayload();
+	}
+}
+
+void UAVVMSaveGame::FlushDeferredPayloads()
+{
+	for (const auto& [PayloadType, SerializePayload] : DeferredPayloadPerType)
+	{
+		CurrPayloadPerType.FindOrAdd(PayloadType) = SerializePayload();
+	}
+
+	DeferredPayloadPerType.Reset();
+}
+
 void UAVVMSaveGame::MarkFileDirty()
 {
 	bIsMarkedDirty = true;
+	ScheduleSave();
+}
+
+void UAVVMSaveGame::ScheduleSave()
+{
+	// @gdemers debounce. a burst of modifications result in a single write to disk.
+	if (!ScheduledSaveHandle.IsValid())
+	{
+		ScheduledSaveHandle = FTSTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateUObject(this, &UAVVMSaveGame::TickScheduledSave),
+		                                                            UAVVMToolkitSettings::GetScheduledSaveDelay());
+	}
+}
+
+bool UAVVMSaveGame::TickScheduledSave(float DeltaTime)
+{
+	// @gdemers one-shot. the handle is released before saving, so Save doesn't remove the ticker currently executing.
+	ScheduledSaveHandle.Reset();
+	Save();
+	return false;
+}
+
+void UAVVMSaveGame::Save()
+{
+	if (ScheduledSaveHandle.IsValid())
+	{
+		FTSTicker::GetCoreTicker().RemoveTicker(ScheduledSaveHandle);
+		ScheduledSaveHandle.Reset();
+	}
+
+	if (!bIsMarkedDirty)
+	{
+		return;
+	}
+
+	AVVM_LOGGER_LOG(LogToolkit,
+	                nullptr,
+	                GetDefault<UAVVMFileHelper>(),
+	                TEXT("I/O action on Disk. SaveGameToSlotForLocalPlayer. Save Game Slot: %s"),
+	                *GetSaveSlotName());
+
+#if !WITH_EDITOR
+	// @gdemers HandlePreSave flush deferred payloads before the save game is written.
+	ensureAlwaysMsgf(SaveGameToSlotForLocalPlayer(), TEXT("Failed to save game slot."));
+#else
+	// @gdemers editor never write to disk. we still run the save callbacks, so deferred payloads are flushed the same way.
+	HandlePreSave();
+	HandlePostSave(true);
+#endif
 }
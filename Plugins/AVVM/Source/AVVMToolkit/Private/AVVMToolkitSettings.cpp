@@ -26,3 +26,8 @@ const FString& UAVVMToolkitSettings::GetAppDataDirPath()
 	static const FString Path = (FPlatformMisc::GetEnvironmentVariable(TEXT("LOCALAPPDATA")) /= FApp::GetProjectName());
 	return Path;
 }
+
+float UAVVMToolkitSettings::GetScheduledSaveDelay()
+{
+	return GetDefault<UAVVMToolkitSettings>()->ScheduledSaveDelay;
+}
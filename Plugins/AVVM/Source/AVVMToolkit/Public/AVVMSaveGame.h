@@ -21,6 +21,7 @@
 
 #include "CoreMinimal.h"
 
+#include "Containers/Ticker.h"
 #include "GameFramework/SaveGame.h"
 
 #include "AVVMSaveGame.generated.h"
@@ -43,6 +44,20 @@ public:
 	static void Static_Serialize(const FName PayloadType,
 	                             const FString& NewPayload);
 
+	// @gdemers register a function flattening a payload owned by an in-memory cache. the payload is only produced once read, or
+	// once the save game is written to disk, so a cache can be modified without re-serializing its whole content every time.
+	static void Static_SerializeDeferred(const FName PayloadType,
+	                                     const TFunction<FString()>& SerializePayload);
+
+	// @gdemers incremented whenever a payload is replaced by something else than its deferred serialization (i.e - default
+	// content, Static_Serialize, or load). caches built from a payload compare against it to know when to reload.
+	static uint32 Static_GetPayloadRevision(const FName PayloadType);
+
+	// @gdemers write the save game to disk, if marked dirty, without waiting on the scheduled save. call it at checkpoints (i.e -
+	// end of match).
+	static void Static_Save();
+
+	virtual void BeginDestroy() override;
 	virtual void HandlePreSave() override;
 	virtual void HandlePostLoad() override;
 	virtual void HandlePostSave(bool bSuccess) override;
@@ -54,7 +69,14 @@ protected:
 
 	// @gdemers _v2 prevent function name shadowing in base UObject class.
 	void Serialize_v2(const FName PayloadType, const FString& NewPayload);
+	void SerializeDeferred(const FName PayloadType, const TFunction<FString()>& SerializePayload);
+	uint32 GetPayloadRevision(const FName PayloadType) const;
+	void FlushDeferredPayload(const FName PayloadType);
+	void FlushDeferredPayloads();
 	void MarkFileDirty();
+	void ScheduleSave();
+	bool TickScheduledSave(float DeltaTime);
+	void Save();
 
 	// @gdemers for hot-reload
 	UPROPERTY(Transient, BlueprintReadOnly)
@@ -65,6 +87,12 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TMap<FName, FString> CurrPayloadPerType;
 
+	TMap<FName, TFunction<FString()>> DeferredPayloadPerType;
+	TMap<FName, uint32> RevisionPerType;
+
+	// @gdemers a single save is scheduled at a time. modifications made until it fire are written along.
+	FTSTicker::FDelegateHandle ScheduledSaveHandle;
+
 	UPROPERTY(Transient, BlueprintReadOnly)
 	double SessionStartTime = 0.f;
 
@@ -73,4 +101,8 @@ protected:
 	
 	UPROPERTY(Transient,  BlueprintReadOnly)
 	bool bIsMarkedDirty = false;
+
+#if WITH_AUTOMATION_TESTS
+	friend class InventoryProviderStoreTest;
+#endif
 };
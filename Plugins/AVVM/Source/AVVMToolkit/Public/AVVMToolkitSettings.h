@@ -38,4 +38,11 @@ class AVVMTOOLKIT_API UAVVMToolkitSettings : public UDeveloperSettings
 public:
 	UFUNCTION(BlueprintCallable, Category="Toolkit|Settings")
 	static const FString& GetAppDataDirPath();
+
+	UFUNCTION(BlueprintCallable, Category="Toolkit|Settings")
+	static float GetScheduledSaveDelay();
+
+protected:
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers|SaveGame", meta=(ClampMin="0", ToolTip="Time, in seconds, between a save game modification and its write to disk. Modifications made in between are written along. 0 write on next tick."))
+	float ScheduledSaveDelay = 5.f;
 };
@@ -0,0 +1,156 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "Cheats/AVVMTickSchedulerCheatExtension.h"
+
+#include "AVVMGameplayModule.h"
+#include "AVVMLogger.h"
+#include "AVVMTickScheduler.h"
+#include <imgui.h>
+#include "Engine/World.h"
+
+void UAVVMTickSchedulerCheatExtension::AddedToCheatManager_Implementation()
+{
+	AVVM_LOGGER_LOG(LogGameplay,
+	                nullptr,
+	                this,
+	                TEXT("Adding %s."),
+	                *GetNameSafe(UAVVMTickSchedulerCheatExtension::StaticClass()));
+
+	FAVVMImGuiModule::Get().GetDebuggerContext().AddDescriptor(this);
+}
+
+void UAVVMTickSchedulerCheatExtension::RemovedFromCheatManager_Implementation()
+{
+	AVVM_LOGGER_LOG(LogGameplay,
+	                nullptr,
+	                this,
+	                TEXT("Removing %s."),
+	                *GetNameSafe(UAVVMTickSchedulerCheatExtension::StaticClass()));
+
+	FAVVMImGuiModule::Get().GetDebuggerContext().RemoveDescriptor(this);
+}
+
+void UAVVMTickSchedulerCheatExtension::Draw()
+{
+	if (!ImGui::CollapsingHeader("Debug [TickScheduler]"))
+	{
+		return;
+	}
+
+	const auto* TickScheduler = UWorld::GetSubsystem<UAVVMTickScheduler>(GetWorld());
+	if (!IsValid(TickScheduler))
+	{
+		ImGui::Text("UAVVMTickScheduler isn't running in this world.");
+		return;
+	}
+
+	const FAVVMTickSchedulerStats Stats = TickScheduler->GetStats();
+	if (!Stats.bShowDebugOverlay)
+	{
+		ImGui::Text("Debug overlay is disabled by UAVVMTickSchedulerRule.");
+		return;
+	}
+
+	{
+		ImGui::Text("Rule");
+		ImGui::Separator();
+
+		ImGui::Text("GlobalJobAllotment : %.3f ms", Stats.GlobalJobAllotment * 1000.f);
+		ImGui::Text("TickRate : %.3f ms", Stats.TickRate * 1000.f);
+		ImGui::Text("MaxStaleness : %.3f ms", Stats.MaxStaleness * 1000.f);
+	}
+
+	{
+		ImGui::Text("Frame");
+		ImGui::Separator();
+
+		ImGui::Text("Serial Lane : %.3f ms (%.1f%% of budget)", Stats.SerialLaneSeconds * 1000.0, Stats.FrameBudgetConsumed * 100.0);
+		ImGui::Text("Parallel Lane : %.3f ms, %d entities ticked", Stats.ParallelLaneSeconds * 1000.0, Stats.ParallelLane.NumTicked);
+	}
+
+	{
+		ImGui::Text("Priority Levels");
+		ImGui::Separator();
+
+		if (ImGui::BeginTable("TickSchedulerLevels", 5, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg))
+		{
+			ImGui::TableSetupColumn("Level");
+			ImGui::TableSetupColumn("Ticked");
+			ImGui::TableSetupColumn("Deferred");
+			ImGui::TableSetupColumn("Demotions");
+			ImGui::TableSetupColumn("Promotions");
+			ImGui::TableHeadersRow();
+
+			for (int32 i = 0; i < Stats.Levels.Num(); ++i)
+			{
+				const FAVVMTickSchedulerCounters& Counters = Stats.Levels[i];
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::Text("%d", i);
+				ImGui::TableNextColumn(); ImGui::Text("%d", Counters.NumTicked);
+				ImGui::TableNextColumn(); ImGui::Text("%d", Counters.NumDeferred);
+				ImGui::TableNextColumn(); ImGui::Text("%d", Counters.NumDemotions);
+				ImGui::TableNextColumn(); ImGui::Text("%d", Counters.NumPromotions);
+			}
+
+			ImGui::EndTable();
+		}
+	}
+
+	{
+		ImGui::Text("Classes");
+		ImGui::Separator();
+
+		if (ImGui::BeginTable("TickSchedulerClasses", 8, ImGuiTableFlags_Borders | ImGuiTableFlags_RowBg | ImGuiTableFlags_ScrollY, ImVec2(0.f, 300.f)))
+		{
+			ImGui::TableSetupColumn("Class");
+			ImGui::TableSetupColumn("Lane");
+			ImGui::TableSetupColumn("Entities");
+			ImGui::TableSetupColumn("Ticked");
+			ImGui::TableSetupColumn("Deferred");
+			ImGui::TableSetupColumn("Demotions (total)");
+			ImGui::TableSetupColumn("Promotions (total)");
+			ImGui::TableSetupColumn("ns/entity");
+			ImGui::TableHeadersRow();
+
+			for (const FAVVMTickSchedulerClassStats& ClassStats : Stats.Classes)
+			{
+				ImGui::TableNextRow();
+				ImGui::TableNextColumn(); ImGui::Text("%s", TCHAR_TO_UTF8(*ClassStats.ClassName));
+				ImGui::TableNextColumn();
+				if (ClassStats.bDoesSupportParallelTick)
+				{
+					ImGui::Text("Parallel");
+				}
+				else
+				{
+					ImGui::Text("Level %d", ClassStats.PriorityLevel);
+				}
+				ImGui::TableNextColumn(); ImGui::Text("%d", ClassStats.NumEntities);
+				ImGui::TableNextColumn(); ImGui::Text("%d", ClassStats.Counters.NumTicked);
+				ImGui::TableNextColumn(); ImGui::Text("%d", ClassStats.Counters.NumDeferred);
+				ImGui::TableNextColumn(); ImGui::Text("%d", ClassStats.Counters.NumDemotions);
+				ImGui::TableNextColumn(); ImGui::Text("%d", ClassStats.Counters.NumPromotions);
+				ImGui::TableNextColumn(); ImGui::Text("%.0f", ClassStats.NanosecondsPerEntity);
+			}
+
+			ImGui::EndTable();
+		}
+	}
+}
@@ -155,3 +155,13 @@ bool UBatchingRule::ShouldGarbageOnNextTick() const
 {
 	return bShouldGarbageOnNextTick;
 }
+
+bool UBatchingRule::ShouldUseSpatialBucketing() const
+{
+	return bUseSpatialBucketing;
+}
+
+float UBatchingRule::GetSpatialCellSize() const
+{
+	return SpatialCellSize;
+}
@@ -19,6 +19,7 @@
 //SOFTWARE.
 #include "BatchingSubsystem.h"
 
+#include "AVVMActorPoolSubsystem.h"
 #include "AVVMGameplayUtils.h"
 #include "AVVMLogger.h"
 #include "AVVMToolkitUtils.h"
@@ -31,6 +32,7 @@
 #include "TimerManager.h"
 #include "Engine/StreamableManager.h"
 #include "Engine/World.h"
+#include "GameFramework/Actor.h"
 
 // @gdemers WARNING : Careful about Server-Client mismatch. Server grants tags so this module has to be available there.
 UE_DEFINE_GAMEPLAY_TAG(TAG_WORLD_RULE_BATCHING, "WorldRule.Batching");
@@ -76,6 +78,11 @@ void UBatchingSubsystem::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
 
+	if (bUseSpatialBucketing)
+	{
+		TickSpatialDestroy(DeltaTime);
+	}
+
 	if (PendingDestroy.IsEmpty())
 	{
 		return;
@@ -99,6 +106,13 @@ void UBatchingSubsystem::Tick(float DeltaTime)
 		{
 			Iterator->Invalidate();
 			bHasDestroyedBatched |= true;
+
+			// @gdemers destruction is deferred, and spread over the next interval.
+			if (bUseSpatialBucketing)
+			{
+				SpatialPendingDestroy.Add(MoveTemp(*Iterator));
+				Iterator.RemoveCurrentSwap();
+			}
 		}
 		else
 		{
@@ -112,6 +126,28 @@ void UBatchingSubsystem::Tick(float DeltaTime)
 		Timestamp = 0.f;
 	}
 
+	RefreshBatchIndices();
+
+	if (bUseSpatialBucketing && bHasDestroyedBatched)
+	{
+		// @gdemers batches of the same cell are destroyed back to back, so each tick only touch a small area.
+		SpatialPendingDestroy.Sort([](const FBatchContext& Lhs, const FBatchContext& Rhs)
+		{
+			return (Lhs.GetCell().X != Rhs.GetCell().X) ? (Lhs.GetCell().X < Rhs.GetCell().X) : (Lhs.GetCell().Y < Rhs.GetCell().Y);
+		});
+
+		SpatialDestroyRate = (Interval > 0.f) ? (SpatialPendingDestroy.Num() / Interval) : 0.f;
+		if (SpatialDestroyRate <= 0.f)
+		{
+			TickSpatialDestroy(DeltaTime);
+		}
+	}
+
+	if (NewPendingDestroy.IsEmpty())
+	{
+		return;
+	}
+
 	if (bShouldGarbageOnNextTick)
 	{
 		GarbageOnNextTick(NewPendingDestroy);
@@ -163,7 +199,7 @@ bool UBatchingSubsystem::Static_IsEmpty(const UWorld* World)
 
 bool UBatchingSubsystem::IsEmpty() const
 {
-	return PendingDestroy.IsEmpty() && !NextTickHandle.IsValid();
+	return PendingDestroy.IsEmpty() && SpatialPendingDestroy.IsEmpty() && !NextTickHandle.IsValid();
 }
 #endif
 
@@ -186,6 +222,17 @@ void UBatchingSubsystem::UnRegister(AActor* Actor)
 		return;
 	}
 
+	if (!Batchable->HasValidBatchIndex() && bUseSpatialBucketing)
+	{
+		// @gdemers batches waiting on spatial destroy are invalidated, but their actors may still be picked up in the meantime.
+		for (FBatchContext& BatchContext : SpatialPendingDestroy)
+		{
+			BatchContext.Remove(Actor);
+		}
+
+		return;
+	}
+
 	if (!ensureAlways(Batchable->HasValidBatchIndex()))
 	{
 		AVVM_LOGGER_LOG(LogBatchSample,
@@ -224,24 +271,41 @@ void UBatchingSubsystem::Register(AActor* Actor)
 		return;
 	}
 
-	if (PendingDestroy.IsEmpty())
+	int32 BatchIndex = INDEX_NONE;
+	if (bUseSpatialBucketing)
 	{
-		PendingDestroy.Add(FBatchContext{Actor, MaxSizePerBatchDestroy});
+		const FIntPoint Cell = GetCell(Actor);
+		const int32* OpenBatchIndex = CellToOpenBatchIndex.Find(Cell);
+		if ((OpenBatchIndex != nullptr) && !PendingDestroy[*OpenBatchIndex].DoesQualifyForBatchDestroy(MaxSizePerBatchDestroy))
+		{
+			BatchIndex = *OpenBatchIndex;
+			PendingDestroy[BatchIndex].Add(Actor);
+		}
+		else
+		{
+			BatchIndex = PendingDestroy.Add(FBatchContext{Actor, MaxSizePerBatchDestroy, Cell});
+			CellToOpenBatchIndex.Add(Cell, BatchIndex);
+		}
+	}
+	else if (PendingDestroy.IsEmpty())
+	{
+		BatchIndex = PendingDestroy.Add(FBatchContext{Actor, MaxSizePerBatchDestroy});
 	}
 	else
 	{
 		FBatchContext& Top = PendingDestroy.Top();
 		if (Top.DoesQualifyForBatchDestroy(MaxSizePerBatchDestroy))
 		{
-			PendingDestroy.Add(FBatchContext{Actor, MaxSizePerBatchDestroy});
+			BatchIndex = PendingDestroy.Add(FBatchContext{Actor, MaxSizePerBatchDestroy});
 		}
 		else
 		{
+			BatchIndex = (PendingDestroy.Num() - 1);
 			Top.Add(Actor);
 		}
 	}
 
-	Batchable->SetOwningBatchIndex(PendingDestroy.Num());
+	Batchable->SetOwningBatchIndex(BatchIndex);
 
 	if (ensureAlways(Batchable->HasValidBatchIndex()))
 	{
@@ -257,6 +321,10 @@ void UBatchingSubsystem::Clear()
 {
 	StreamableHandle.Reset();
 	PendingDestroy.Empty();
+	SpatialPendingDestroy.Empty();
+	CellToOpenBatchIndex.Empty();
+	SpatialDestroyRate = 0.f;
+	SpatialDestroyBudget = 0.f;
 }
 
 void UBatchingSubsystem::CreateBatchingRule()
@@ -308,6 +376,8 @@ void UBatchingSubsystem::InitRule()
 		MaxSizePerBatchDestroy = Rule->GetMaxSizePerBatchDestroy();
 		Interval = Rule->GetBatchInterval();
 		bShouldGarbageOnNextTick = Rule->ShouldGarbageOnNextTick();
+		bUseSpatialBucketing = Rule->ShouldUseSpatialBucketing();
+		SpatialCellSize = FMath::Max(Rule->GetSpatialCellSize(), 1.f);
 	}
 }
 
@@ -344,6 +414,83 @@ void UBatchingSubsystem::GarbageNow(TArray<FBatchContext>& NewPendingDestroy) co
 	}
 }
 
+FIntPoint UBatchingSubsystem::GetCell(const AActor* Actor) const
+{
+	const FVector Location = IsValid(Actor) ? Actor->GetActorLocation() : FVector::ZeroVector;
+	return FIntPoint(FMath::FloorToInt32(Location.X / SpatialCellSize), FMath::FloorToInt32(Location.Y / SpatialCellSize));
+}
+
+void UBatchingSubsystem::RefreshBatchIndices()
+{
+	// @gdemers pending batches are compacted when others are destroyed. their actors must reference their new index.
+	CellToOpenBatchIndex.Reset();
+
+	for (int32 i = 0; i < PendingDestroy.Num(); ++i)
+	{
+		const FBatchContext& BatchContext = PendingDestroy[i];
+		BatchContext.SetBatchIndex(i);
+
+		if (bUseSpatialBucketing && !BatchContext.DoesQualifyForBatchDestroy(MaxSizePerBatchDestroy))
+		{
+			CellToOpenBatchIndex.Add(BatchContext.GetCell(), i);
+		}
+	}
+}
+
+void UBatchingSubsystem::TickSpatialDestroy(const float DeltaTime)
+{
+	if (SpatialPendingDestroy.IsEmpty())
+	{
+		return;
+	}
+
+	if (SpatialDestroyRate > 0.f)
+	{
+		SpatialDestroyBudget += (SpatialDestroyRate * DeltaTime);
+	}
+
+	// @gdemers a single deferred destroy is tracked by NextTickHandle. scheduling another would overwrite it, and the previous
+	// timer would then invalidate the handle of the new one. the budget keeps accumulating until it has been consumed.
+	if (bShouldGarbageOnNextTick && NextTickHandle.IsValid())
+	{
+		return;
+	}
+
+	int32 NumToDestroy = SpatialPendingDestroy.Num();
+	if (SpatialDestroyRate > 0.f)
+	{
+		NumToDestroy = FMath::Min(FMath::FloorToInt32(SpatialDestroyBudget), NumToDestroy);
+		SpatialDestroyBudget -= NumToDestroy;
+	}
+
+	if (NumToDestroy <= 0)
+	{
+		return;
+	}
+
+	TArray<FBatchContext> NewPendingDestroy;
+	NewPendingDestroy.Reserve(NumToDestroy);
+	for (int32 i = 0; i < NumToDestroy; ++i)
+	{
+		NewPendingDestroy.Add(MoveTemp(SpatialPendingDestroy[i]));
+	}
+
+	SpatialPendingDestroy.RemoveAt(0, NumToDestroy, EAllowShrinking::No);
+	if (SpatialPendingDestroy.IsEmpty())
+	{
+		SpatialDestroyBudget = 0.f;
+	}
+
+	if (bShouldGarbageOnNextTick)
+	{
+		GarbageOnNextTick(NewPendingDestroy);
+	}
+	else
+	{
+		GarbageNow(NewPendingDestroy);
+	}
+}
+
 bool UBatchingSubsystem::FBatchContext::DoesQualifyForBatchDestroy(const float MaxSize) const
 {
 	return Candidates.Num() >= MaxSize;
@@ -367,7 +514,8 @@ void UBatchingSubsystem::FBatchContext::Obliterate()
 		                TEXT("Is being destroyed with Batch Index %d."),
 		                Batchable->GetOwningBatchIndex());
 
-		(*Iterator)->Destroy();
+		// @gdemers classes pooled by the world rule are recycled, others are destroyed.
+		UAVVMActorPoolSubsystem::Static_ReleaseActor(Actor->GetWorld(), Iterator->Get());
 	}
 }
 
@@ -392,3 +540,15 @@ void UBatchingSubsystem::FBatchContext::Invalidate() const
 		}
 	}
 }
+
+void UBatchingSubsystem::FBatchContext::SetBatchIndex(const int32 BatchIndex) const
+{
+	for (auto Iterator = Candidates.CreateConstIterator(); Iterator; ++Iterator)
+	{
+		const auto Batchable = TScriptInterface<IBatchable>(Iterator->Get());
+		if (UAVVMToolkitUtils::IsNativeScriptInterfaceValid(Batchable))
+		{
+			Batchable->SetOwningBatchIndex(BatchIndex);
+		}
+	}
+}
@@ -25,6 +25,10 @@
 #include "BatchingSubsystem.h"
 #include "EngineUtils.h"
 #include "NativeGameplayTags.h"
+#include "TimerManager.h"
+#include "Components/SceneComponent.h"
+#include "Subsystems/SubsystemCollection.h"
+#include "Tests/AutomationCommon.h"
 
 // @gdemers WARNING : Careful about Server-Client mismatch. Server grants tags so this module has to be available there.
 UE_DEFINE_GAMEPLAY_TAG(AUTOMATED_TEST_TAG_WORLD_RULE_BATCHING, "WorldRule.Batching");
@@ -193,3 +197,143 @@ void ABatchSampleTest::EvaluateTestPredicate()
 	FinishTest(EFunctionalTestResult::Succeeded, TEXT("Batch Destroy process behaved has expected."));
 #endif
 }
+
+#if WITH_AUTOMATION_TESTS
+namespace NSBatchSampleTest
+{
+	AAutomatedTestBatchableActor* SpawnAt(UWorld* World, const FVector& Location)
+	{
+		auto* TestActor = World->SpawnActor<AAutomatedTestBatchableActor>();
+		if (!IsValid(TestActor))
+		{
+			return nullptr;
+		}
+
+		// @gdemers the native test actor has no root component, and so no location of its own.
+		auto* Root = NewObject<USceneComponent>(TestActor);
+		TestActor->SetRootComponent(Root);
+		Root->RegisterComponent();
+		TestActor->SetActorLocation(Location);
+		return TestActor;
+	}
+}
+#endif
+
+/**
+ *	Class description:
+ *
+ *	BatchSampleSpatialBucketingTest is an Automated Test running validation on batches formed per grid cell, and on
+ *	qualifying batches being destroyed cell by cell over the following interval.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(BatchSampleSpatialBucketingTest, "AutomatedTest.CustomGroup.BatchSampleSpatialBucketingTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool BatchSampleSpatialBucketingTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	// @gdemers the subsystem require a world setting referencing the rule. it is created, and configured, by hand instead.
+	// initialized so it can be ticked, and without the rule requested from the world setting.
+	FSubsystemCollection<UWorldSubsystem> Collection;
+	auto* Subsystem = NewObject<UBatchingSubsystem>(World);
+	Subsystem->Initialize(Collection);
+	Subsystem->StreamableHandle.Reset();
+
+	auto* Rule = NewObject<UBatchingRule>(Subsystem);
+	Rule->AllowedActorClasses.Add(AAutomatedTestBatchableActor::StaticClass());
+	Rule->MaxSizePerBatchDestroy = 2;
+	Rule->IntervalBetweenBatchDestroy = 1.f;
+	Rule->MaxLifetimeAllowedToUndersizeBatch = 10.f;
+	Rule->bShouldGarbageOnNextTick = false;
+	Rule->bUseSpatialBucketing = true;
+	Rule->SpatialCellSize = 1000.f;
+
+	Subsystem->BatchingRule = Rule;
+	Subsystem->InitRule();
+
+	const FIntPoint CellA = FIntPoint(-1, 2);
+	const FIntPoint CellB = FIntPoint(0, 0);
+	const FIntPoint CellC = FIntPoint(1, 0);
+
+	// @gdemers registration is interleaved between cells, batches must still group actors sharing a cell.
+	TArray<AAutomatedTestBatchableActor*> TestActors;
+	TestActors.Add(NSBatchSampleTest::SpawnAt(World, FVector(100.0, 100.0, 0.0)));
+	TestActors.Add(NSBatchSampleTest::SpawnAt(World, FVector(1100.0, 100.0, 0.0)));
+	TestActors.Add(NSBatchSampleTest::SpawnAt(World, FVector(-100.0, 2100.0, 0.0)));
+	TestActors.Add(NSBatchSampleTest::SpawnAt(World, FVector(200.0, 900.0, 0.0)));
+	TestActors.Add(NSBatchSampleTest::SpawnAt(World, FVector(1900.0, 500.0, 0.0)));
+	TestActors.Add(NSBatchSampleTest::SpawnAt(World, FVector(-900.0, 2900.0, 0.0)));
+	TestActors.Add(NSBatchSampleTest::SpawnAt(World, FVector(500.0, 500.0, 0.0)));
+
+	for (AAutomatedTestBatchableActor* TestActor : TestActors)
+	{
+		UTEST_NOT_NULL("Spawned Actor.", TestActor)
+		Subsystem->Register(TestActor);
+		UTEST_TRUE("Registered Actor.", TestActor->HasValidBatchIndex())
+	}
+
+	UTEST_EQUAL("Num Batches.", Subsystem->PendingDestroy.Num(), 4)
+	UTEST_EQUAL("Cell B Batch.", TestActors[0]->GetOwningBatchIndex(), TestActors[3]->GetOwningBatchIndex())
+	UTEST_EQUAL("Cell C Batch.", TestActors[1]->GetOwningBatchIndex(), TestActors[4]->GetOwningBatchIndex())
+	UTEST_EQUAL("Cell A Batch.", TestActors[2]->GetOwningBatchIndex(), TestActors[5]->GetOwningBatchIndex())
+	UTEST_NOT_EQUAL("Full Cell B Batch.", TestActors[0]->GetOwningBatchIndex(), TestActors[6]->GetOwningBatchIndex())
+	UTEST_TRUE("Cell A.", Subsystem->PendingDestroy[TestActors[2]->GetOwningBatchIndex()].GetCell() == CellA)
+	UTEST_TRUE("Cell B.", Subsystem->PendingDestroy[TestActors[0]->GetOwningBatchIndex()].GetCell() == CellB)
+	UTEST_TRUE("Cell C.", Subsystem->PendingDestroy[TestActors[1]->GetOwningBatchIndex()].GetCell() == CellC)
+
+	const int32* OpenBatchIndex = Subsystem->CellToOpenBatchIndex.Find(CellB);
+	UTEST_NOT_NULL("Open Batch Cell B.", OpenBatchIndex)
+	UTEST_EQUAL("Open Batch Index.", *OpenBatchIndex, TestActors[6]->GetOwningBatchIndex())
+
+	// @gdemers nothing qualify before the interval elapse.
+	Subsystem->Tick(0.5f);
+	UTEST_TRUE("Spatial Pending Destroy Empty.", Subsystem->SpatialPendingDestroy.IsEmpty())
+
+	// @gdemers full batches are ordered by cell, and destroyed at a rate of one interval for all of them.
+	Subsystem->Tick(0.5f);
+	UTEST_EQUAL("Num Spatial Pending Destroy.", Subsystem->SpatialPendingDestroy.Num(), 3)
+	UTEST_EQUAL("Num Pending Destroy.", Subsystem->PendingDestroy.Num(), 1)
+	UTEST_TRUE("First Cell.", Subsystem->SpatialPendingDestroy[0].GetCell() == CellA)
+	UTEST_TRUE("Second Cell.", Subsystem->SpatialPendingDestroy[1].GetCell() == CellB)
+	UTEST_TRUE("Third Cell.", Subsystem->SpatialPendingDestroy[2].GetCell() == CellC)
+	UTEST_EQUAL("Spatial Destroy Rate.", Subsystem->SpatialDestroyRate, 3.f)
+	UTEST_EQUAL("Undersized Batch Index.", TestActors[6]->GetOwningBatchIndex(), 0)
+
+	Subsystem->Tick(0.25f);
+	UTEST_EQUAL("Num Spatial Pending Destroy.", Subsystem->SpatialPendingDestroy.Num(), 3)
+	UTEST_FALSE("Cell A Alive.", TestActors[2]->IsActorBeingDestroyed())
+
+	Subsystem->Tick(0.25f);
+	UTEST_EQUAL("Num Spatial Pending Destroy.", Subsystem->SpatialPendingDestroy.Num(), 2)
+	UTEST_TRUE("Cell A Destroyed.", TestActors[2]->IsActorBeingDestroyed() && TestActors[5]->IsActorBeingDestroyed())
+	UTEST_FALSE("Cell B Alive.", TestActors[0]->IsActorBeingDestroyed())
+
+	Subsystem->Tick(0.5f);
+	UTEST_TRUE("Spatial Pending Destroy Empty.", Subsystem->SpatialPendingDestroy.IsEmpty())
+	UTEST_EQUAL("Spatial Destroy Budget.", Subsystem->SpatialDestroyBudget, 0.f)
+	UTEST_TRUE("Cell B Destroyed.", TestActors[0]->IsActorBeingDestroyed() && TestActors[3]->IsActorBeingDestroyed())
+	UTEST_TRUE("Cell C Destroyed.", TestActors[1]->IsActorBeingDestroyed() && TestActors[4]->IsActorBeingDestroyed())
+	UTEST_FALSE("Undersized Batch Alive.", TestActors[6]->IsActorBeingDestroyed())
+
+	// @gdemers while a deferred destroy is pending, draining is held back rather than overwriting its timer handle.
+	Subsystem->bShouldGarbageOnNextTick = true;
+	Subsystem->SpatialPendingDestroy.Add(UBatchingSubsystem::FBatchContext{TestActors[6], 2, CellB});
+	Subsystem->NextTickHandle = World->GetTimerManager().SetTimerForNextTick([]() {});
+
+	Subsystem->TickSpatialDestroy(1.f);
+	UTEST_EQUAL("Held Back.", Subsystem->SpatialPendingDestroy.Num(), 1)
+
+	Subsystem->NextTickHandle.Invalidate();
+	Subsystem->TickSpatialDestroy(0.f);
+	UTEST_TRUE("Drained.", Subsystem->SpatialPendingDestroy.IsEmpty())
+	UTEST_TRUE("Deferred Destroy Scheduled.", Subsystem->NextTickHandle.IsValid())
+
+	Subsystem->Deinitialize();
+	TestWorld.EndPlayInTestWorld();
+#endif
+	return true;
+}
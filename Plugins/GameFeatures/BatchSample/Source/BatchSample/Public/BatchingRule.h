@@ -58,6 +58,8 @@ public:
 	float GetBatchInterval() const;
 	float GetMaxLifetimeAllowedToUndersizeBatch() const;
 	bool ShouldGarbageOnNextTick() const;
+	bool ShouldUseSpatialBucketing() const;
+	float GetSpatialCellSize() const;
 
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ToolTip="Flag allowing user to define only the Base Class subject to Batch Destroy. Derived Classes with be automatically considered as acceptable for Batch Destroy."))
@@ -81,6 +83,12 @@ protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers")
 	bool bShouldGarbageOnNextTick = true;
 
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers|Spatial", meta=(ToolTip="Flag allowing batches to be formed from Actors sharing a grid cell, instead of registration order. Destruction of qualifying cells is spread over the interval."))
+	bool bUseSpatialBucketing = false;
+
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers|Spatial", meta=(EditCondition="bUseSpatialBucketing", ClampMin="100", Units="cm"))
+	float SpatialCellSize = 5000.f;
+
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TArray<TSubclassOf<AActor>> AllowedActorClasses;
 
@@ -92,5 +100,6 @@ protected:
 	
 #if WITH_AUTOMATION_TESTS
 	friend class ABatchSampleTest;
+	friend class BatchSampleSpatialBucketingTest;
 #endif
 };
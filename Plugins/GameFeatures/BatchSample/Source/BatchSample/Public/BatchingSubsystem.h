@@ -42,6 +42,10 @@ class UBatchingRule;
  *	actors are usually expected to remain in world or for given laps of time which can be handled via this system.
  *
  *	Example : Pickups in Multiplayer game.
+ *
+ *	When the rule enable spatial bucketing, batches are formed from Actors sharing a cell of a 2d grid keyed by world position,
+ *	and qualifying batches are destroyed cell by cell over the following interval. Net relevancy bookkeeping then scale with the
+ *	area affected, rather than the total amount of Actors registered.
  */
 UCLASS()
 class BATCHSAMPLE_API UBatchingSubsystem : public UTickableWorldSubsystem
@@ -52,7 +56,8 @@ class BATCHSAMPLE_API UBatchingSubsystem : public UTickableWorldSubsystem
 	{
 		// @gdemers default ctor called first, then we reserve size. imply double initialization
 		// of properties, but allow for preallocation of collection type to avoid resizing.
-		FBatchContext(AActor* Actors, const int32 MaxSize)
+		FBatchContext(AActor* Actors, const int32 MaxSize, const FIntPoint& NewCell = FIntPoint::ZeroValue)
+			: Cell(NewCell)
 		{
 			Candidates.Reserve(MaxSize);
 			Candidates.Add(Actors);
@@ -68,9 +73,12 @@ class BATCHSAMPLE_API UBatchingSubsystem : public UTickableWorldSubsystem
 		void Add(AActor* Actor);
 		void Remove(AActor* Actor);
 		void Invalidate() const;
+		void SetBatchIndex(const int32 BatchIndex) const;
+		const FIntPoint& GetCell() const { return Cell; }
 
 	private:
 		TArray<TWeakObjectPtr<AActor>> Candidates;
+		FIntPoint Cell = FIntPoint::ZeroValue;
 	};
 
 public:
@@ -104,6 +112,9 @@ protected:
 	void InitRule();
 	void GarbageOnNextTick(TArray<FBatchContext>& NewPendingDestroy);
 	void GarbageNow(TArray<FBatchContext>& NewPendingDestroy) const;
+	FIntPoint GetCell(const AActor* Actor) const;
+	void RefreshBatchIndices();
+	void TickSpatialDestroy(const float DeltaTime);
 	
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TWeakObjectPtr<const UBatchingRule> BatchingRule = nullptr;
@@ -122,14 +133,31 @@ protected:
 
 	UPROPERTY(Transient, BlueprintReadOnly)
 	bool bShouldGarbageOnNextTick = false;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	bool bUseSpatialBucketing = false;
+
+	UPROPERTY(Transient, BlueprintReadOnly)
+	float SpatialCellSize = 0.f;
+
+	// @gdemers batches destroyed per second, and fraction carried over between ticks, while draining SpatialPendingDestroy.
+	float SpatialDestroyRate = 0.f;
+	float SpatialDestroyBudget = 0.f;
 	
 	UPROPERTY(Transient, BlueprintReadOnly)
 	FTimerHandle NextTickHandle = FTimerHandle();
 
 	TSharedPtr<FStreamableHandle> StreamableHandle = nullptr;
 	TArray<FBatchContext> PendingDestroy;
+
+	// @gdemers qualifying batches, ordered by cell, waiting to be destroyed over the interval.
+	TArray<FBatchContext> SpatialPendingDestroy;
+
+	// @gdemers batch currently filling up, for each cell.
+	TMap<FIntPoint, int32> CellToOpenBatchIndex;
 	
 #if WITH_AUTOMATION_TESTS
 	friend class ABatchSampleTest;
+	friend class BatchSampleSpatialBucketingTest;
 #endif
 };
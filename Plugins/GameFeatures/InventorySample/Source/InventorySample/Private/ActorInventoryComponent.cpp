@@ -24,13 +24,13 @@
 #include "AVVMLogger.h"
 #include "AVVMNotificationSubsystem.h"
 #include "AVVMReplicatedTagComponent.h"
-#include "AVVMSaveGame.h"
 #include "AVVMScopedUtils.h"
 #include "AVVMToolkitUtils.h"
 #include "InventoryExecutionContextParams.h"
 #include "InventoryExecutionContextRule.h"
 #include "InventoryManagerSubsystem.h"
 #include "InventoryProvider.h"
+#include "InventoryProviderStore.h"
 #include "InventorySampleModule.h"
 #include "InventoryUtils.h"
 #include "ItemObject.h"
@@ -1124,17 +1124,11 @@ void UActorInventoryComponent::CheckDisk() const
 		return;
 	}
 
-	// @gdemers get-set file from disk caching all inventory providers representation.
-	const FStringView FileContent = UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, {});
-
 	// @gdemers serialize runtime values so we can write to disk.
 	const TArray<int32> NewDependencies = UInventoryUtils::GetRuntimeUniqueIds(Items);
 
-	// @gdemers update provider Id entries.
-	const FString DirtyFileContent = UInventoryUtils::ModifyInventoryProvider(FileContent.GetData(), TargetUniqueId, NewDependencies);
-
-	// @gdemers : serialize new file content.
-	UAVVMSaveGame::Static_Serialize(InventoryProviderPayloads, DirtyFileContent);
+	// @gdemers update provider Id entries. the file content is only flattened when read, or saved.
+	FInventoryProviderStore::Get().ModifyPrivateItemIds(TargetUniqueId, NewDependencies);
 }
 
 void UActorInventoryComponent::CheckBounds()
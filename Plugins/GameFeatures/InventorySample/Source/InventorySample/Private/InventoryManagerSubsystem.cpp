@@ -19,6 +19,7 @@
 //SOFTWARE.
 #include "InventoryManagerSubsystem.h"
 
+#include "AVVMActorPoolSubsystem.h"
 #include "AVVMWorldSetting.h"
 #include "InventorySettings.h"
 #include "ItemRandomizerRule.h"
@@ -194,21 +195,15 @@ TArray<UItemObject*> UInventoryManagerSubsystem::GetRandomItems(const AActor* Ac
 AActor* UInventoryManagerSubsystem::Factory(const UClass* ItemActorClass,
                                             const FActorSpawnParameters& SpawnParams)
 {
-	UWorld* World = GetWorld();
-	if (IsValid(World))
-	{
-		// @gdemers another good example of const-ness issue in the engine. theres no point in violating bitwise const-ness or logical const-ness and yet
-		// the engine require a UClass* to be non-const.
-		return World->SpawnActor(const_cast<UClass*>(ItemActorClass), &FTransform::Identity, SpawnParams);
-	}
-
-	return nullptr;
+	// @gdemers pickups are released to the pool by the batching system. acquire them from it, classes that aren't pooled
+	// fallback on SpawnActor.
+	return UAVVMActorPoolSubsystem::Static_AcquireActor(GetWorld(), ItemActorClass, FTransform::Identity, SpawnParams);
 }
 
 void UInventoryManagerSubsystem::Shutdown(AActor* ItemActor)
 {
 	if (IsValid(ItemActor))
 	{
-		ItemActor->Destroy();
+		UAVVMActorPoolSubsystem::Static_ReleaseActor(GetWorld(), ItemActor);
 	}
 }
@@ -0,0 +1,271 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "InventoryProviderStore.h"
+
+#include "AVVMFileHelper.h"
+#include "AVVMSaveGame.h"
+#include "InventoryUtils.h"
+#include "Dom/JsonObject.h"
+#include "Policies/CondensedJsonPrintPolicy.h"
+#include "Serialization/JsonSerializer.h"
+#include "Serialization/JsonWriter.h"
+
+// @gdemers external linkage for property FName sharing.
+extern const FName InventoryProviderPayloads;
+
+namespace NSInventoryProviderStore
+{
+	using FJsonWriter = TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>;
+
+	static void WriteRecord(FJsonWriter& Writer, const FInventoryProviderRecord& NewRecord)
+	{
+		Writer.WriteObjectStart();
+		Writer.WriteValue(TEXT("Id"), NewRecord.Id);
+
+		Writer.WriteArrayStart(TEXT("Loadout"));
+		for (const auto& [SlotTag, PrivateItemId] : NewRecord.Loadout)
+		{
+			Writer.WriteObjectStart();
+			Writer.WriteValue(TEXT("SlotTag"), SlotTag.ToString());
+			Writer.WriteValue(TEXT("PrivateItemId"), PrivateItemId);
+			Writer.WriteObjectEnd();
+		}
+
+		Writer.WriteArrayEnd();
+
+		Writer.WriteArrayStart(TEXT("PrivateItemIds"));
+		for (const int32 PrivateItemId : NewRecord.PrivateItemIds)
+		{
+			Writer.WriteValue(PrivateItemId);
+		}
+
+		Writer.WriteArrayEnd();
+		Writer.WriteObjectEnd();
+	}
+
+	// @gdemers providers are written in place, as objects. no intermediate DOM, and no JSON nested in strings.
+	template<typename TRange, typename TProjection>
+	static FString WriteFileContent(const TRange& Range, TProjection Projection)
+	{
+		FString OutFormat;
+
+		const TSharedRef<FJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&OutFormat);
+		Writer->WriteObjectStart();
+		Writer->WriteArrayStart(TEXT("InventoryProviders"));
+
+		for (const auto& Element : Range)
+		{
+			WriteRecord(*Writer, Projection(Element));
+		}
+
+		Writer->WriteArrayEnd();
+		Writer->WriteObjectEnd();
+		Writer->Close();
+
+		return OutFormat;
+	}
+
+	static void ReadRecord(const FJsonObject& JsonData, FInventoryProviderRecord& OutRecord)
+	{
+		FInventoryProviderRecord InventoryProvider;
+		InventoryProvider.Id = JsonData.GetIntegerField(TEXT("Id"));
+
+		const TArray<TSharedPtr<FJsonValue>> Loadout = JsonData.GetArrayField(TEXT("Loadout"));
+		for (const auto& Item : Loadout)
+		{
+			const TSharedPtr<FJsonObject>* OutKVPJsonObject = nullptr;
+			Item->TryGetObject(OutKVPJsonObject);
+
+			if ((OutKVPJsonObject != nullptr) && OutKVPJsonObject->IsValid())
+			{
+				const FString GameplayTag = (*OutKVPJsonObject)->GetStringField(TEXT("SlotTag"));
+				const int32 PrivateItemId = (*OutKVPJsonObject)->GetIntegerField(TEXT("PrivateItemId"));
+				InventoryProvider.Loadout.FindOrAdd(FGameplayTag::RequestGameplayTag(FName(GameplayTag)), PrivateItemId);
+			}
+		}
+
+		const TArray<TSharedPtr<FJsonValue>> PrivateItemIds = JsonData.GetArrayField(TEXT("PrivateItemIds"));
+		InventoryProvider.PrivateItemIds.Reserve(PrivateItemIds.Num());
+		for (const auto& PrivateItemId : PrivateItemIds)
+		{
+			InventoryProvider.PrivateItemIds.Add(PrivateItemId->AsNumber());
+		}
+
+		OutRecord = MoveTemp(InventoryProvider);
+	}
+}
+
+FInventoryProviderStore& FInventoryProviderStore::Get()
+{
+	static FInventoryProviderStore Store;
+	return Store;
+}
+
+const FInventoryProviderRecord* FInventoryProviderStore::Find(const int32 ProviderId)
+{
+	if (!LoadIfStale())
+	{
+		return nullptr;
+	}
+
+	return Providers.Find(ProviderId);
+}
+
+void FInventoryProviderStore::ModifyPrivateItemIds(const int32 ProviderId, const TArray<int32>& NewPrivateItemIds)
+{
+	if (!LoadIfStale())
+	{
+		return;
+	}
+
+	FInventoryProviderRecord* SearchResult = Providers.Find(ProviderId);
+	if (SearchResult == nullptr)
+	{
+		return;
+	}
+
+	// @gdemers overwrite all item entries within this provider.
+	SearchResult->PrivateItemIds = NewPrivateItemIds;
+
+	UAVVMSaveGame::Static_SerializeDeferred(InventoryProviderPayloads, []()
+	{
+		return FInventoryProviderStore::Get().Flatten();
+	});
+}
+
+void FInventoryProviderStore::ToString(const FInventoryProviderRecord& NewRecord, FString& OutFormat)
+{
+	FString JsonOutput;
+
+	const TSharedRef<NSInventoryProviderStore::FJsonWriter> Writer = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&JsonOutput);
+	NSInventoryProviderStore::WriteRecord(*Writer, NewRecord);
+	Writer->Close();
+
+	OutFormat = JsonOutput;
+}
+
+void FInventoryProviderStore::FromString(const FString& NewPayload, FInventoryProviderRecord& OutRecord)
+{
+	if (NewPayload.IsEmpty())
+	{
+		return;
+	}
+
+	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
+
+	auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload);
+	if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
+	{
+		return;
+	}
+
+	NSInventoryProviderStore::ReadRecord(*JsonData, OutRecord);
+}
+
+FString FInventoryProviderStore::ToFileContent(const TArray<FInventoryProviderRecord>& NewRecords)
+{
+	return NSInventoryProviderStore::WriteFileContent(NewRecords, [](const FInventoryProviderRecord& Record) -> const FInventoryProviderRecord&
+	{
+		return Record;
+	});
+}
+
+void FInventoryProviderStore::FromFileContent(const FString& NewPayload, TArray<FInventoryProviderRecord>& OutRecords)
+{
+	OutRecords.Reset();
+
+	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
+
+	auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload);
+	if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
+	{
+		return;
+	}
+
+	const TArray<TSharedPtr<FJsonValue>>* InventoryProviders = nullptr;
+	if (!JsonData->TryGetArrayField(TEXT("InventoryProviders"), InventoryProviders))
+	{
+		return;
+	}
+
+	OutRecords.Reserve(InventoryProviders->Num());
+	for (const auto& InventoryProvider : *InventoryProviders)
+	{
+		const TSharedPtr<FJsonObject>* OutJsonObject = nullptr;
+		FString OutLegacyPayload;
+
+		if (InventoryProvider->TryGetObject(OutJsonObject) && (OutJsonObject != nullptr) && OutJsonObject->IsValid())
+		{
+			NSInventoryProviderStore::ReadRecord(**OutJsonObject, OutRecords.AddDefaulted_GetRef());
+		}
+		else if (InventoryProvider->TryGetString(OutLegacyPayload))
+		{
+			// @gdemers legacy format. the provider is a JSON document nested in a string.
+			FromString(OutLegacyPayload, OutRecords.AddDefaulted_GetRef());
+		}
+	}
+}
+
+bool FInventoryProviderStore::LoadIfStale()
+{
+	const UAVVMSaveGame* SaveGame = UAVVMFileHelper::Static_GetSetSaveGame();
+	if (!ensureAlwaysMsgf(IsValid(SaveGame), TEXT("Invalid SaveGame")))
+	{
+		return false;
+	}
+
+	if ((LoadedSaveGame.Get() == SaveGame) && (LoadedRevision == UAVVMSaveGame::Static_GetPayloadRevision(InventoryProviderPayloads)))
+	{
+		return true;
+	}
+
+	// @gdemers lambda to conditionally generate our default provider content
+	// for serialization to disk.
+	static const auto GenerateDefaultContent = []()
+	{
+		return UInventoryUtils::CreateDefaultInventoryProviders();
+	};
+
+	const FStringView FileContent = UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, GenerateDefaultContent);
+
+	TArray<FInventoryProviderRecord> Records;
+	FromFileContent(FileContent.GetData(), Records);
+
+	Providers.Reset();
+	Providers.Reserve(Records.Num());
+	for (FInventoryProviderRecord& Record : Records)
+	{
+		const int32 ProviderId = Record.Id;
+		Providers.Add(ProviderId, MoveTemp(Record));
+	}
+
+	// @gdemers read after the file content, generating default content bump the revision.
+	LoadedSaveGame = SaveGame;
+	LoadedRevision = UAVVMSaveGame::Static_GetPayloadRevision(InventoryProviderPayloads);
+	return true;
+}
+
+FString FInventoryProviderStore::Flatten() const
+{
+	return NSInventoryProviderStore::WriteFileContent(Providers, [](const TPair<int32, FInventoryProviderRecord>& Pair) -> const FInventoryProviderRecord&
+	{
+		return Pair.Value;
+	});
+}
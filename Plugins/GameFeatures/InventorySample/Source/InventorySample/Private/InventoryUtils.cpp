@@ -23,10 +23,10 @@
 #include "AVVMGameplaySettings.h"
 #include "AVVMGameplayUtils.h"
 #include "AVVMGameSession.h"
-#include "AVVMSaveGame.h"
 #include "AVVMToolkitUtils.h"
 #include "DataRegistrySubsystem.h"
 #include "InventoryProvider.h"
+#include "InventoryProviderStore.h"
 #include "InventorySettings.h"
 #include "ItemObject.h"
 #include "StorageHelper.h"
@@ -34,107 +34,8 @@
 #include "Backend/AVVMOnlineInventory.h"
 #include "Data/AVVMActorIdentifierTableRow.h"
 #include "Data/InventoryProviderTableRow.h"
-#include "Dom/JsonObject.h"
-#include "Serialization/JsonSerializer.h"
-#include "Serialization/JsonWriter.h"
 #include "Tags/PrivateTags.h"
 
-/**
- *	Class description:
- *	
- *	NSJsonInventory is a private namespace for class that should be hidden from project.
- */
-namespace NSJsonInventory
-{
-	struct FJsonInventoryProvider
-	{
-		int32 Id = INDEX_NONE;
-		TMap<FGameplayTag, int32> Loadout;
-		TArray<int32> PrivateItemIds;
-	};
-
-	void ToString(const FJsonInventoryProvider& NewInventoryProvider,
-	              FString& OutFormat)
-	{
-		TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-		JsonData->SetNumberField(TEXT("Id"), NewInventoryProvider.Id);
-
-		TArray<TSharedPtr<FJsonValue>> Loadout;
-		for (const auto& [SlotTag, PrivateItemId] : NewInventoryProvider.Loadout)
-		{
-			TSharedPtr<FJsonObject> KVPJsonObject = MakeShareable(new FJsonObject);
-			KVPJsonObject->SetStringField(TEXT("SlotTag"), SlotTag.ToString());
-			KVPJsonObject->SetNumberField(TEXT("PrivateItemId"), PrivateItemId);
-			Loadout.Add(MakeShareable(new FJsonValueObject(KVPJsonObject)));
-		}
-
-		JsonData->SetArrayField(TEXT("Loadout"), Loadout);
-
-		TArray<TSharedPtr<FJsonValue>> PrivateItemIds;
-		for (const int32 PrivateItemId : NewInventoryProvider.PrivateItemIds)
-		{
-			PrivateItemIds.Add(MakeShareable(new FJsonValueNumber(PrivateItemId)));
-		}
-
-		JsonData->SetArrayField(TEXT("PrivateItemIds"), PrivateItemIds);
-
-		FString JsonOutput;
-
-		auto JsonWriterRef = TJsonWriterFactory<TCHAR>::Create(&JsonOutput);
-		if (!FJsonSerializer::Serialize(JsonData.ToSharedRef(), JsonWriterRef))
-		{
-			return;
-		}
-
-		OutFormat = JsonOutput;
-	}
-
-	void FromString(const FString& NewPayload,
-	                FJsonInventoryProvider& OutInventoryProvider)
-	{
-		if (NewPayload.IsEmpty())
-		{
-			return;
-		}
-
-		TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-
-		auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload);
-		if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
-		{
-			return;
-		}
-
-		FJsonInventoryProvider InventoryProvider;
-		InventoryProvider.Id = JsonData->GetIntegerField(TEXT("Id"));
-
-		const TArray<TSharedPtr<FJsonValue>> Loadout = JsonData->GetArrayField(TEXT("Loadout"));
-		for (const auto& Item : Loadout)
-		{
-			const TSharedPtr<FJsonObject>* OutKVPJsonObject = nullptr;
-			Item->TryGetObject(OutKVPJsonObject);
-
-			if ((OutKVPJsonObject != nullptr) && OutKVPJsonObject->IsValid())
-			{
-				const FString GameplayTag = (*OutKVPJsonObject)->GetStringField(TEXT("SlotTag"));
-				const int32 PrivateItemId = (*OutKVPJsonObject)->GetIntegerField(TEXT("PrivateItemId"));
-				InventoryProvider.Loadout.FindOrAdd(FGameplayTag::RequestGameplayTag(FName(GameplayTag)), PrivateItemId);
-			}
-		}
-
-		const TArray<TSharedPtr<FJsonValue>> PrivateItemIds = JsonData->GetArrayField(TEXT("PrivateItemIds"));
-		for (const auto& PrivateItemId : PrivateItemIds)
-		{
-			InventoryProvider.PrivateItemIds.Add(PrivateItemId->AsNumber());
-		}
-
-		OutInventoryProvider = InventoryProvider;
-	}
-}
-
-// @gdemers external linkage for property FName sharing.
-extern const FName InventoryProviderPayloads;
-
 FString UInventoryUtils::CreateDefaultInventoryProviders()
 {
 	const auto* Subsystem = UDataRegistrySubsystem::Get();
@@ -152,7 +53,9 @@ FString UInventoryUtils::CreateDefaultInventoryProviders()
 	TArray<const FInventoryProviderTableRow*> OutRows;
 	DataRegistry->GetAllItems<FInventoryProviderTableRow>(TEXT(""), OutRows);
 
-	TArray<TSharedPtr<FJsonValue>> OutModifiedPayloads;
+	TArray<FInventoryProviderRecord> OutProviders;
+	OutProviders.Reserve(OutRows.Num());
+
 	for (const FInventoryProviderTableRow* Row : OutRows)
 	{
 		if (!ensureAlwaysMsgf(Row != nullptr, TEXT("Invalid Row entry.")))
@@ -213,37 +116,26 @@ FString UInventoryUtils::CreateDefaultInventoryProviders()
 		// a valid storage object, or more are available for referencing on relevant items.
 		FStorageHelper::HandleStorageAssignment(ItemCDOs, Items);
 
-		const FString OutProvider = UInventoryUtils::CreateInventoryProvider(ProviderId, Loadout, Items);
-		OutModifiedPayloads.Add(MakeShareable(new FJsonValueString(OutProvider)));
+		FInventoryProviderRecord& OutProvider = OutProviders.AddDefaulted_GetRef();
+		OutProvider.Id = ProviderId;
+		OutProvider.Loadout = MoveTemp(Loadout);
+		OutProvider.PrivateItemIds = MoveTemp(Items);
 	}
 
-	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-	JsonData->SetArrayField(TEXT("InventoryProviders"), OutModifiedPayloads);
-
-	FString JsonOutput;
-
-	auto JsonWriterRef = TJsonWriterFactory<TCHAR>::Create(&JsonOutput);
-	if (!FJsonSerializer::Serialize(JsonData.ToSharedRef(), JsonWriterRef))
-	{
-		return FString{};
-	}
-	else
-	{
-		return JsonOutput;
-	}
+	return FInventoryProviderStore::ToFileContent(OutProviders);
 }
 
 FString UInventoryUtils::CreateInventoryProvider(const int32 ProviderId,
                                                  const TMap<FGameplayTag, int32>& Loadout,
                                                  const TArray<int32>& PrivateItemIds)
 {
-	NSJsonInventory::FJsonInventoryProvider InventoryProvider;
+	FInventoryProviderRecord InventoryProvider;
 	InventoryProvider.Id = ProviderId;
 	InventoryProvider.Loadout = Loadout;
 	InventoryProvider.PrivateItemIds = PrivateItemIds;
 
 	FString OutProvider;
-	NSJsonInventory::ToString(InventoryProvider, OutProvider);
+	FInventoryProviderStore::ToString(InventoryProvider, OutProvider);
 
 	return OutProvider;
 }
@@ -252,16 +144,10 @@ FString UInventoryUtils::ModifyInventoryProvider(const FString& NewPayload,
                                                  const int32 ProviderId,
                                                  const TArray<int32>& NewPrivateIds)
 {
-	TArray<NSJsonInventory::FJsonInventoryProvider> InventoryProviders;
-	for (const FString& Payload : UInventoryUtils::GetInventoryProviderPayloads(NewPayload))
-	{
-		NSJsonInventory::FJsonInventoryProvider OutProvider;
-		NSJsonInventory::FromString(Payload, OutProvider);
+	TArray<FInventoryProviderRecord> InventoryProviders;
+	FInventoryProviderStore::FromFileContent(NewPayload, InventoryProviders);
 
-		InventoryProviders.Add(OutProvider);
-	}
-
-	auto* SearchResult = InventoryProviders.FindByPredicate([SearchId = ProviderId](const NSJsonInventory::FJsonInventoryProvider& Provider)
+	auto* SearchResult = InventoryProviders.FindByPredicate([SearchId = ProviderId](const FInventoryProviderRecord& Provider)
 	{
 		return (false == (Provider.Id ^ SearchId));
 	});
@@ -272,46 +158,20 @@ FString UInventoryUtils::ModifyInventoryProvider(const FString& NewPayload,
 		SearchResult->PrivateItemIds = NewPrivateIds;
 	}
 
-	TArray<TSharedPtr<FJsonValue>> OutModifiedPayloads;
-	for (const auto& ModifiedProvider : InventoryProviders)
-	{
-		FString OutFormat;
-		NSJsonInventory::ToString(ModifiedProvider, OutFormat);
-		OutModifiedPayloads.Add(MakeShareable(new FJsonValueString(OutFormat)));
-	}
-
-	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-	JsonData->SetArrayField(TEXT("InventoryProviders"), OutModifiedPayloads);
-
-	FString JsonOutput;
-
-	auto JsonWriterRef = TJsonWriterFactory<TCHAR>::Create(&JsonOutput);
-	if (!FJsonSerializer::Serialize(JsonData.ToSharedRef(), JsonWriterRef))
-	{
-		return FString();
-	}
-	else
-	{
-		return JsonOutput;
-	}
+	return FInventoryProviderStore::ToFileContent(InventoryProviders);
 }
 
 TArray<FString> UInventoryUtils::GetInventoryProviderPayloads(const FString& NewPayload)
 {
-	TSharedPtr<FJsonObject> JsonData = MakeShareable(new FJsonObject);
-
-	auto JsonReaderRef = TJsonReaderFactory<TCHAR>::Create(NewPayload);
-	if (!FJsonSerializer::Deserialize(JsonReaderRef, JsonData))
-	{
-		return TArray<FString>();
-	}
+	TArray<FInventoryProviderRecord> InventoryProviders;
+	FInventoryProviderStore::FromFileContent(NewPayload, InventoryProviders);
 
 	TArray<FString> OutProviders;
+	OutProviders.Reserve(InventoryProviders.Num());
 
-	const TArray<TSharedPtr<FJsonValue>> InventoryProviders = JsonData->GetArrayField(TEXT("InventoryProviders"));
-	for (const auto& InventoryProvider : InventoryProviders)
+	for (const FInventoryProviderRecord& InventoryProvider : InventoryProviders)
 	{
-		OutProviders.Add(InventoryProvider->AsString());
+		FInventoryProviderStore::ToString(InventoryProvider, OutProviders.AddDefaulted_GetRef());
 	}
 
 	return OutProviders;
@@ -320,27 +180,21 @@ TArray<FString> UInventoryUtils::GetInventoryProviderPayloads(const FString& New
 FString UInventoryUtils::GetInventoryProviderById(const FString& NewPayload,
                                                   const int32 NewProviderId)
 {
-	const TArray<FString> InventoryProviders = UInventoryUtils::GetInventoryProviderPayloads(NewPayload);
-	if (InventoryProviders.IsEmpty())
-	{
-		return FString();
-	}
+	TArray<FInventoryProviderRecord> InventoryProviders;
+	FInventoryProviderStore::FromFileContent(NewPayload, InventoryProviders);
 
-	const FString* SearchResult = InventoryProviders.FindByPredicate([SearchId = NewProviderId](const FString& Payload)
+	const auto* SearchResult = InventoryProviders.FindByPredicate([SearchId = NewProviderId](const FInventoryProviderRecord& Provider)
 	{
-		NSJsonInventory::FJsonInventoryProvider OutProvider;
-		NSJsonInventory::FromString(Payload, OutProvider);
-		return (false == (OutProvider.Id ^ SearchId));
+		return (false == (Provider.Id ^ SearchId));
 	});
 
+	FString OutProvider;
 	if (SearchResult != nullptr)
 	{
-		return *SearchResult;
-	}
-	else
-	{
-		return TEXT("");
+		FInventoryProviderStore::ToString(*SearchResult, OutProvider);
 	}
+
+	return OutProvider;
 }
 
 TArray<FDataRegistryId> UInventoryUtils::TranslatePrivateItemId(const TArray<int32>& NewPrivateItemIds)
@@ -401,13 +255,13 @@ TArray<FDataRegistryId> UInventoryUtils::TranslatePrivateItemId(const TArray<int
 
 TArray<FDataRegistryId> UInventoryUtils::GetProviderInventoryRegistryIds(const int32 NewProviderId)
 {
-	const FStringView FileContent = UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, {});
-	const FString SearchPayload = UInventoryUtils::GetInventoryProviderById(FileContent.GetData(), NewProviderId);
-
-	NSJsonInventory::FJsonInventoryProvider OutProvider;
-	NSJsonInventory::FromString(SearchPayload, OutProvider);
+	const FInventoryProviderRecord* SearchResult = FInventoryProviderStore::Get().Find(NewProviderId);
+	if (SearchResult == nullptr)
+	{
+		return TArray<FDataRegistryId>{};
+	}
 
-	const TArray<FDataRegistryId> OutResults = TranslatePrivateItemId(OutProvider.PrivateItemIds);
+	const TArray<FDataRegistryId> OutResults = TranslatePrivateItemId(SearchResult->PrivateItemIds);
 	return OutResults;
 }
 
@@ -421,14 +275,14 @@ TArray<FDataRegistryId> UInventoryUtils::GetBackendProviderInventoryRegistryIds(
 
 TArray<FDataRegistryId> UInventoryUtils::GetProviderLoadoutRegistryIds(const int32 NewProviderId)
 {
-	const FStringView FileContent = UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, {});
-	const FString SearchPayload = UInventoryUtils::GetInventoryProviderById(FileContent.GetData(), NewProviderId);
-
-	NSJsonInventory::FJsonInventoryProvider OutProvider;
-	NSJsonInventory::FromString(SearchPayload, OutProvider);
+	const FInventoryProviderRecord* SearchResult = FInventoryProviderStore::Get().Find(NewProviderId);
+	if (SearchResult == nullptr)
+	{
+		return TArray<FDataRegistryId>{};
+	}
 
 	TArray<int32> PrivateItemIds;
-	OutProvider.Loadout.GenerateValueArray(PrivateItemIds);
+	SearchResult->Loadout.GenerateValueArray(PrivateItemIds);
 
 	const TArray<FDataRegistryId> OutResults = TranslatePrivateItemId(PrivateItemIds);
 	return OutResults;
@@ -447,8 +301,8 @@ void UInventoryUtils::GetInventoryProvider(const FString& NewPayload,
                                            TMap<FGameplayTag, int32>& OutLoadout,
                                            TArray<int32>& OutPrivateItemIds)
 {
-	NSJsonInventory::FJsonInventoryProvider OutProvider;
-	NSJsonInventory::FromString(NewPayload, OutProvider);
+	FInventoryProviderRecord OutProvider;
+	FInventoryProviderStore::FromString(NewPayload, OutProvider);
 
 	OutProviderId = OutProvider.Id;
 	OutLoadout = OutProvider.Loadout;
@@ -495,10 +349,17 @@ int32 UInventoryUtils::GetItemPrivateId(const FString& NewPayload,
                                         const TArray<int32>& NewPrivateIds,
                                         const int32 PhysicalGlobalId)
 {
-	NSJsonInventory::FJsonInventoryProvider OutProvider;
-	NSJsonInventory::FromString(NewPayload, OutProvider);
+	FInventoryProviderRecord OutProvider;
+	FInventoryProviderStore::FromString(NewPayload, OutProvider);
 
-	TArray<int32> FilteredSet = OutProvider.PrivateItemIds;
+	return UInventoryUtils::GetItemPrivateIdFromRecord(OutProvider, NewPrivateIds, PhysicalGlobalId);
+}
+
+int32 UInventoryUtils::GetItemPrivateIdFromRecord(const FInventoryProviderRecord& NewProvider,
+                                                  const TArray<int32>& NewPrivateIds,
+                                                  const int32 PhysicalGlobalId)
+{
+	TArray<int32> FilteredSet = NewProvider.PrivateItemIds;
 	for (const int32 PrivateId : NewPrivateIds)
 	{
 		FilteredSet.Remove(PrivateId);
@@ -526,8 +387,8 @@ int32 UInventoryUtils::GetItemPrivateIdUsingStoragePosition(const FString& NewPa
                                                             const TArray<int32>& NewPrivateIds,
                                                             const int32 ItemStoragePosition)
 {
-	NSJsonInventory::FJsonInventoryProvider OutProvider;
-	NSJsonInventory::FromString(NewPayload, OutProvider);
+	FInventoryProviderRecord OutProvider;
+	FInventoryProviderStore::FromString(NewPayload, OutProvider);
 
 	TArray<int32> FilteredSet = OutProvider.PrivateItemIds;
 	for (const int32 PrivateId : NewPrivateIds)
@@ -635,10 +496,16 @@ FGameplayTag UInventoryUtils::GetItemSlotTag(const UObject* Outer,
 FGameplayTag UInventoryUtils::GetItemSlotTagFromPayload(const FString& NewPayload,
                                                         const int32 PrivateItemId)
 {
-	NSJsonInventory::FJsonInventoryProvider OutProvider;
-	NSJsonInventory::FromString(NewPayload, OutProvider);
+	FInventoryProviderRecord OutProvider;
+	FInventoryProviderStore::FromString(NewPayload, OutProvider);
 
-	const auto* SearchResult = OutProvider.Loadout.FindKey(PrivateItemId);
+	return UInventoryUtils::GetItemSlotTagFromRecord(OutProvider, PrivateItemId);
+}
+
+FGameplayTag UInventoryUtils::GetItemSlotTagFromRecord(const FInventoryProviderRecord& NewProvider,
+                                                       const int32 PrivateItemId)
+{
+	const auto* SearchResult = NewProvider.Loadout.FindKey(PrivateItemId);
 	if (SearchResult != nullptr)
 	{
 		return *SearchResult;
@@ -23,8 +23,8 @@
 #include "AVVMLogger.h"
 #include "AVVMSocketTargetingHelper.h"
 #include "AVVMToolkitUtils.h"
-#include "AVVMSaveGame.h"
 #include "InventoryManagerSubsystem.h"
+#include "InventoryProviderStore.h"
 #include "InventorySampleModule.h"
 #include "InventorySettings.h"
 #include "InventoryUtils.h"
@@ -45,9 +45,6 @@
 #include "Resources/AVVMResourceProvider.h"
 #include "Tags/PrivateTags.h"
 
-// @gdemers external linkage for property FName sharing.
-extern const FName InventoryProviderPayloads;
-
 void UItemObject::GetLifetimeReplicatedProps(TArray<class FLifetimeProperty>& OutLifetimeProps) const
 {
 	UObject::GetLifetimeReplicatedProps(OutLifetimeProps);
@@ -545,29 +542,20 @@ int32 UItemObjectUtils::RuntimeInitStaticItem(const UObject* Outer,
 		return INDEX_NONE;
 	}
 
-	// @gdemers lambda to conditionally generate our default provider content
-	// for serialization to disk.
-	static const auto GenerateDefaultContent = []()
-	{
-		return UInventoryUtils::CreateDefaultInventoryProviders();
-	};
-
-	// @gdemers get-set file from disk caching all inventory providers representation.
-	const FStringView FileContent = UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, GenerateDefaultContent);
-
-	// @gdemers fetch provider payload from disk representation.
-	const FString InventoryProviderPayload = UInventoryUtils::GetInventoryProviderById(FileContent.GetData(), TargetUniqueId);
-	if (InventoryProviderPayload.IsEmpty())
+	// @gdemers fetch provider from the store caching all inventory providers representation. default content is generated
+	// on first access.
+	const FInventoryProviderRecord* InventoryProvider = FInventoryProviderStore::Get().Find(TargetUniqueId);
+	if (InventoryProvider == nullptr)
 	{
 		return INDEX_NONE;
 	}
 
-	// @gdemers read private item id from payload.
-	const int32 PrivateItemId = UInventoryUtils::GetItemPrivateId(InventoryProviderPayload, NewPrivateIds, PhysicalGlobalId);
+	// @gdemers read private item id from provider.
+	const int32 PrivateItemId = UInventoryUtils::GetItemPrivateIdFromRecord(*InventoryProvider, NewPrivateIds, PhysicalGlobalId);
 	const int32 ItemCount = UItemObjectUtils::GetItemStartupStackCount(UnInitializedItemObject, PrivateItemId);
 	const int32 StorageId = UAVVMOnlineEncodingUtils::DecodeInt32(PrivateItemId, GET_STORAGE_VIRTUAL_GLOBAL_ID_BIT_RANGE,GET_STORAGE_VIRTUAL_GLOBAL_ID_RSHIFT);
 	const int32 StoragePosition = UAVVMOnlineEncodingUtils::DecodeInt32(PrivateItemId, GET_STORAGE_POSITION_BIT_RANGE,GET_STORAGE_POSITION_RSHIFT);
-	const FGameplayTag SlotTag = UInventoryUtils::GetItemSlotTagFromPayload(InventoryProviderPayload, PrivateItemId);
+	const FGameplayTag SlotTag = UInventoryUtils::GetItemSlotTagFromRecord(*InventoryProvider, PrivateItemId);
 	UnInitializedItemObject->ModifyRuntimeStackCount(ItemCount);
 	UnInitializedItemObject->ModifyRuntimeStorageId(StorageId);
 	UnInitializedItemObject->ModifyRuntimeStoragePosition(StoragePosition);
@@ -19,14 +19,19 @@
 //SOFTWARE.
 #include "ActorInventoryComponent.h"
 #include "AutomatedTestInventoryActor.h"
+#include "AVVMFileHelper.h"
 #include "AVVMGameplaySettings.h"
 #include "AVVMSaveGame.h"
+#include "AVVMToolkitSettings.h"
 #include "DataRegistrySubsystem.h"
+#include "InventoryProviderStore.h"
 #include "InventoryUtils.h"
 #include "NativeGameplayTags.h"
 #include "Data/AVVMActorIdentifierTableRow.h"
+#include "Dom/JsonObject.h"
 #include "Engine/AssetManager.h"
 #include "Misc/AutomationTest.h"
+#include "Serialization/JsonSerializer.h"
 
 #if WITH_AUTOMATION_TESTS
 #include "Tests/AutomationCommon.h"
@@ -50,6 +55,33 @@ namespace
 	{
 		return Function();
 	}
+
+	bool IsRecordEqual(const FInventoryProviderRecord* Lhs, const FInventoryProviderRecord& Rhs)
+	{
+		return (Lhs != nullptr)
+			&& (Lhs->Id == Rhs.Id)
+			&& Lhs->Loadout.OrderIndependentCompareEqual(Rhs.Loadout)
+			&& (Lhs->PrivateItemIds == Rhs.PrivateItemIds);
+	}
+
+	// @gdemers previous disk format. each provider is a JSON document nested in a string.
+	FString ToLegacyFileContent(const TArray<FInventoryProviderRecord>& NewRecords)
+	{
+		TArray<TSharedPtr<FJsonValue>> InventoryProviders;
+		for (const FInventoryProviderRecord& Record : NewRecords)
+		{
+			FString OutProvider;
+			FInventoryProviderStore::ToString(Record, OutProvider);
+			InventoryProviders.Add(MakeShared<FJsonValueString>(OutProvider));
+		}
+
+		const TSharedRef<FJsonObject> JsonData = MakeShared<FJsonObject>();
+		JsonData->SetArrayField(TEXT("InventoryProviders"), InventoryProviders);
+
+		FString OutFormat;
+		FJsonSerializer::Serialize(JsonData, TJsonWriterFactory<>::Create(&OutFormat));
+		return OutFormat;
+	}
 }
 
 // @gdemers external linkage for property FName sharing.
@@ -347,4 +379,129 @@ bool InventorySampleTest::RunTest(const FString& Parameters)
 	LatentCleanup();
 #endif
 	return true;
-}
\ No newline at end of file
+}
+
+/**
+ *	Class description:
+ *	
+ *	InventoryProviderStoreTest is an Automated Test reading a legacy provider payload, writing it back in the current format, and validating
+ *	that FInventoryProviderStore only reload once the payload is replaced from outside the store, and that its modifications are saved.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(InventoryProviderStoreTest, "AutomatedTest.CustomGroup.InventoryProviderStoreTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool InventoryProviderStoreTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	TArray<FInventoryProviderRecord> Records;
+
+	FInventoryProviderRecord& Record_A = Records.AddDefaulted_GetRef();
+	Record_A.Id = 1;
+	Record_A.Loadout.Add(TAG_INVENTORYSAMPLE_AUTOMATED_TEST, 3);
+	Record_A.PrivateItemIds = {3, 4, 5};
+
+	FInventoryProviderRecord& Record_B = Records.AddDefaulted_GetRef();
+	Record_B.Id = 2;
+	Record_B.PrivateItemIds = {6};
+
+	// @gdemers legacy payload read, and written back in the current format.
+	const FString LegacyContent = ToLegacyFileContent(Records);
+
+	TArray<FInventoryProviderRecord> OutLegacyRecords;
+	FInventoryProviderStore::FromFileContent(LegacyContent, OutLegacyRecords);
+	TestEqual("Legacy Records Num", OutLegacyRecords.Num(), Records.Num());
+	for (int32 i = 0; i < FMath::Min(Records.Num(), OutLegacyRecords.Num()); ++i)
+	{
+		TestTrue("Legacy Record Equality", IsRecordEqual(&OutLegacyRecords[i], Records[i]));
+	}
+
+	const FString FileContent = FInventoryProviderStore::ToFileContent(OutLegacyRecords);
+	TestNotEqual("Legacy Format Upgraded", FileContent, LegacyContent);
+
+	TArray<FInventoryProviderRecord> OutRecords;
+	FInventoryProviderStore::FromFileContent(FileContent, OutRecords);
+	TestEqual("Records Num", OutRecords.Num(), Records.Num());
+	for (int32 i = 0; i < FMath::Min(Records.Num(), OutRecords.Num()); ++i)
+	{
+		TestTrue("Record Equality", IsRecordEqual(&OutRecords[i], Records[i]));
+	}
+
+	TestEqual("Stable Format", FInventoryProviderStore::ToFileContent(OutRecords), FileContent);
+
+	// @gdemers keep whatever the editor save game held, and restore it once done.
+	const FString PrevContent(UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, []()
+	{
+		return UInventoryUtils::CreateDefaultInventoryProviders();
+	}));
+
+	// @gdemers replacing the payload bump its revision. the store reload on next access.
+	UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, [&LegacyContent]()
+	{
+		return LegacyContent;
+	}, true);
+
+	FInventoryProviderStore& Store = FInventoryProviderStore::Get();
+	TestTrue("Reload Legacy Record_A", IsRecordEqual(Store.Find(Record_A.Id), Record_A));
+	TestTrue("Reload Legacy Record_B", IsRecordEqual(Store.Find(Record_B.Id), Record_B));
+
+	// @gdemers modifications go through the deferred serialization, and leave the revision untouched.
+	const uint32 Revision = UAVVMSaveGame::Static_GetPayloadRevision(InventoryProviderPayloads);
+
+	FInventoryProviderRecord ModifiedRecord_A = Record_A;
+	ModifiedRecord_A.PrivateItemIds = {7, 8};
+
+	Store.ModifyPrivateItemIds(Record_A.Id, ModifiedRecord_A.PrivateItemIds);
+	TestTrue("Modified Record_A", IsRecordEqual(Store.Find(Record_A.Id), ModifiedRecord_A));
+
+	TArray<FInventoryProviderRecord> OutFlattenedRecords;
+	FInventoryProviderStore::FromFileContent(FString(UAVVMSaveGame::Static_GetSetFileContent(InventoryProviderPayloads, {})), OutFlattenedRecords);
+
+	const auto* FlattenedRecord_A = OutFlattenedRecords.FindByPredicate([SearchId = Record_A.Id](const FInventoryProviderRecord& Record)
+	{
+		return (Record.Id == SearchId);
+	});
+
+	TestTrue("Flattened Record_A", IsRecordEqual(FlattenedRecord_A, ModifiedRecord_A));
+	TestEqual("Revision after Flatten", UAVVMSaveGame::Static_GetPayloadRevision(InventoryProviderPayloads), Revision);
+	TestTrue("Flattened Record_A not reloaded", IsRecordEqual(Store.Find(Record_A.Id), ModifiedRecord_A));
+
+	// @gdemers a modification schedule a save. once it fire, the deferred payload is flushed, and written through HandlePreSave.
+	auto* SaveGame = UAVVMFileHelper::Static_GetSetSaveGame();
+	if (TestNotNull("UAVVMSaveGame", SaveGame))
+	{
+		FInventoryProviderRecord SavedRecord_A = Record_A;
+		SavedRecord_A.PrivateItemIds = {9};
+
+		Store.ModifyPrivateItemIds(Record_A.Id, SavedRecord_A.PrivateItemIds);
+		TestTrue("Save Marked Dirty", SaveGame->bIsMarkedDirty);
+		TestTrue("Save Scheduled", SaveGame->ScheduledSaveHandle.IsValid());
+
+		SaveGame->TickScheduledSave(UAVVMToolkitSettings::GetScheduledSaveDelay());
+		TestFalse("Save Marked Dirty after Save", SaveGame->bIsMarkedDirty);
+		TestFalse("Save Scheduled after Save", SaveGame->ScheduledSaveHandle.IsValid());
+
+		const FString* SavedContent = SaveGame->PrevPayloadPerType.Find(InventoryProviderPayloads);
+		if (TestNotNull("Saved Payload", SavedContent))
+		{
+			TArray<FInventoryProviderRecord> OutSavedRecords;
+			FInventoryProviderStore::FromFileContent(*SavedContent, OutSavedRecords);
+
+			const auto* SavedRecord = OutSavedRecords.FindByPredicate([SearchId = Record_A.Id](const FInventoryProviderRecord& Record)
+			{
+				return (Record.Id == SearchId);
+			});
+
+			TestTrue("Saved Record_A", IsRecordEqual(SavedRecord, SavedRecord_A));
+		}
+
+		TestEqual("Revision after Save", UAVVMSaveGame::Static_GetPayloadRevision(InventoryProviderPayloads), Revision);
+	}
+
+	// @gdemers an explicit payload override the store content.
+	UAVVMSaveGame::Static_Serialize(InventoryProviderPayloads, FInventoryProviderStore::ToFileContent({Record_B}));
+	TestNotEqual("Revision after Serialize", UAVVMSaveGame::Static_GetPayloadRevision(InventoryProviderPayloads), Revision);
+	TestNull("Reload Record_A", Store.Find(Record_A.Id));
+	TestTrue("Reload Record_B", IsRecordEqual(Store.Find(Record_B.Id), Record_B));
+
+	UAVVMSaveGame::Static_Serialize(InventoryProviderPayloads, PrevContent);
+#endif
+	return true;
+}
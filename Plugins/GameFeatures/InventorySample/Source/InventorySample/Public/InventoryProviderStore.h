@@ -0,0 +1,72 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#pragma once
+
+#include "CoreMinimal.h"
+
+#include "GameplayTagContainer.h"
+
+class UAVVMSaveGame;
+
+/**
+ *	Class description:
+ *
+ *	FInventoryProviderRecord is the in-memory representation of an inventory provider serialized to disk.
+ */
+struct INVENTORYSAMPLE_API FInventoryProviderRecord
+{
+	int32 Id = INDEX_NONE;
+	TMap<FGameplayTag, int32> Loadout;
+	TArray<int32> PrivateItemIds;
+};
+
+/**
+ *	Class description:
+ *
+ *	FInventoryProviderStore is a singleton cache of all inventory providers, indexed by provider id. It's loaded once from UAVVMSaveGame,
+ *	and reloaded only when the payload is replaced from outside the store (i.e - default content, new save game, load). Modifications only
+ *	touch the provider entry, flattening the store back into a single document is deferred until UAVVMSaveGame read, or save, the payload.
+ *
+ *	Disk format : {"InventoryProviders":[{"Id":0,"Loadout":[{"SlotTag":"","PrivateItemId":0}],"PrivateItemIds":[]}]}. Legacy payloads,
+ *	where each provider is a JSON document nested in a string, are still read.
+ */
+class INVENTORYSAMPLE_API FInventoryProviderStore
+{
+public:
+	static FInventoryProviderStore& Get();
+
+	// @gdemers pointer is invalidated by the next modification, or reload.
+	const FInventoryProviderRecord* Find(const int32 ProviderId);
+	void ModifyPrivateItemIds(const int32 ProviderId, const TArray<int32>& NewPrivateItemIds);
+
+	static void ToString(const FInventoryProviderRecord& NewRecord, FString& OutFormat);
+	static void FromString(const FString& NewPayload, FInventoryProviderRecord& OutRecord);
+
+	static FString ToFileContent(const TArray<FInventoryProviderRecord>& NewRecords);
+	static void FromFileContent(const FString& NewPayload, TArray<FInventoryProviderRecord>& OutRecords);
+
+private:
+	bool LoadIfStale();
+	FString Flatten() const;
+
+	TMap<int32, FInventoryProviderRecord> Providers;
+	TWeakObjectPtr<const UAVVMSaveGame> LoadedSaveGame = nullptr;
+	uint32 LoadedRevision = 0;
+};
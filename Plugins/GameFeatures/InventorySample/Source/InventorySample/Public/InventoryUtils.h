@@ -27,6 +27,7 @@
 #include "InventoryUtils.generated.h"
 
 struct FDataRegistryId;
+struct FInventoryProviderRecord;
 struct FStorageHelper;
 class UItemObject;
 
@@ -94,6 +95,10 @@ public:
 	                              const TArray<int32>& NewPrivateIds,
 	                              const int32 PhysicalGlobalId);
 
+	static int32 GetItemPrivateIdFromRecord(const FInventoryProviderRecord& NewProvider,
+	                                        const TArray<int32>& NewPrivateIds,
+	                                        const int32 PhysicalGlobalId);
+
 	UFUNCTION(BlueprintCallable)
 	static int32 GetItemPrivateIdUsingStoragePosition(const FString& NewPayload,
 	                                                  const TArray<int32>& NewPrivateIds,
@@ -120,6 +125,9 @@ public:
 	static FGameplayTag GetItemSlotTagFromPayload(const FString& NewPayload,
 	                                              const int32 PrivateItemId);
 
+	static FGameplayTag GetItemSlotTagFromRecord(const FInventoryProviderRecord& NewProvider,
+	                                             const int32 PrivateItemId);
+
 	UFUNCTION(BlueprintCallable)
 	static TArray<int32> GetRuntimeUniqueIds(const TArray<UItemObject*>& Items);
 };
@@ -87,13 +87,9 @@ void UGameStateTeamComponent::BeginPlay()
 	{
 		GetTeamRuleOnAuthority();
 
-		FAVVMOnChannelNotifiedSingleCastDelegate Callback;
-		Callback.BindDynamic(this, &UGameStateTeamComponent::OnPlayerStateAddedOrRemoved);
-
-		FAVVMObserverContextArgs ContextArgs;
-		ContextArgs.ChannelTag = PlayerStateChannelTag;
-		ContextArgs.Callback = Callback;
-		UAVVMNotificationSubsystem::Static_RegisterObserver(this, ContextArgs);
+		UAVVMNotificationSubsystem::Static_RegisterNativeObserver(this,
+		                                                          PlayerStateChannelTag,
+		                                                          FAVVMOnChannelNotifiedNativeDelegate::CreateUObject(this, &UGameStateTeamComponent::OnPlayerStateAddedOrRemoved));
 		
 		auto* GameMode = Cast<AAVVMGameMode>(Outer->AuthorityGameMode);
 		if (IsValid(GameMode))
@@ -137,9 +133,7 @@ void UGameStateTeamComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 #if WITH_SERVER_CODE
 	if (Outer->HasAuthority())
 	{
-		FAVVMObserverContextArgs ContextArgs;
-		ContextArgs.ChannelTag = PlayerStateChannelTag;
-		UAVVMNotificationSubsystem::Static_UnregisterObserver(this, ContextArgs);
+		UAVVMNotificationSubsystem::Static_UnregisterNativeObserver(this, PlayerStateChannelTag);
 		
 		auto* GameMode = Cast<AAVVMGameMode>(Outer->AuthorityGameMode);
 		if (IsValid(GameMode))
@@ -20,7 +20,6 @@
 #include "Data/ProjectileDefinitionDataAsset.h"
 
 #include "NonReplicatedProjectileActor.h"
-#include "Kismet/GameplayStatics.h"
 
 void FProjectileParams::Init(ANonReplicatedProjectileActor* Projectile,
                              const TArray<AActor*>& IgnoredActors) const
@@ -30,21 +29,10 @@ void FProjectileParams::Init(ANonReplicatedProjectileActor* Projectile,
 		return;
 	}
 
-	const FTransform& ProjectileWorldTransform = Projectile->GetTransform();
-	const FVector NormalizedDirection = ProjectileWorldTransform.Rotator().Vector();
-
-	auto Params = FPredictProjectilePathParams(Radius, ProjectileWorldTransform.GetLocation(), (NormalizedDirection * Speed), MaxSimTime, ECollisionChannel::ECC_Visibility);
-	Params.ActorsToIgnore.Append(IgnoredActors);
-
-	FPredictProjectilePathResult OutResult;
-	const bool bIsBlockingHit = UGameplayStatics::PredictProjectilePath(Projectile, Params, OutResult);
-
+	// @gdemers trajectory is integrated by UProjectileManagerSubsystem, from the spawn transform. no path prediction required.
 	Projectile->ProjectileTemplate = TInstancedStruct<FProjectileParams>::Make(*this);
-	Projectile->bDoesPredictBlockingHit = bIsBlockingHit;
-	Projectile->PredictedPathResult = OutResult;
-
-	// TODO @gdemers we may want to not tick and kill right away if theres no blocking hit.
-	Projectile->SetActorTickEnabled(true);
+	Projectile->CollisionParams = FCollisionQueryParams(SCENE_QUERY_STAT(ProjectileSweep), false, Projectile);
+	Projectile->CollisionParams.AddIgnoredActors(IgnoredActors);
 }
 
 UScriptStruct* TBaseStructure<FProjectileParams>::Get()
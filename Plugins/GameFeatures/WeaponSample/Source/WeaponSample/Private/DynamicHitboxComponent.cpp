@@ -20,6 +20,7 @@
 #include "DynamicHitBoxComponent.h"
 
 #include "AVVMCharacter.h"
+#include "AVVMPositionSamplerSubsystem.h"
 #include "TimerManager.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "GameFramework/Character.h"
@@ -49,12 +50,19 @@ void UDynamicHitboxComponent::BeginPlay()
 	MovementComponent = Character->GetMovementComponent();
 	SkeletalMeshComponent = Character->GetMesh();
 	OuterCharacter = Character;
+
+	if (bRecordPoseHistory && Character->HasAuthority())
+	{
+		UAVVMPositionSamplerSubsystem::Static_RegisterPoseHistory(Character);
+	}
 }
 
 void UDynamicHitboxComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
 	Super::EndPlay(EndPlayReason);
 
+	UAVVMPositionSamplerSubsystem::Static_UnregisterPoseHistory(OuterCharacter.Get());
+
 	MovementComponent.Reset();
 	SkeletalMeshComponent.Reset();
 	OuterCharacter.Reset();
@@ -27,14 +27,79 @@
 #include "Engine/World.h"
 #include "GameFramework/PlayerController.h"
 
+// @gdemers fused multiply-add contraction is disabled for this translation unit. its availability differ between platforms,
+// and would break bit-exact trajectories between server, and client. ProjectileManagerSubsystem.cpp integrate the same
+// trajectories, and disable it too.
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+
+namespace NSProjectileBallisticCoefficients
+{
+	// @gdemers exp(-X) for X >= 0, from add, multiply, and divide only. those are correctly rounded on every platform, where
+	// libm Exp may differ in the last bit.
+	static double NegExp(const double X)
+	{
+		// @gdemers underflows to zero.
+		if (X >= 745.0)
+		{
+			return 0.0;
+		}
+
+		// @gdemers range reduction, exp(-X) = exp(-X / 2^N)^(2^N). scaling by a power of two is exact.
+		int32 NumSquarings = 0;
+		double R = X;
+		while (R > 0.0625)
+		{
+			R *= 0.5;
+			++NumSquarings;
+		}
+
+		// @gdemers taylor series to degree 10, in horner form. truncation stays below half an ulp for R <= 1/16.
+		double Result = 1.0;
+		for (int32 i = 10; i >= 1; --i)
+		{
+			const double Term = ((-R / i) * Result);
+			Result = (1.0 + Term);
+		}
+
+		for (int32 i = 0; i < NumSquarings; ++i)
+		{
+			Result *= Result;
+		}
+
+		return Result;
+	}
+}
+
+FProjectileBallisticCoefficients::FProjectileBallisticCoefficients(const double Drag, const double GravityZ, const double TimeStep)
+{
+	if (Drag > UE_DOUBLE_SMALL_NUMBER)
+	{
+		// @gdemers V(h) = g/k + (V0 - g/k) * exp(-k * h), and P(h) its integral.
+		Decay = NSProjectileBallisticCoefficients::NegExp(Drag * TimeStep);
+		VelocityFactor = ((1.0 - Decay) / Drag);
+		GravityPositionDelta = (((TimeStep - VelocityFactor) / Drag) * GravityZ);
+	}
+	else
+	{
+		// @gdemers drag-free limit. regular projectile motion.
+		Decay = 1.0;
+		VelocityFactor = TimeStep;
+		GravityPositionDelta = (0.5 * TimeStep * TimeStep * GravityZ);
+	}
+
+	GravityVelocityDelta = (VelocityFactor * GravityZ);
+}
+
 ANonReplicatedProjectileActor::ANonReplicatedProjectileActor(const FObjectInitializer& ObjectInitializer)
 	: Super(ObjectInitializer)
 {
 	// @gdemers Our current solution involve projectile simulation on both server, and client. (separate, later with validation)
-	PrimaryActorTick.bCanEverTick = true;
-	PrimaryActorTick.bStartWithTickEnabled = false;
-	PrimaryActorTick.bAllowTickBatching = true;
-	PrimaryActorTick.bAllowTickOnDedicatedServer = true;
+	// simulation is stepped by UProjectileManagerSubsystem, the actor doesnt tick.
+	PrimaryActorTick.bCanEverTick = false;
 	SetReplicateMovement(false);
 	bReplicates = false;
 }
@@ -51,58 +116,24 @@ void ANonReplicatedProjectileActor::EndPlay(const EEndPlayReason::Type EndPlayRe
 	UProjectileManagerSubsystem::Static_Unregister(GetWorld(), this);
 }
 
-void ANonReplicatedProjectileActor::Tick(float DeltaSeconds)
+void ANonReplicatedProjectileActor::OnAcquiredFromPool()
 {
-	Super::Tick(DeltaSeconds);
-
-	PointDataIndex = FMath::Clamp(PointDataIndex, 0, PredictedPathResult.PathData.Num() - 1);
-	const FPredictProjectilePathPointData& PointData = PredictedPathResult.PathData[PointDataIndex];
-	if (PointData.Time < Timestamp)
-	{
-		++PointDataIndex;
-
-		if (PointDataIndex >= PredictedPathResult.PathData.Num())
-		{
-			Kill();
-		}
-	}
-	else
-	{
-		const UWorld* World = GetWorld();
-		if (!IsValid(World))
-		{
-			return;
-		}
-
-		const FVector CurrentLocation = GetActorLocation();
-		const FVector NextLocation = CurrentLocation + ((PointData.Location - CurrentLocation) * DeltaSeconds);
+	// @gdemers mirror BeginPlay. pooled instances don't run it again.
+	UProjectileManagerSubsystem::Static_Register(GetWorld(), this);
+}
 
-		FHitResult OutHitResult;
-		const bool bIsBlockingHit = World->SweepSingleByChannel(OutHitResult,
-		                                                        CurrentLocation,
-		                                                        NextLocation,
-		                                                        FQuat::Identity,
-		                                                        GetCollisionChannel(),
-		                                                        GetCollisionShape(),
-		                                                        GetCollisionParams());
+void ANonReplicatedProjectileActor::OnReleasedToPool()
+{
+	UProjectileManagerSubsystem::Static_Unregister(GetWorld(), this);
 
-		if (bIsBlockingHit)
-		{
-			HandleHit(OutHitResult);
-			Kill();
-		}
-		else
-		{
-			// TODO @gdemers Require Rollback behaviour here on hit detection, or server/client reconciliation.
-			SetActorLocation(NextLocation);
-			Timestamp += DeltaSeconds;
-		}
-	}
+	ProjectileTemplate.Reset();
+	ExplosionTemplate.Reset();
+	CollisionParams = FCollisionQueryParams::DefaultQueryParam;
 }
 
 const FCollisionQueryParams& ANonReplicatedProjectileActor::GetCollisionParams() const
 {
-	return FCollisionQueryParams::DefaultQueryParam;
+	return CollisionParams;
 }
 
 const FCollisionShape ANonReplicatedProjectileActor::GetCollisionShape() const
@@ -143,35 +174,28 @@ void ANonReplicatedProjectileActor::HandleHit(const FHitResult& HitResult)
 void ANonReplicatedProjectileActor::Kill()
 {
 	OnProjectileShutdown.Broadcast(this);
-	SetActorTickEnabled(false);
 }
 
-FVector UProjectileFunctionLibrary::GetDeltaVelocity(const FVector& Velocity,
-                                                     const float Mass,
-                                                     const float DeltaTime)
+void UProjectileFunctionLibrary::EvaluateBallisticTrajectory(const TInstancedStruct<FProjectileParams>& Params,
+                                                              const FVector& Location,
+                                                              const FVector& Velocity,
+                                                              const float Time,
+                                                              FVector& OutLocation,
+                                                              FVector& OutVelocity)
 {
-	check(FMath::IsNearlyZero(Mass));
-
-	static constexpr float GravityFactor = 9800.f;
-	const float GravityAcceleration = (-GravityFactor / Mass);
-
-	// @gdemers x-component is forward.
-	// @gdemers y-component is right.
-	// @gdemers z-component is up.
-	const FVector YX = Velocity.Projection();
-	const FVector XZ = FVector(Velocity.Z, Velocity.X, Velocity.Y).Projection();
-	const FVector ZX = FVector(Velocity.X, Velocity.Z, -Velocity.Y).Projection();
-	const float MagYX = YX.Size();
-	const float MagXZ = XZ.Size();
-	const float MagZX = ZX.Size();
+	OutLocation = Location;
+	OutVelocity = Velocity;
 
-	// @gdemers calculate displacement for each component axis. to do this, we have to project in 2d space.
-	const float DeltaY = ((MagYX * YX.CosineAngle2D(FVector::RightVector)) * DeltaTime);
-	const float DeltaX = ((MagXZ * XZ.CosineAngle2D(FVector::RightVector)) * DeltaTime);
-	const float DeltaZ = ((MagZX * ZX.CosineAngle2D(FVector::RightVector)) * DeltaTime) - (0.5f * GravityAcceleration * DeltaTime * DeltaTime);
+	const auto* ProjectileParams = Params.GetPtr<FProjectileParams>();
+	if (ProjectileParams == nullptr)
+	{
+		return;
+	}
 
-	// @gdemers output delta calculation with components in their correct slots.
-	return FVector(DeltaX, DeltaY, DeltaZ);
+	// @gdemers coefficients are exact for any step, so a single step of Time is the closed-form solution.
+	const FProjectileBallisticCoefficients Coefficients(ProjectileParams->Drag, ProjectileParams->GravityZ, Time);
+	OutLocation += (Velocity * Coefficients.VelocityFactor) + FVector(0.0, 0.0, Coefficients.GravityPositionDelta);
+	OutVelocity = (Velocity * Coefficients.Decay) + FVector(0.0, 0.0, Coefficients.GravityVelocityDelta);
 }
 
 bool UProjectileFunctionLibrary::CheckDistance(const ANonReplicatedProjectileActor* Projectile,
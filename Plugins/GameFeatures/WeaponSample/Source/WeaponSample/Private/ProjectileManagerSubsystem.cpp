@@ -19,6 +19,7 @@
 //SOFTWARE.
 #include "ProjectileManagerSubsystem.h"
 
+#include "AVVMActorPoolSubsystem.h"
 #include "AVVMPlayerState.h"
 #include "NonReplicatedProjectileActor.h"
 #include "Data/ProjectileDefinitionDataAsset.h"
@@ -26,8 +27,28 @@
 #include "GameFramework/GameStateBase.h"
 #include "GameFramework/PlayerState.h"
 #include "Kismet/GameplayStatics.h"
+#include "WeaponSettings.h"
 #include "Tags/AVVMGameplayTags.h"
 
+// @gdemers fused multiply-add contraction is disabled. see NonReplicatedProjectileActor.cpp, both translation units must agree.
+#if defined(__clang__)
+#pragma clang fp contract(off)
+#elif defined(_MSC_VER)
+#pragma fp_contract(off)
+#endif
+
+namespace NSProjectileBallistics
+{
+	// @gdemers VectorRegister4Double width. blocks of NumLanes projectiles are integrated together, remaining ones are scalar.
+	static constexpr int32 NumLanes = 4;
+
+	// @gdemers bound catch-up after a hitch. remaining frame time is dropped rather than simulated in a burst.
+	static constexpr int32 MaxStepsPerFrame = 8;
+
+	// @gdemers lower bound on the configured time step, so a bad config can't stall the game thread.
+	static constexpr double MinFixedTimeStep = (1.0 / 240.0);
+}
+
 bool UProjectileManagerSubsystem::ShouldCreateSubsystem(UObject* Outer) const
 {
 	const auto* World = Cast<UWorld>(Outer);
@@ -39,6 +60,8 @@ void UProjectileManagerSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 	Super::Initialize(Collection);
 
 	ClientPlayerController.Reset();
+	FixedTimeStep = FMath::Max(static_cast<double>(UWeaponSettings::GetProjectileFixedTimeStep()), NSProjectileBallistics::MinFixedTimeStep);
+	StepAccumulator = 0.0;
 
 	auto* GameStateBase = UGameplayStatics::GetGameState(this);
 	if (!IsValid(GameStateBase))
@@ -46,13 +69,9 @@ void UProjectileManagerSubsystem::Initialize(FSubsystemCollectionBase& Collectio
 		return;
 	}
 
-	FAVVMOnChannelNotifiedSingleCastDelegate Callback;
-	Callback.BindDynamic(this, &UProjectileManagerSubsystem::OnPlayerStateAddedOrRemoved);
-
-	FAVVMObserverContextArgs ContextArgs;
-	ContextArgs.ChannelTag = TAG_AVVMGAMEPLAY_GAMESTATE_ONPLAYERSTATE_ADDED_OR_REMOVED;
-	ContextArgs.Callback = Callback;
-	UAVVMNotificationSubsystem::Static_RegisterObserver(GameStateBase, ContextArgs);
+	UAVVMNotificationSubsystem::Static_RegisterNativeObserver(GameStateBase,
+	                                                          TAG_AVVMGAMEPLAY_GAMESTATE_ONPLAYERSTATE_ADDED_OR_REMOVED,
+	                                                          FAVVMOnChannelNotifiedNativeDelegate::CreateUObject(this, &UProjectileManagerSubsystem::OnPlayerStateAddedOrRemoved));
 
 	for (const TObjectPtr<APlayerState>& PlayerState : GameStateBase->PlayerArray)
 	{
@@ -66,19 +85,21 @@ void UProjectileManagerSubsystem::Deinitialize()
 
 	ClientPlayerController.Reset();
 	Projectiles.Reset();
+	Simulation.Reset();
+	PendingSweeps.Reset();
+	StepAccumulator = 0.0;
 
 	auto* GameStateBase = UGameplayStatics::GetGameState(this);
 	if (IsValid(GameStateBase))
 	{
-		FAVVMObserverContextArgs ContextArgs;
-		ContextArgs.ChannelTag = TAG_AVVMGAMEPLAY_GAMESTATE_ONPLAYERSTATE_ADDED_OR_REMOVED;
-		UAVVMNotificationSubsystem::Static_UnregisterObserver(GameStateBase, ContextArgs);
+		UAVVMNotificationSubsystem::Static_UnregisterNativeObserver(GameStateBase, TAG_AVVMGAMEPLAY_GAMESTATE_ONPLAYERSTATE_ADDED_OR_REMOVED);
 	}
 }
 
 void UProjectileManagerSubsystem::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
+	StepSimulation(DeltaTime);
 }
 
 TStatId UProjectileManagerSubsystem::GetStatId() const
@@ -118,7 +139,7 @@ void UProjectileManagerSubsystem::Static_CreateProjectile(const UWorld* World,
 
 void UProjectileManagerSubsystem::Register(ANonReplicatedProjectileActor* Projectile)
 {
-	if (IsValid(Projectile))
+	if (IsValid(Projectile) && !Projectiles.Contains(Projectile))
 	{
 		Projectile->OnProjectileShutdown.AddUObject(this, &UProjectileManagerSubsystem::OnProjectileShutdownRequested);
 		Projectiles.Add(Projectile);
@@ -131,10 +152,11 @@ void UProjectileManagerSubsystem::Unregister(ANonReplicatedProjectileActor* Proj
 	{
 		Projectile->OnProjectileShutdown.RemoveAll(this);
 		Projectiles.RemoveSwap(Projectile);
+		StopSimulation(Projectile);
 	}
 }
 
-void UProjectileManagerSubsystem::CreateProjectile(const FProjectileContextArgs& ContextArgs) const
+void UProjectileManagerSubsystem::CreateProjectile(const FProjectileContextArgs& ContextArgs)
 {
 	const auto* Params = ContextArgs.ProjectileParams.GetPtr<FProjectileParams>();
 	if (Params != nullptr)
@@ -144,6 +166,244 @@ void UProjectileManagerSubsystem::CreateProjectile(const FProjectileContextArgs&
 
 		ANonReplicatedProjectileActor* Instance = Factory(ContextArgs.ProjectileClass, SpawnParams, ContextArgs.AimTransform);
 		Params->Init(Instance, ContextArgs.IgnoredActors);
+		StartSimulation(Instance);
+	}
+}
+
+void UProjectileManagerSubsystem::StartSimulation(ANonReplicatedProjectileActor* Projectile)
+{
+	if (!IsValid(Projectile) || Projectile->SimulationIndex != INDEX_NONE)
+	{
+		return;
+	}
+
+	const auto* Params = Projectile->ProjectileTemplate.GetPtr<FProjectileParams>();
+	if (!ensureAlwaysMsgf(Params != nullptr,
+	                      TEXT("Projectile %s started simulation without FProjectileParams"),
+	                      *Projectile->GetName()))
+	{
+		Projectile->Kill();
+		return;
+	}
+
+	// @gdemers launch state is only derived from the spawn transform, and params, so server and client integrate the same trajectory.
+	// the direction is taken from the quaternion directly. going through a rotator would add trigonometric functions, which
+	// may round differently between platforms.
+	const FTransform& ProjectileWorldTransform = Projectile->GetTransform();
+	const FVector Location = ProjectileWorldTransform.GetLocation();
+	const FVector Velocity = (ProjectileWorldTransform.GetRotation().GetForwardVector() * Params->Speed);
+	const FProjectileBallisticCoefficients Coefficients(Params->Drag, Params->GravityZ, FixedTimeStep);
+
+	Projectile->SimulationIndex = Simulation.Projectiles.Add(Projectile);
+	Simulation.PositionsX.Add(Location.X);
+	Simulation.PositionsY.Add(Location.Y);
+	Simulation.PositionsZ.Add(Location.Z);
+	Simulation.VelocitiesX.Add(Velocity.X);
+	Simulation.VelocitiesY.Add(Velocity.Y);
+	Simulation.VelocitiesZ.Add(Velocity.Z);
+	Simulation.Decays.Add(Coefficients.Decay);
+	Simulation.VelocityFactors.Add(Coefficients.VelocityFactor);
+	Simulation.GravityPositionDeltas.Add(Coefficients.GravityPositionDelta);
+	Simulation.GravityVelocityDeltas.Add(Coefficients.GravityVelocityDelta);
+	Simulation.RemainingSteps.Add(FMath::CeilToInt32(Params->MaxSimTime / FixedTimeStep));
+	Simulation.Serials.Add(++NextSimulationSerial);
+}
+
+void UProjectileManagerSubsystem::StopSimulation(ANonReplicatedProjectileActor* Projectile)
+{
+	if (!IsValid(Projectile) || !Simulation.Projectiles.IsValidIndex(Projectile->SimulationIndex))
+	{
+		return;
+	}
+
+	const int32 SimulationIndex = Projectile->SimulationIndex;
+	if (bIsSteppingSimulation)
+	{
+		// @gdemers keep the slot alive until the end of the pass. an invalid entry is collected as finished.
+		Simulation.Projectiles[SimulationIndex].Reset();
+		Projectile->SimulationIndex = INDEX_NONE;
+		FinishedIndices.Add(SimulationIndex);
+	}
+	else
+	{
+		RemoveSimulationAt(SimulationIndex);
+	}
+}
+
+void UProjectileManagerSubsystem::RemoveSimulationAt(const int32 SimulationIndex)
+{
+	if (!Simulation.Projectiles.IsValidIndex(SimulationIndex))
+	{
+		return;
+	}
+
+	ANonReplicatedProjectileActor* Projectile = Simulation.Projectiles[SimulationIndex].Get();
+	if (IsValid(Projectile))
+	{
+		Projectile->SimulationIndex = INDEX_NONE;
+	}
+
+	Simulation.Projectiles.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.PositionsX.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.PositionsY.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.PositionsZ.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.VelocitiesX.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.VelocitiesY.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.VelocitiesZ.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.Decays.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.VelocityFactors.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.GravityPositionDeltas.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.GravityVelocityDeltas.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.RemainingSteps.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+	Simulation.Serials.RemoveAtSwap(SimulationIndex, 1, EAllowShrinking::No);
+
+	// @gdemers last entry was moved into the freed slot.
+	if (Simulation.Projectiles.IsValidIndex(SimulationIndex))
+	{
+		ANonReplicatedProjectileActor* MovedProjectile = Simulation.Projectiles[SimulationIndex].Get();
+		if (IsValid(MovedProjectile))
+		{
+			MovedProjectile->SimulationIndex = SimulationIndex;
+		}
+	}
+}
+
+void UProjectileManagerSubsystem::StepSimulation(const float DeltaTime)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UProjectileManagerSubsystem::StepSimulation);
+
+	UWorld* World = GetWorld();
+	if (!IsValid(World))
+	{
+		return;
+	}
+
+	// @gdemers sweeps issued last frame are resolved first. projectiles hit are killed, and never stepped again.
+	const bool bUseAsyncSweeps = UWeaponSettings::ShouldUseAsyncProjectileSweeps();
+	ResolvePendingSweeps(World);
+
+	if (Simulation.Num() == 0)
+	{
+		StepAccumulator = 0.0;
+		return;
+	}
+
+	// @gdemers frame time is consumed in fixed steps, so a trajectory doesnt depend on the frame rate of the machine simulating it.
+	StepAccumulator += DeltaTime;
+	const int32 NumSteps = FMath::Min(FMath::FloorToInt32(StepAccumulator / FixedTimeStep), NSProjectileBallistics::MaxStepsPerFrame);
+	if (NumSteps <= 0)
+	{
+		return;
+	}
+
+	StepAccumulator = FMath::Min(StepAccumulator - (NumSteps * FixedTimeStep), FixedTimeStep);
+
+	SweepIndices.Reset();
+	SweepStarts.Reset();
+	SweepEnds.Reset();
+	FinishedIndices.Reset();
+
+	bIsSteppingSimulation = true;
+
+	// @gdemers first pass. snapshot positions, and integrate every projectile at once.
+	SweepStarts.SetNumUninitialized(Simulation.Num());
+	for (int32 i = 0; i < Simulation.Num(); ++i)
+	{
+		SweepStarts[i] = Simulation.GetPosition(i);
+	}
+
+	Simulation.Integrate(NumSteps);
+
+	// @gdemers gather sweep segments. a projectile that ran out of steps is collected one frame later, so a sweep
+	// still pending for its last segment gets resolved.
+	for (int32 i = 0; i < Simulation.Num(); ++i)
+	{
+		if (!Simulation.Projectiles[i].IsValid() || Simulation.RemainingSteps[i] <= 0)
+		{
+			FinishedIndices.Add(i);
+			continue;
+		}
+
+		Simulation.RemainingSteps[i] -= NumSteps;
+		SweepIndices.Add(i);
+		SweepEnds.Add(Simulation.GetPosition(i));
+	}
+
+	// @gdemers second pass. issue all sweeps as a batch and resolve hits.
+	for (int32 j = 0; j < SweepIndices.Num(); ++j)
+	{
+		const int32 i = SweepIndices[j];
+
+		// @gdemers a hit handled earlier in this pass may have released this projectile.
+		ANonReplicatedProjectileActor* Projectile = Simulation.Projectiles[i].Get();
+		if (!IsValid(Projectile))
+		{
+			continue;
+		}
+
+		if (bUseAsyncSweeps)
+		{
+			// @gdemers advance optimistically. a blocking hit is resolved next frame, with one frame of latency.
+			FAsyncProjectileSweep& PendingSweep = PendingSweeps.AddDefaulted_GetRef();
+			PendingSweep.Projectile = Projectile;
+			PendingSweep.Serial = Simulation.Serials[i];
+			PendingSweep.Start = SweepStarts[i];
+			PendingSweep.End = SweepEnds[j];
+			PendingSweep.Handle = World->AsyncSweepByChannel(EAsyncTraceType::Single,
+			                                                 PendingSweep.Start,
+			                                                 PendingSweep.End,
+			                                                 FQuat::Identity,
+			                                                 Projectile->GetCollisionChannel(),
+			                                                 Projectile->GetCollisionShape(),
+			                                                 Projectile->GetCollisionParams());
+
+			Projectile->SetActorLocation(SweepEnds[j]);
+			continue;
+		}
+
+		FHitResult OutHitResult;
+		const bool bIsBlockingHit = World->SweepSingleByChannel(OutHitResult,
+		                                                        SweepStarts[i],
+		                                                        SweepEnds[j],
+		                                                        FQuat::Identity,
+		                                                        Projectile->GetCollisionChannel(),
+		                                                        Projectile->GetCollisionShape(),
+		                                                        Projectile->GetCollisionParams());
+
+		if (bIsBlockingHit)
+		{
+			Projectile->HandleHit(OutHitResult);
+			FinishedIndices.Add(i);
+		}
+		else
+		{
+			// TODO @gdemers Require Rollback behaviour here on hit detection, or server/client reconciliation.
+			Projectile->SetActorLocation(SweepEnds[j]);
+		}
+	}
+
+	bIsSteppingSimulation = false;
+
+	// @gdemers last pass. remove from the highest index so swaps never move an entry that is pending removal.
+	FinishedIndices.Sort(TGreater<int32>());
+
+	int32 PreviousIndex = INDEX_NONE;
+	for (const int32 Index : FinishedIndices)
+	{
+		if (Index == PreviousIndex)
+		{
+			continue;
+		}
+
+		PreviousIndex = Index;
+
+		ANonReplicatedProjectileActor* Projectile = Simulation.Projectiles[Index].Get();
+		RemoveSimulationAt(Index);
+
+		if (IsValid(Projectile))
+		{
+			Projectile->Kill();
+		}
 	}
 }
 
@@ -167,6 +427,164 @@ void UProjectileManagerSubsystem::OnPlayerStateAddedOrRemoved(const TInstancedSt
 	}
 }
 
+void UProjectileManagerSubsystem::ResolvePendingSweeps(UWorld* World)
+{
+	if (PendingSweeps.IsEmpty())
+	{
+		return;
+	}
+
+	// @gdemers swap buffers so Kill callbacks can't mutate the array we iterate.
+	TArray<FAsyncProjectileSweep> Sweeps = MoveTemp(PendingSweeps);
+	PendingSweeps.Reset();
+
+	for (const FAsyncProjectileSweep& Sweep : Sweeps)
+	{
+		// @gdemers the projectile may have finished, or been recycled by the pool, since the sweep was issued.
+		ANonReplicatedProjectileActor* Projectile = Sweep.Projectile.Get();
+		if (!IsValid(Projectile)
+			|| !Simulation.Projectiles.IsValidIndex(Projectile->SimulationIndex)
+			|| Simulation.Serials[Projectile->SimulationIndex] != Sweep.Serial)
+		{
+			continue;
+		}
+
+		FHitResult OutHitResult;
+		bool bIsBlockingHit = false;
+
+		FTraceDatum OutTraceDatum;
+		if (World->QueryTraceData(Sweep.Handle, OutTraceDatum))
+		{
+			const FHitResult* HitResult = OutTraceDatum.OutHits.FindByPredicate([](const FHitResult& Hit)
+			{
+				return Hit.bBlockingHit;
+			});
+
+			if (HitResult != nullptr)
+			{
+				OutHitResult = *HitResult;
+				bIsBlockingHit = true;
+			}
+		}
+		else
+		{
+			// @gdemers result wasn't available (i.e paused world, or frame skipped). fallback on a blocking query so we never tunnel.
+			bIsBlockingHit = World->SweepSingleByChannel(OutHitResult,
+			                                             Sweep.Start,
+			                                             Sweep.End,
+			                                             FQuat::Identity,
+			                                             Projectile->GetCollisionChannel(),
+			                                             Projectile->GetCollisionShape(),
+			                                             Projectile->GetCollisionParams());
+		}
+
+		if (bIsBlockingHit)
+		{
+			Projectile->HandleHit(OutHitResult);
+			Projectile->Kill();
+
+			// @gdemers Kill should have released the projectile. make sure it isnt simulated further.
+			StopSimulation(Projectile);
+		}
+	}
+
+	// @gdemers hand back the allocation, unless new sweeps were queued by a callback.
+	if (PendingSweeps.IsEmpty())
+	{
+		PendingSweeps = MoveTemp(Sweeps);
+		PendingSweeps.Reset();
+	}
+}
+
+void UProjectileManagerSubsystem::FProjectileSimulation::Reset()
+{
+	Projectiles.Reset();
+	PositionsX.Reset();
+	PositionsY.Reset();
+	PositionsZ.Reset();
+	VelocitiesX.Reset();
+	VelocitiesY.Reset();
+	VelocitiesZ.Reset();
+	Decays.Reset();
+	VelocityFactors.Reset();
+	GravityPositionDeltas.Reset();
+	GravityVelocityDeltas.Reset();
+	RemainingSteps.Reset();
+	Serials.Reset();
+}
+
+void UProjectileManagerSubsystem::FProjectileSimulation::Integrate(const int32 NumSteps)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(UProjectileManagerSubsystem::FProjectileSimulation::Integrate);
+
+	// @gdemers see FProjectileBallisticCoefficients. each step is
+	// P += C1 * V (+ Gp on Z)
+	// V = D * V (+ Gv on Z)
+	// multiply, and add, are kept as separate operations in both paths, and aren't contracted. see the pragma at the top of
+	// this file.
+	const int32 NumVectorized = Num() - (Num() % NSProjectileBallistics::NumLanes);
+
+	int32 FirstLane = 0;
+	for (; FirstLane < NumVectorized; FirstLane += NSProjectileBallistics::NumLanes)
+	{
+		const VectorRegister4Double D = VectorLoad(&Decays[FirstLane]);
+		const VectorRegister4Double C1 = VectorLoad(&VelocityFactors[FirstLane]);
+		const VectorRegister4Double Gp = VectorLoad(&GravityPositionDeltas[FirstLane]);
+		const VectorRegister4Double Gv = VectorLoad(&GravityVelocityDeltas[FirstLane]);
+
+		VectorRegister4Double Px = VectorLoad(&PositionsX[FirstLane]);
+		VectorRegister4Double Py = VectorLoad(&PositionsY[FirstLane]);
+		VectorRegister4Double Pz = VectorLoad(&PositionsZ[FirstLane]);
+		VectorRegister4Double Vx = VectorLoad(&VelocitiesX[FirstLane]);
+		VectorRegister4Double Vy = VectorLoad(&VelocitiesY[FirstLane]);
+		VectorRegister4Double Vz = VectorLoad(&VelocitiesZ[FirstLane]);
+
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			Px = VectorAdd(Px, VectorMultiply(C1, Vx));
+			Py = VectorAdd(Py, VectorMultiply(C1, Vy));
+			Pz = VectorAdd(VectorAdd(Pz, VectorMultiply(C1, Vz)), Gp);
+			Vx = VectorMultiply(D, Vx);
+			Vy = VectorMultiply(D, Vy);
+			Vz = VectorAdd(VectorMultiply(D, Vz), Gv);
+		}
+
+		VectorStore(Px, &PositionsX[FirstLane]);
+		VectorStore(Py, &PositionsY[FirstLane]);
+		VectorStore(Pz, &PositionsZ[FirstLane]);
+		VectorStore(Vx, &VelocitiesX[FirstLane]);
+		VectorStore(Vy, &VelocitiesY[FirstLane]);
+		VectorStore(Vz, &VelocitiesZ[FirstLane]);
+	}
+
+	// @gdemers scalar tail. same operations, in the same order, so a projectile integrate identically in either path.
+	for (int32 i = FirstLane; i < Num(); ++i)
+	{
+		const double D = Decays[i];
+		const double C1 = VelocityFactors[i];
+
+		for (int32 Step = 0; Step < NumSteps; ++Step)
+		{
+			const double Dx = (C1 * VelocitiesX[i]);
+			const double Dy = (C1 * VelocitiesY[i]);
+			const double Dz = (C1 * VelocitiesZ[i]);
+			PositionsX[i] = (PositionsX[i] + Dx);
+			PositionsY[i] = (PositionsY[i] + Dy);
+			PositionsZ[i] = ((PositionsZ[i] + Dz) + GravityPositionDeltas[i]);
+
+			const double DVz = (D * VelocitiesZ[i]);
+			VelocitiesX[i] = (D * VelocitiesX[i]);
+			VelocitiesY[i] = (D * VelocitiesY[i]);
+			VelocitiesZ[i] = (DVz + GravityVelocityDeltas[i]);
+		}
+	}
+}
+
+FVector UProjectileManagerSubsystem::FProjectileSimulation::GetPosition(const int32 Index) const
+{
+	return FVector(PositionsX[Index], PositionsY[Index], PositionsZ[Index]);
+}
+
 UProjectileManagerSubsystem* UProjectileManagerSubsystem::Get(const UWorld* World)
 {
 	return UWorld::GetSubsystem<UProjectileManagerSubsystem>(World);
@@ -210,12 +628,9 @@ ANonReplicatedProjectileActor* UProjectileManagerSubsystem::Factory(const UClass
 	UWorld* World = GetWorld();
 	if (IsValid(World))
 	{
-		const FVector Location = AimTransform.GetLocation();
-		const FRotator Rotator = AimTransform.Rotator();
-		// @gdemers another good example of const-ness issue in the engine. theres no point in violating bitwise const-ness or logical const-ness and yet
-		// the engine require a UClass* to be non-const.
-		AActor* Instance = World->SpawnActor(const_cast<UClass*>(ProjectileClass), &Location, &Rotator, SpawnActorParameters);
-		return Cast<ANonReplicatedProjectileActor>(Instance);
+		// @gdemers only translation, and rotation, are forwarded. matches the previous SpawnActor(Location, Rotator) behaviour.
+		const FTransform SpawnTransform = FTransform(AimTransform.GetRotation(), AimTransform.GetLocation());
+		return UAVVMActorPoolSubsystem::Static_AcquireActor<ANonReplicatedProjectileActor>(World, ProjectileClass, SpawnTransform, SpawnActorParameters);
 	}
 
 	return nullptr;
@@ -225,6 +640,6 @@ void UProjectileManagerSubsystem::Shutdown(ANonReplicatedProjectileActor* Projec
 {
 	if (IsValid(Projectile))
 	{
-		Projectile->Destroy();
+		UAVVMActorPoolSubsystem::Static_ReleaseActor(GetWorld(), Projectile);
 	}
 }
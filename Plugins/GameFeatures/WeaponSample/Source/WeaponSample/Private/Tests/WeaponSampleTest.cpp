@@ -0,0 +1,364 @@
+//Copyright(c) 2025 gdemers
+//
+//Permission is hereby granted, free of charge, to any person obtaining a copy
+//of this software and associated documentation files(the "Software"), to deal
+//in the Software without restriction, including without limitation the rights
+//to use, copy, modify, merge, publish, distribute, sublicense, and /or sell
+//copies of the Software, and to permit persons to whom the Software is
+//furnished to do so, subject to the following conditions :
+//
+//The above copyright notice and this permission notice shall be included in all
+//copies or substantial portions of the Software.
+//
+//THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+//IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY,
+//FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT.IN NO EVENT SHALL THE
+//AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER
+//LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM,
+//OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE
+//SOFTWARE.
+#include "Misc/AutomationTest.h"
+
+#include "AutomatedTestProjectileActor.h"
+#include "ProjectileManagerSubsystem.h"
+#include "WeaponSettings.h"
+#include "Components/BoxComponent.h"
+#include "Data/ProjectileDefinitionDataAsset.h"
+#include "Engine/CollisionProfile.h"
+
+#if WITH_AUTOMATION_TESTS
+#include "Tests/AutomationCommon.h"
+
+/**
+ *	Class description:
+ *
+ *	FWeaponScopedProjectileSettings override async projectile sweeps for the lifetime of a test.
+ */
+class FWeaponScopedProjectileSettings
+{
+public:
+	FWeaponScopedProjectileSettings(const bool bNewUseAsyncProjectileSweeps)
+	{
+		auto* Settings = GetMutableDefault<UWeaponSettings>();
+		bPrevUseAsyncProjectileSweeps = Settings->bUseAsyncProjectileSweeps;
+		Settings->bUseAsyncProjectileSweeps = bNewUseAsyncProjectileSweeps;
+	}
+
+	~FWeaponScopedProjectileSettings()
+	{
+		auto* Settings = GetMutableDefault<UWeaponSettings>();
+		Settings->bUseAsyncProjectileSweeps = bPrevUseAsyncProjectileSweeps;
+	}
+
+private:
+	bool bPrevUseAsyncProjectileSweeps = false;
+};
+
+namespace NSWeaponSampleTest
+{
+	// @gdemers exact in binary, so positions can be compared after any number of steps.
+	static constexpr double FixedTimeStep = 0.125;
+	static constexpr float Speed = 1000.f;
+
+	// @gdemers blocking wall, its near face at X = 950.
+	static AActor* SpawnWall(UWorld* World)
+	{
+		auto* Wall = World->SpawnActor<AActor>();
+		if (!IsValid(Wall))
+		{
+			return nullptr;
+		}
+
+		auto* Box = NewObject<UBoxComponent>(Wall);
+		Box->SetBoxExtent(FVector(50.0, 2000.0, 2000.0));
+		Box->SetCollisionProfileName(UCollisionProfile::BlockAll_ProfileName);
+		Wall->SetRootComponent(Box);
+		Box->RegisterComponent();
+		Wall->SetActorLocation(FVector(1000.0, 0.0, 0.0));
+		return Wall;
+	}
+
+	static ANonReplicatedProjectileActor* Fire(const UWorld* World,
+	                                           const UProjectileManagerSubsystem* Subsystem,
+	                                           const FVector& Location,
+	                                           const FRotator& Rotation)
+	{
+		// @gdemers straight line. no gravity, and no drag.
+		FProjectileParams Params;
+		Params.Speed = Speed;
+		Params.MaxSimTime = 10.f;
+		Params.GravityZ = 0.f;
+		Params.Drag = 0.f;
+
+		FProjectileContextArgs ContextArgs;
+		ContextArgs.ProjectileClass = AAutomatedTestProjectileActor::StaticClass();
+		ContextArgs.ProjectileParams = TInstancedStruct<FProjectileParams>::Make(Params);
+		ContextArgs.AimTransform = FTransform(Rotation, Location);
+
+		UProjectileManagerSubsystem::Static_CreateProjectile(World, ContextArgs);
+		return Subsystem->Simulation.Projectiles.IsEmpty() ? nullptr : Subsystem->Simulation.Projectiles.Last().Get();
+	}
+}
+#endif
+
+/**
+ *	Class description:
+ *
+ *	ProjectileManagerSimulationTest is an Automated Test running validation on projectiles stepped from the simulation buffers.
+ *	Fixed step accumulation, hit order, and swap removal of finished projectiles.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProjectileManagerSimulationTest, "AutomatedTest.CustomGroup.ProjectileManagerSimulationTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool ProjectileManagerSimulationTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	auto* Subsystem = UWorld::GetSubsystem<UProjectileManagerSubsystem>(World);
+	UTEST_NOT_NULL("UProjectileManagerSubsystem.", Subsystem)
+
+	FWeaponScopedProjectileSettings ScopedSettings(false);
+	Subsystem->FixedTimeStep = NSWeaponSampleTest::FixedTimeStep;
+
+	UTEST_NOT_NULL("Wall.", NSWeaponSampleTest::SpawnWall(World))
+
+	// @gdemers one projectile per lane, flying along X. each step move them by 125cm, so their start decide the tick they
+	// hit the wall on. fired out of order, and across both the vectorized block, and the scalar tail.
+	const TArray<double> Starts = {410.0, 10.0, 810.0, 210.0, 610.0, 811.0};
+	const TArray<int32> ExpectedKillTicks = {5, 5, 2, 5, 3, 2};
+
+	TArray<ANonReplicatedProjectileActor*> TestProjectiles;
+	for (int32 i = 0; i < Starts.Num(); ++i)
+	{
+		ANonReplicatedProjectileActor* Projectile = NSWeaponSampleTest::Fire(World, Subsystem, FVector(Starts[i], (i * 200.0) - 1000.0, 0.0), FRotator::ZeroRotator);
+		UTEST_NOT_NULL("Projectile.", Projectile)
+		UTEST_EQUAL("Simulation Index.", Projectile->SimulationIndex, i)
+		TestProjectiles.Add(Projectile);
+	}
+
+	// @gdemers projectiles are killed at the end of the pass that hit. record the tick it happens on.
+	const TSharedRef<int32> CurrentTick = MakeShared<int32>(0);
+	const TSharedRef<TMap<ANonReplicatedProjectileActor*, int32>> KilledOnTick = MakeShared<TMap<ANonReplicatedProjectileActor*, int32>>();
+	for (ANonReplicatedProjectileActor* Projectile : TestProjectiles)
+	{
+		Projectile->OnProjectileShutdown.AddLambda([CurrentTick, KilledOnTick](ANonReplicatedProjectileActor* KilledProjectile)
+		{
+			KilledOnTick->Add(KilledProjectile, *CurrentTick);
+		});
+	}
+
+	// @gdemers frame time below the fixed step is accumulated, and not simulated.
+	Subsystem->Tick(0.0625f);
+	UTEST_EQUAL("Step Accumulator.", Subsystem->StepAccumulator, 0.0625)
+	UTEST_EQUAL("Not Stepped.", TestProjectiles[0]->GetActorLocation().X, Starts[0])
+
+	*CurrentTick = 1;
+	Subsystem->Tick(0.0625f);
+	UTEST_EQUAL("Step Accumulator.", Subsystem->StepAccumulator, 0.0)
+	UTEST_EQUAL("Stepped Once.", TestProjectiles[0]->GetActorLocation().X, Starts[0] + 125.0)
+
+	// @gdemers two hits in the same pass. removal start from the highest index, so the last projectile (index 5) is popped,
+	// and the one at index 4 fill the slot of index 2.
+	*CurrentTick = 2;
+	Subsystem->Tick(0.125f);
+	UTEST_EQUAL("Num Simulated.", Subsystem->Simulation.Num(), 4)
+	UTEST_EQUAL("Swapped Into Removed Slot.", TestProjectiles[4]->SimulationIndex, 2)
+	UTEST_EQUAL("Removed Index.", TestProjectiles[2]->SimulationIndex, INDEX_NONE)
+	UTEST_EQUAL("Removed Index.", TestProjectiles[5]->SimulationIndex, INDEX_NONE)
+
+	*CurrentTick = 3;
+	Subsystem->Tick(0.125f);
+	UTEST_EQUAL("Num Simulated.", Subsystem->Simulation.Num(), 3)
+	UTEST_EQUAL("Swapped Into Removed Slot.", TestProjectiles[3]->SimulationIndex, 2)
+
+	*CurrentTick = 4;
+	Subsystem->Tick(0.125f);
+	UTEST_EQUAL("Num Simulated.", Subsystem->Simulation.Num(), 3)
+	for (int32 i = 0; i < Subsystem->Simulation.Num(); ++i)
+	{
+		const ANonReplicatedProjectileActor* Projectile = Subsystem->Simulation.Projectiles[i].Get();
+		UTEST_NOT_NULL("Simulated Projectile.", Projectile)
+		UTEST_EQUAL("Simulation Index.", Projectile->SimulationIndex, i)
+		UTEST_EQUAL("Buffer Position.", Subsystem->Simulation.GetPosition(i).X, Projectile->GetActorLocation().X)
+	}
+
+	UTEST_EQUAL("Lane 0 Position.", TestProjectiles[0]->GetActorLocation().X, Starts[0] + 500.0)
+	UTEST_EQUAL("Lane 1 Position.", TestProjectiles[1]->GetActorLocation().X, Starts[1] + 500.0)
+	UTEST_EQUAL("Lane 3 Position.", TestProjectiles[3]->GetActorLocation().X, Starts[3] + 500.0)
+
+	// @gdemers a hitch is bounded to MaxStepsPerFrame, as a single sweep segment. the remaining lanes all cross the wall, and the
+	// frame time past a single step is dropped.
+	*CurrentTick = 5;
+	Subsystem->Tick(10.f);
+	UTEST_EQUAL("Num Simulated.", Subsystem->Simulation.Num(), 0)
+	UTEST_EQUAL("Step Accumulator.", Subsystem->StepAccumulator, NSWeaponSampleTest::FixedTimeStep)
+
+	for (int32 i = 0; i < TestProjectiles.Num(); ++i)
+	{
+		const int32* KillTick = KilledOnTick->Find(TestProjectiles[i]);
+		UTEST_NOT_NULL("Killed Projectile.", KillTick)
+		UTEST_EQUAL("Kill Tick.", *KillTick, ExpectedKillTicks[i])
+		UTEST_TRUE("Released Projectile.", TestProjectiles[i]->IsActorBeingDestroyed())
+	}
+
+	TestWorld.EndPlayInTestWorld();
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	ProjectileManagerAsyncSweepTest is an Automated Test running validation on sweeps resolved the frame after they are issued.
+ *	A sweep belonging to a previous simulation of the same projectile must be discarded.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProjectileManagerAsyncSweepTest, "AutomatedTest.CustomGroup.ProjectileManagerAsyncSweepTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool ProjectileManagerAsyncSweepTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	FTestWorldWrapper TestWorld;
+	TestWorld.CreateTestWorld(EWorldType::Game);
+	TestWorld.BeginPlayInTestWorld();
+
+	UWorld* World = TestWorld.GetTestWorld();
+	UTEST_NOT_NULL("UWorld.", World)
+
+	auto* Subsystem = UWorld::GetSubsystem<UProjectileManagerSubsystem>(World);
+	UTEST_NOT_NULL("UProjectileManagerSubsystem.", Subsystem)
+
+	FWeaponScopedProjectileSettings ScopedSettings(true);
+	Subsystem->FixedTimeStep = NSWeaponSampleTest::FixedTimeStep;
+
+	UTEST_NOT_NULL("Wall.", NSWeaponSampleTest::SpawnWall(World))
+
+	// @gdemers both cross the wall on their first step.
+	ANonReplicatedProjectileActor* Recycled = NSWeaponSampleTest::Fire(World, Subsystem, FVector(900.0, 0.0, 0.0), FRotator::ZeroRotator);
+	ANonReplicatedProjectileActor* Other = NSWeaponSampleTest::Fire(World, Subsystem, FVector(900.0, 500.0, 0.0), FRotator::ZeroRotator);
+	UTEST_NOT_NULL("Recycled Projectile.", Recycled)
+	UTEST_NOT_NULL("Other Projectile.", Other)
+
+	const TSharedRef<TArray<ANonReplicatedProjectileActor*>> Killed = MakeShared<TArray<ANonReplicatedProjectileActor*>>();
+	for (ANonReplicatedProjectileActor* Projectile : {Recycled, Other})
+	{
+		Projectile->OnProjectileShutdown.AddLambda([Killed](ANonReplicatedProjectileActor* KilledProjectile)
+		{
+			Killed->Add(KilledProjectile);
+		});
+	}
+
+	// @gdemers sweeps are issued, and projectiles advanced optimistically past the wall.
+	Subsystem->Tick(0.125f);
+	UTEST_EQUAL("Num Pending Sweeps.", Subsystem->PendingSweeps.Num(), 2)
+	UTEST_TRUE("Not Yet Resolved.", Killed->IsEmpty())
+
+	// @gdemers the first projectile stop, and is simulated again. i.e released, and re-acquired from the pool.
+	const int32 PrevSimulationIndex = Recycled->SimulationIndex;
+	const uint32 PrevSerial = Subsystem->Simulation.Serials[PrevSimulationIndex];
+	Subsystem->StopSimulation(Recycled);
+
+	Recycled->SetActorLocationAndRotation(FVector(900.0, 0.0, 0.0), FRotator(0.0, 180.0, 0.0));
+	Subsystem->StartSimulation(Recycled);
+	UTEST_TRUE("Simulated Again.", Subsystem->Simulation.Projectiles.IsValidIndex(Recycled->SimulationIndex))
+	UTEST_NOT_EQUAL("New Serial.", Subsystem->Simulation.Serials[Recycled->SimulationIndex], PrevSerial)
+
+	// @gdemers its pending sweep cross the wall, but belong to the previous simulation. only the other projectile is hit.
+	Subsystem->Tick(0.125f);
+	UTEST_EQUAL("Num Killed.", Killed->Num(), 1)
+	UTEST_TRUE("Other Killed.", Killed->Contains(Other))
+	UTEST_FALSE("Stale Sweep Discarded.", Killed->Contains(Recycled))
+	UTEST_EQUAL("Num Simulated.", Subsystem->Simulation.Num(), 1)
+	UTEST_EQUAL("Recycled Simulation Index.", Recycled->SimulationIndex, 0)
+
+	// @gdemers its new sweep, away from the wall, is the only one pending.
+	UTEST_EQUAL("Num Pending Sweeps.", Subsystem->PendingSweeps.Num(), 1)
+	UTEST_EQUAL("Pending Sweep Serial.", Subsystem->PendingSweeps[0].Serial, Subsystem->Simulation.Serials[0])
+
+	TestWorld.EndPlayInTestWorld();
+#endif
+	return true;
+}
+
+/**
+ *	Class description:
+ *
+ *	ProjectileBallisticKernelTest is an Automated Test running validation on the ballistic integrator. Coefficients against libm,
+ *	the vectorized block against the scalar tail, and the closed-form evaluation against explicit steps.
+ */
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(ProjectileBallisticKernelTest, "AutomatedTest.CustomGroup.ProjectileBallisticKernelTest", EAutomationTestFlags::EditorContext | EAutomationTestFlags::EngineFilter)
+bool ProjectileBallisticKernelTest::RunTest(const FString& Parameters)
+{
+#if WITH_AUTOMATION_TESTS
+	// @gdemers fixed polynomial decay, within a few ulp of libm.
+	for (const double Drag : {0.0001, 0.1, 0.5, 2.0, 10.0, 60.0})
+	{
+		const FProjectileBallisticCoefficients Coefficients(Drag, -980.0, NSWeaponSampleTest::FixedTimeStep);
+		const double Expected = FMath::Exp(-Drag * NSWeaponSampleTest::FixedTimeStep);
+		UTEST_EQUAL_TOLERANCE("Decay.", Coefficients.Decay, Expected, Expected * 1e-14)
+	}
+
+	const FVector Location = FVector(100.0, -250.0, 50.0);
+	const FVector Velocity = FVector(3000.0, 500.0, 1200.0);
+	const double TimeStep = (1.0 / 64.0);
+	const int32 NumSteps = 128;
+
+	FProjectileParams Params;
+	Params.GravityZ = -980.f;
+	Params.Drag = 0.5f;
+
+	// @gdemers the same launch state in the first lane of the vectorized block, and in the scalar tail. the lanes in between
+	// carry other states, and must not bleed into it.
+	UProjectileManagerSubsystem::FProjectileSimulation Simulation;
+	for (int32 i = 0; i < 5; ++i)
+	{
+		const bool bIsReference = (i == 0 || i == 4);
+		const FVector P = bIsReference ? Location : FVector(i * 10.0, i * -20.0, i * 30.0);
+		const FVector V = bIsReference ? Velocity : FVector(i * 700.0, i * 300.0, i * -100.0);
+		const FProjectileBallisticCoefficients Coefficients(bIsReference ? Params.Drag : (i * 0.3), Params.GravityZ, TimeStep);
+
+		Simulation.Projectiles.Add(nullptr);
+		Simulation.PositionsX.Add(P.X);
+		Simulation.PositionsY.Add(P.Y);
+		Simulation.PositionsZ.Add(P.Z);
+		Simulation.VelocitiesX.Add(V.X);
+		Simulation.VelocitiesY.Add(V.Y);
+		Simulation.VelocitiesZ.Add(V.Z);
+		Simulation.Decays.Add(Coefficients.Decay);
+		Simulation.VelocityFactors.Add(Coefficients.VelocityFactor);
+		Simulation.GravityPositionDeltas.Add(Coefficients.GravityPositionDelta);
+		Simulation.GravityVelocityDeltas.Add(Coefficients.GravityVelocityDelta);
+		Simulation.RemainingSteps.Add(NumSteps);
+		Simulation.Serials.Add(static_cast<uint32>(i));
+	}
+
+	// @gdemers uneven step counts, so both paths loop the same way a frame would.
+	Simulation.Integrate(NumSteps / 2);
+	Simulation.Integrate(NumSteps / 4);
+	Simulation.Integrate(NumSteps / 4);
+
+	// @gdemers bitwise equality. tolerance would hide a path diverging.
+	UTEST_TRUE("Position X.", Simulation.PositionsX[0] == Simulation.PositionsX[4])
+	UTEST_TRUE("Position Y.", Simulation.PositionsY[0] == Simulation.PositionsY[4])
+	UTEST_TRUE("Position Z.", Simulation.PositionsZ[0] == Simulation.PositionsZ[4])
+	UTEST_TRUE("Velocity X.", Simulation.VelocitiesX[0] == Simulation.VelocitiesX[4])
+	UTEST_TRUE("Velocity Y.", Simulation.VelocitiesY[0] == Simulation.VelocitiesY[4])
+	UTEST_TRUE("Velocity Z.", Simulation.VelocitiesZ[0] == Simulation.VelocitiesZ[4])
+
+	// @gdemers a single step of the whole duration is the exact solution. explicit steps only differ by rounding.
+	FVector OutLocation = FVector::ZeroVector;
+	FVector OutVelocity = FVector::ZeroVector;
+	UProjectileFunctionLibrary::EvaluateBallisticTrajectory(TInstancedStruct<FProjectileParams>::Make(Params),
+	                                                        Location,
+	                                                        Velocity,
+	                                                        static_cast<float>(NumSteps * TimeStep),
+	                                                        OutLocation,
+	                                                        OutVelocity);
+
+	UTEST_TRUE("Closed Form Location.", Simulation.GetPosition(4).Equals(OutLocation, 1e-6))
+	UTEST_TRUE("Closed Form Velocity.", FVector(Simulation.VelocitiesX[4], Simulation.VelocitiesY[4], Simulation.VelocitiesZ[4]).Equals(OutVelocity, 1e-6))
+#endif
+	return true;
+}
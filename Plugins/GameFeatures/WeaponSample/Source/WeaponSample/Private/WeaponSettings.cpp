@@ -38,3 +38,13 @@ float UWeaponSettings::GetSquaredDistanceThreshold()
 {
 	return GetDefault<UWeaponSettings>()->SquaredDistanceThreshold;
 }
+
+bool UWeaponSettings::ShouldUseAsyncProjectileSweeps()
+{
+	return GetDefault<UWeaponSettings>()->bUseAsyncProjectileSweeps;
+}
+
+float UWeaponSettings::GetProjectileFixedTimeStep()
+{
+	return GetDefault<UWeaponSettings>()->ProjectileFixedTimeStep;
+}
@@ -57,6 +57,14 @@ struct WEAPONSAMPLE_API FProjectileParams
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers")
 	float MaxSimTime = 0.f;
+
+	// @gdemers acceleration along world Z, in cm/s2. matches the engine default gravity.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers")
+	float GravityZ = -980.f;
+
+	// @gdemers linear drag, in 1/s. velocity decays by exp(-Drag * t).
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Category="Designers", meta=(ClampMin=0))
+	float Drag = 0.f;
 };
 
 template<> struct TBaseStructure<FProjectileParams> 
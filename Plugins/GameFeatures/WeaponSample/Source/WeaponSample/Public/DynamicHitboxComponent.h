@@ -73,6 +73,11 @@ protected:
 
 	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Designers")
 	TMap<FGameplayTag, EPhysicState> MovementTagToPhysicAssets;
+
+	// @gdemers record per-bone hitbox snapshots on the server, for lag compensated hit validation. the server mesh must be animated
+	// (i.e - VisibilityBasedAnimTickOption set to AlwaysTickPoseAndRefreshBones).
+	UPROPERTY(EditAnywhere, BlueprintReadOnly, Category="Designers")
+	bool bRecordPoseHistory = false;
 	
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TWeakObjectPtr<const UPawnMovementComponent> MovementComponent = nullptr;
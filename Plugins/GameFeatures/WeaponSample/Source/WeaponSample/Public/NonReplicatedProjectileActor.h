@@ -21,11 +21,11 @@
 
 #include "CoreMinimal.h"
 
+#include "AVVMPoolableActor.h"
 #include "CollisionQueryParams.h"
 #include "GameplayTagContainer.h"
 #include "GameFramework/Actor.h"
 #include "Kismet/BlueprintFunctionLibrary.h"
-#include "Kismet/GameplayStaticsTypes.h"
 #include "StructUtils/InstancedStruct.h"
 
 #include "NonReplicatedProjectileActor.generated.h"
@@ -40,11 +40,35 @@ DECLARE_MULTICAST_DELEGATE_OneParam(FOnProjectileShutdownRequestDelegate, ANonRe
 /**
  *	Class description:
  *
- *	ANonReplicatedProjectileActor is a non-replicated actor that simulate projectile updates
- *	on both server-client.
+ *	FProjectileBallisticCoefficients is the exact solution of dv/dt = g - k * v over a time step h, with gravity g along world Z,
+ *	and linear drag k. Advancing a projectile by h reduce to
+ *
+ *	P += VelocityFactor * V, plus GravityPositionDelta on Z.
+ *	V = Decay * V, plus GravityVelocityDelta on Z.
+ *
+ *	which is free of branches, and transcendental functions, once the coefficients are known. Decay is itself evaluated from
+ *	a fixed polynomial rather than libm, so coefficients match between platforms.
+ */
+struct WEAPONSAMPLE_API FProjectileBallisticCoefficients
+{
+	FProjectileBallisticCoefficients(const double Drag, const double GravityZ, const double TimeStep);
+
+	double Decay = 1.0;
+	double VelocityFactor = 0.0;
+	double GravityPositionDelta = 0.0;
+	double GravityVelocityDelta = 0.0;
+};
+
+/**
+ *	Class description:
+ *
+ *	ANonReplicatedProjectileActor is a non-replicated actor that represent projectile updates
+ *	on both server-client. Simulation is owned by the UProjectileManagerSubsystem, and the actor
+ *	only reflect its state. Instances are recycled through the UAVVMActorPoolSubsystem.
  */
 UCLASS(BlueprintType, Blueprintable)
-class WEAPONSAMPLE_API ANonReplicatedProjectileActor : public AActor
+class WEAPONSAMPLE_API ANonReplicatedProjectileActor : public AActor,
+                                                       public IAVVMPoolableActor
 {
 	GENERATED_BODY()
 
@@ -52,7 +76,10 @@ public:
 	ANonReplicatedProjectileActor(const FObjectInitializer& ObjectInitializer);
 	virtual void BeginPlay() override;
 	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
-	virtual void Tick(float DeltaSeconds) override;
+
+	// IAVVMPoolableActor
+	virtual void OnAcquiredFromPool() override;
+	virtual void OnReleasedToPool() override;
 
 	FOnProjectileShutdownRequestDelegate OnProjectileShutdown;
 
@@ -73,21 +100,21 @@ protected:
 	UPROPERTY(Transient, BlueprintReadOnly)
 	TInstancedStruct<FExplosionParams> ExplosionTemplate;
 
-	UPROPERTY(Transient, BlueprintReadOnly)
-	FPredictProjectilePathResult PredictedPathResult;
+	// @gdemers actors ignored by simulation sweeps. i.e the instigator, and its weapon.
+	FCollisionQueryParams CollisionParams = FCollisionQueryParams::DefaultQueryParam;
 
-	UPROPERTY(Transient, BlueprintReadOnly)
-	bool bDoesPredictBlockingHit = false;
-
-	UPROPERTY(Transient, BlueprintReadOnly)
-	int32 PointDataIndex = INDEX_NONE;
-
-	UPROPERTY(Transient, BlueprintReadOnly)
-	double Timestamp = 0.f;
+	// @gdemers slot in UProjectileManagerSubsystem simulation buffers. INDEX_NONE when not simulated.
+	int32 SimulationIndex = INDEX_NONE;
 
 	friend struct FProjectileParams;
 	friend struct FExplosionParams;
 	friend class UProjectileComponent;
+	friend class UProjectileManagerSubsystem;
+
+#if WITH_AUTOMATION_TESTS
+	friend class ProjectileManagerSimulationTest;
+	friend class ProjectileManagerAsyncSweepTest;
+#endif
 };
 
 /**
@@ -101,10 +128,14 @@ class WEAPONSAMPLE_API UProjectileFunctionLibrary : public UBlueprintFunctionLib
 	GENERATED_BODY()
 
 public:
+	// @gdemers closed-form evaluation of a trajectory, Time seconds after Location, and Velocity. matches the projectile simulation.
 	UFUNCTION(BlueprintCallable, Category="Weapon|Utils")
-	static FVector GetDeltaVelocity(const FVector& Velocity,
-	                                const float Mass,
-	                                const float DeltaTime);
+	static void EvaluateBallisticTrajectory(const TInstancedStruct<FProjectileParams>& Params,
+	                                        const FVector& Location,
+	                                        const FVector& Velocity,
+	                                        const float Time,
+	                                        FVector& OutLocation,
+	                                        FVector& OutVelocity);
 
 	UFUNCTION(BlueprintCallable, Category="Weapon|Utils")
 	static bool CheckDistance(const ANonReplicatedProjectileActor* Projectile,
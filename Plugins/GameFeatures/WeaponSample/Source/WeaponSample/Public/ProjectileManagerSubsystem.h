@@ -65,6 +65,12 @@ struct WEAPONSAMPLE_API FProjectileContextArgs
  *	UProjectileManagerSubsystem is a subsystem tracking projectile location and notify
  *	external sources of PassBy events or react to actor pooling request.
  *
+ *	Projectile state is owned here, in parallel arrays, and stepped in a single pass on Tick, at a fixed time step
+ *	using a closed-form ballistic integrator. Sweeps are
+ *	gathered first, then issued as a batch. Actors only act as visual representation of the simulation.
+ *	When UWeaponSettings enable async sweeps, queries are issued through the physics scene and consumed
+ *	the following frame.
+ *
  *	External should bind to events on this system to react to projectile events
  *	that require conditional checks on Tick events.
  */
@@ -96,7 +102,12 @@ protected:
 	static UProjectileManagerSubsystem* Get(const UWorld* World);
 	void Register(ANonReplicatedProjectileActor* Projectile);
 	void Unregister(ANonReplicatedProjectileActor* Projectile);
-	void CreateProjectile(const FProjectileContextArgs& ContextArgs) const;
+	void CreateProjectile(const FProjectileContextArgs& ContextArgs);
+	void StartSimulation(ANonReplicatedProjectileActor* Projectile);
+	void StopSimulation(ANonReplicatedProjectileActor* Projectile);
+	void RemoveSimulationAt(const int32 SimulationIndex);
+	void StepSimulation(const float DeltaTime);
+	void ResolvePendingSweeps(UWorld* World);
 
 	UFUNCTION(CallInEditor)
 	void OnPlayerStateAddedOrRemoved(const TInstancedStruct<FAVVMNotificationPayload>& NewPayload);
@@ -118,4 +129,71 @@ protected:
 	
 	UPROPERTY(Transient)
 	TArray<TObjectPtr<ANonReplicatedProjectileActor>> Projectiles;
+
+	/**
+	 *	Class description:
+	 *
+	 *	FProjectileSimulation is the hot state of every simulated projectile, laid out as struct-of-arrays. All arrays
+	 *	share the same index, and removal is done by swap, so the ANonReplicatedProjectileActor::SimulationIndex of the
+	 *	moved entry has to be patched.
+	 */
+	struct FProjectileSimulation
+	{
+		int32 Num() const { return Projectiles.Num(); }
+		void Reset();
+		void Integrate(const int32 NumSteps);
+		FVector GetPosition(const int32 Index) const;
+
+		TArray<TWeakObjectPtr<ANonReplicatedProjectileActor>> Projectiles;
+		TArray<double> PositionsX;
+		TArray<double> PositionsY;
+		TArray<double> PositionsZ;
+		TArray<double> VelocitiesX;
+		TArray<double> VelocitiesY;
+		TArray<double> VelocitiesZ;
+		TArray<double> Decays;
+		TArray<double> VelocityFactors;
+		TArray<double> GravityPositionDeltas;
+		TArray<double> GravityVelocityDeltas;
+		TArray<int32> RemainingSteps;
+		TArray<uint32> Serials;
+	};
+
+	/**
+	 *	Class description:
+	 *
+	 *	FAsyncProjectileSweep is a sweep issued with AsyncSweepByChannel, awaiting resolution on the next frame.
+	 *	Serial identify the simulation the sweep belong to, so recycled projectiles discard stale results.
+	 */
+	struct FAsyncProjectileSweep
+	{
+		TWeakObjectPtr<ANonReplicatedProjectileActor> Projectile = nullptr;
+		FTraceHandle Handle;
+		FVector Start = FVector::ZeroVector;
+		FVector End = FVector::ZeroVector;
+		uint32 Serial = 0;
+	};
+
+	FProjectileSimulation Simulation;
+	TArray<FAsyncProjectileSweep> PendingSweeps;
+	uint32 NextSimulationSerial = 0;
+
+	// @gdemers fixed simulation step, and the frame time not yet consumed by it.
+	double FixedTimeStep = 0.0;
+	double StepAccumulator = 0.0;
+
+	// @gdemers scratch buffers, reused across frames to avoid re-allocation in the hot path.
+	TArray<int32> SweepIndices;
+	TArray<FVector> SweepStarts;
+	TArray<FVector> SweepEnds;
+	TArray<int32> FinishedIndices;
+
+	// @gdemers removal requested during StepSimulation are deferred to the end of the pass so indices remain stable.
+	bool bIsSteppingSimulation = false;
+
+#if WITH_AUTOMATION_TESTS
+	friend class ProjectileManagerSimulationTest;
+	friend class ProjectileManagerAsyncSweepTest;
+	friend class ProjectileBallisticKernelTest;
+#endif
 };
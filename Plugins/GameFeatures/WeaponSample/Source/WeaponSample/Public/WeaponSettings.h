@@ -47,6 +47,12 @@ public:
 	UFUNCTION(BlueprintCallable, Category="Weapon|Settings")
 	static float GetSquaredDistanceThreshold();
 
+	UFUNCTION(BlueprintCallable, Category="Weapon|Settings")
+	static bool ShouldUseAsyncProjectileSweeps();
+
+	UFUNCTION(BlueprintCallable, Category="Weapon|Settings")
+	static float GetProjectileFixedTimeStep();
+
 protected:
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers")
 	bool bDoesDebugTraceShowPersistentLine = false;
@@ -56,4 +62,16 @@ protected:
 
 	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers")
 	float SquaredDistanceThreshold = false;
+
+	// @gdemers issue projectile sweeps with AsyncSweepByChannel and resolve hits on the following frame.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers")
+	bool bUseAsyncProjectileSweeps = false;
+
+	// @gdemers projectile simulation step, in seconds. server, and client, must agree on it for trajectories to match.
+	UPROPERTY(EditDefaultsOnly, BlueprintReadOnly, Config, Category="Designers", meta=(ClampMin=0.004))
+	float ProjectileFixedTimeStep = (1.f / 60.f);
+
+#if WITH_AUTOMATION_TESTS
+	friend class FWeaponScopedProjectileSettings;
+#endif
 };